@@ -67,6 +67,7 @@
  *  - rtarch_a64_128x2v1.h - fp64, 32 SIMD regs, 15 128-bit pairs, 30+temps used
  *  - rtarch_a32_SVEx1v1.h - fp32, 32 SIMD regs, SVE 256:2048-bit, 30+temps used
  *  - rtarch_a64_SVEx1v1.h - fp64, 32 SIMD regs, SVE 256:2048-bit, 30+temps used
+ *  - rtarch_a32_SVEx1vP.h - fp32, 6 predicates, SVE 256:2048-bit, p2-p7 used
  *  - rtarch_a32_SVEx2v1.h - fp32, 32 SIMD regs, 15 ARM-SVE pairs, 30+temps used
  *  - rtarch_a64_SVEx2v1.h - fp64, 32 SIMD regs, 15 ARM-SVE pairs, 30+temps used
  *  - rtarch_m32.h         - MIPS32 r5/r6 ISA, 32 BASE regs, 14+temps used
@@ -101,10 +102,13 @@
  *  - rtarch_x64_128x1v8.h - fp64, 16 SIMD regs, AVX 128-bit, all 16 can be used
  *  - rtarch_x32_256x1v2.h - fp32, 16 SIMD regs, AVX 256-bit, all 16 can be used
  *  - rtarch_x64_256x1v2.h - fp64, 16 SIMD regs, AVX 256-bit, all 16 can be used
+ *  - rtarch_x32_256x1v4.h - fp32, 16 SIMD regs, AVX 256-bit, 30 regs emulated
+ *  - rtarch_x64_256x1v4.h - fp64, 16 SIMD regs, AVX 256-bit, 30 regs emulated
  *  - rtarch_x32_256x1v8.h - fp32, 32 SIMD regs, AVX-512+ 256-bit, only 30 used
  *  - rtarch_x64_256x1v8.h - fp64, 32 SIMD regs, AVX-512+ 256-bit, only 30 used
  *  - rtarch_x32_512x1v8.h - fp32, 32 SIMD regs, AVX-512+ 512-bit, only 30 used
  *  - rtarch_x64_512x1v8.h - fp64, 32 SIMD regs, AVX-512+ 512-bit, only 30 used
+ *  - rtarch_x32_512x1vP.h - fp32, 6 predicates, AVX-512+ 512-bit, k2-k7 used
  *  - rtarch_x32_512x2v2.h - fp32, 32 SIMD regs, 16 512-bit pairs, 32 used
  *  - rtarch_x64_512x2v2.h - fp64, 32 SIMD regs, 16 512-bit pairs, 32 used
  *
@@ -115,8 +119,6 @@
  *  - rtarch_x64.h         - x86_64:x64 ISA, 16 BASE regs, 14+temps used
  *  - rtarch_x32_128x1v1.h - fp32, 16 SIMD regs, SSE 128-bit, 30 regs emulated
  *  - rtarch_x64_128x1v1.h - fp64, 16 SIMD regs, SSE 128-bit, 30 regs emulated
- *  - rtarch_x32_256x1v4.h - fp32, 16 SIMD regs, AVX 256-bit, 30 regs emulated
- *  - rtarch_x64_256x1v4.h - fp64, 16 SIMD regs, AVX 256-bit, 30 regs emulated
  *  - rtarch_r32.h         - RISC-V 32-bit ISA, 32 BASE regs, 14+temps used
  *  - rtarch_r64.h         - RISC-V 64-bit ISA, 32 BASE regs, 14+temps used
  *  - rtarch_r32_***x*v*.h - fp32, SIMD alternative for RISC-V
@@ -327,7 +329,9 @@
 #define RT_SIMD_COMPAT_DIV_MASTER       1 /* for full-precision divps_** */
 #define RT_SIMD_COMPAT_SQR_MASTER       1 /* for full-precision sqrps_** */
 #define RT_SIMD_COMPAT_SSE_MASTER       4 /* for v4 slot SSE2/4.1 - 2,4 (x64) */
+#define RT_SIMD_COMPAT_256_MASTER       2 /* for v4 slot AVX1/2 - 1,2 (x64) */
 #define RT_SIMD_COMPAT_FMR_MASTER       0 /* for fm*ps_** rounding mode (x86) */
+#define RT_SIMD_COMPAT_DOT_MASTER       1 /* for VNNI-based dph*n_** (x86) */
 #define RT_SIMD_FLUSH_ZERO_MASTER       0 /* optional on MIPS and POWER */
 
 /*
@@ -507,9 +511,11 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITW(0xE3A00500 | MRM(TNxx, 0x00, 0x00)) /* r8  <- (0 << 22) */
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
@@ -533,12 +539,14 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITW(0xE3A00503 | MRM(TExx, 0x00, 0x00)) /* r14 <- (3 << 22) */    \
         EMITW(0xE3A00502 | MRM(TCxx, 0x00, 0x00)) /* r12 <- (2 << 22) */    \
         EMITW(0xE3A00501 | MRM(TAxx, 0x00, 0x00)) /* r10 <- (1 << 22) */    \
         EMITW(0xE3A00500 | MRM(TNxx, 0x00, 0x00)) /* r8  <- (0 << 22) */
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
@@ -578,10 +586,12 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITW(0xE3A00504 | MRM(TNxx, 0x00, 0x00)) /* r8  <- (4 << 22) */    \
         EMITW(0xEEE10A10 | MRM(TNxx, 0x00, 0x00)) /* fpscr <- r8 */
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         EMITW(0xE3A00500 | MRM(TNxx, 0x00, 0x00)) /* r8  <- (0 << 22) */    \
         EMITW(0xEEE10A10 | MRM(TNxx, 0x00, 0x00)) /* fpscr <- r8 */         \
         sregs_la()                                                          \
@@ -607,6 +617,7 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITW(0xE3A00507 | MRM(TExx, 0x00, 0x00)) /* r14 <- (7 << 22) */    \
         EMITW(0xE3A00506 | MRM(TCxx, 0x00, 0x00)) /* r12 <- (6 << 22) */    \
         EMITW(0xE3A00505 | MRM(TAxx, 0x00, 0x00)) /* r10 <- (5 << 22) */    \
@@ -614,6 +625,7 @@
         EMITW(0xEEE10A10 | MRM(TNxx, 0x00, 0x00)) /* fpscr <- r8 */
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         EMITW(0xE3A00500 | MRM(TNxx, 0x00, 0x00)) /* r8  <- (0 << 22) */    \
         EMITW(0xEEE10A10 | MRM(TNxx, 0x00, 0x00)) /* fpscr <- r8 */         \
         sregs_la()                                                          \
@@ -764,12 +776,14 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITS(0x2518E3E0)                    /* SVE: p0  <- all-ones */     \
         movpx_ld(XmmE, Mebp, inf_GPC07)      /* SVE: z14 <- all-ones */     \
         EMITS(0x04603000 | MXM(TmmQ, 0x0E, 0x0E)) /* z15 <- z14 (or) */     \
         EMITW(0x52A00000 | MRM(TNxx, 0x00, 0x00)) /* x20 <- (0 << 22) */
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
@@ -793,6 +807,7 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITS(0x2518E3E0)                    /* SVE: p0  <- all-ones */     \
         movpx_ld(XmmE, Mebp, inf_GPC07)      /* SVE: z14 <- all-ones */     \
         EMITS(0x04603000 | MXM(TmmQ, 0x0E, 0x0E)) /* z15 <- z14 (or) */     \
@@ -802,6 +817,7 @@
         EMITW(0x52A00000 | MRM(TNxx, 0x00, 0x00)) /* x20 <- (0 << 22) */
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
@@ -841,6 +857,7 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITS(0x2518E3E0)                    /* SVE: p0  <- all-ones */     \
         movpx_ld(XmmE, Mebp, inf_GPC07)      /* SVE: z14 <- all-ones */     \
         EMITS(0x04603000 | MXM(TmmQ, 0x0E, 0x0E)) /* z15 <- z14 (or) */     \
@@ -848,6 +865,7 @@
         EMITW(0xD51B4400 | MRM(TNxx, 0x00, 0x00)) /* fpcr <- x20 */
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         EMITW(0x52A00000 | MRM(TNxx, 0x00, 0x00)) /* x20 <- (0 << 22) */    \
         EMITW(0xD51B4400 | MRM(TNxx, 0x00, 0x00)) /* fpcr <- x20 */         \
         sregs_la()                                                          \
@@ -873,6 +891,7 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITS(0x2518E3E0)                    /* SVE: p0  <- all-ones */     \
         movpx_ld(XmmE, Mebp, inf_GPC07)      /* SVE: z14 <- all-ones */     \
         EMITS(0x04603000 | MXM(TmmQ, 0x0E, 0x0E)) /* z15 <- z14 (or) */     \
@@ -883,6 +902,7 @@
         EMITW(0xD51B4400 | MRM(TNxx, 0x00, 0x00)) /* fpcr <- x20 */
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         EMITW(0x52A00000 | MRM(TNxx, 0x00, 0x00)) /* x20 <- (0 << 22) */    \
         EMITW(0xD51B4400 | MRM(TNxx, 0x00, 0x00)) /* fpcr <- x20 */         \
         sregs_la()                                                          \
@@ -1064,10 +1084,12 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITS(0x7860001E | MXM(TmmZ, TmmZ, TmmZ)) /* w30 <- 0 (xor) */      \
         EMITW(0x3C000000 | MRM(0x00, 0x00, TNxx)) /* r20 <- 0|(0 << 24) */
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
@@ -1091,6 +1113,7 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITS(0x7860001E | MXM(TmmZ, TmmZ, TmmZ)) /* w30 <- 0 (xor) */      \
         EMITW(0x34000003 | MRM(0x00, TZxx, TExx)) /* r23 <- 3|(0 << 24) */  \
         EMITW(0x34000002 | MRM(0x00, TZxx, TCxx)) /* r22 <- 2|(0 << 24) */  \
@@ -1098,6 +1121,7 @@
         EMITW(0x3C000000 | MRM(0x00, 0x00, TNxx)) /* r20 <- 0|(0 << 24) */
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
@@ -1137,12 +1161,14 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITS(0x7860001E | MXM(TmmZ, TmmZ, TmmZ)) /* w30 <- 0 (xor) */      \
         EMITW(0x3C000100 | MRM(0x00, 0x00, TNxx)) /* r20 <- 0|(1 << 24) */  \
         EMITW(0x44C0F800 | MRM(0x00, 0x00, TNxx)) /* fcsr <- r20 */         \
         EMITS(0x783E0059 | MXM(0x00, TNxx, 0x00)) /* msacsr <- r20 */
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         EMITW(0x3C000000 | MRM(0x00, 0x00, TNxx)) /* r20 <- 0|(0 << 24) */  \
         EMITW(0x44C0F800 | MRM(0x00, 0x00, TNxx)) /* fcsr <- r20 */         \
         EMITS(0x783E0059 | MXM(0x00, TNxx, 0x00)) /* msacsr <- r20 */       \
@@ -1169,6 +1195,7 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITS(0x7860001E | MXM(TmmZ, TmmZ, TmmZ)) /* w30 <- 0 (xor) */      \
         EMITW(0x34000003 | MRM(0x00, TZxx, TExx)) /* r23 <- 3|(1 << 24) */  \
         EMITW(0x34000002 | MRM(0x00, TZxx, TCxx)) /* r22 <- 2|(1 << 24) */  \
@@ -1178,6 +1205,7 @@
         EMITS(0x783E0059 | MXM(0x00, TNxx, 0x00)) /* msacsr <- r20 */
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         EMITW(0x3C000000 | MRM(0x00, 0x00, TNxx)) /* r20 <- 0|(0 << 24) */  \
         EMITW(0x44C0F800 | MRM(0x00, 0x00, TNxx)) /* fcsr <- r20 */         \
         EMITS(0x783E0059 | MXM(0x00, TNxx, 0x00)) /* msacsr <- r20 */       \
@@ -1409,6 +1437,7 @@
         EMITS(0x38000030 | MRM(T3xx, 0x00, 0x00)) /* r23 <- 48 */           \
         EMITW(0x7C000278 | MSM(TZxx, TZxx, TZxx)) /* r0  <- 0 (xor) */      \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITW(0x7C000040 | MRM(0x08, TLxx, TLxx)) /* cmplw cr2, r24, r24 */ \
         EMITW(0x7C0002A6 | MRM(TCxx, 0x00, 0x09)) /* ctr -> r28 */          \
         EMITS(0x7C0002A6 | MRM(TVxx, 0x08, 0x00)) /* vrsave -> r29 */       \
@@ -1426,6 +1455,7 @@
         EMITP(0xF0000496 | MXM(TmmM, 0x04, 0x04)) /* vs31 <- v4 */
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         EMITW(0x7C0003A6 | MRM(TCxx, 0x00, 0x09)) /* ctr <- r28 */          \
         EMITS(0x7C0003A6 | MRM(TVxx, 0x08, 0x00)) /* vrsave <- r29 */       \
         sregs_la()                                                          \
@@ -1469,6 +1499,7 @@
         EMITS(0x38000030 | MRM(T3xx, 0x00, 0x00)) /* r23 <- 48 */           \
         EMITW(0x7C000278 | MSM(TZxx, TZxx, TZxx)) /* r0  <- 0 (xor) */      \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         EMITW(0x7C000040 | MRM(0x08, TLxx, TLxx)) /* cmplw cr2, r24, r24 */ \
         EMITW(0x7C0002A6 | MRM(TCxx, 0x00, 0x09)) /* ctr -> r28 */          \
         EMITS(0x7C0002A6 | MRM(TVxx, 0x08, 0x00)) /* vrsave -> r29 */       \
@@ -1489,6 +1520,7 @@
         EMITS(0x10000644 | MXM(0x00, 0x00, TmmM)) /* vscr <- v31, NJ(16) */
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         EMITW(0xFC00010C | MRM(0x1C, 0x00, 0x00)) /* fpscr <- NI(0) */      \
         EMITS(0x1000034C | MXM(TmmM, 0x00, 0x00)) /* v31 <- splt-half(0) */ \
         EMITS(0x10000644 | MXM(0x00, 0x00, TmmM)) /* vscr <- v31, NJ(16) */ \
@@ -1616,12 +1648,24 @@
 #define RT_SIMD_COMPAT_SSE      RT_SIMD_COMPAT_SSE_MASTER
 #endif /* RT_SIMD_COMPAT_SSE */
 
+/* RT_SIMD_COMPAT_256 distinguishes between 256-bit AVX1 & AVX2
+ * if RT_256 = 4 SIMD backend (30 regs emulated) is among build targets */
+#ifndef RT_SIMD_COMPAT_256
+#define RT_SIMD_COMPAT_256      RT_SIMD_COMPAT_256_MASTER
+#endif /* RT_SIMD_COMPAT_256 */
+
 /* RT_SIMD_COMPAT_FMR when enabled changes the default behavior
  * of fm*ps_** instruction fallbacks to honour rounding mode */
 #ifndef RT_SIMD_COMPAT_FMR
 #define RT_SIMD_COMPAT_FMR      RT_SIMD_COMPAT_FMR_MASTER
 #endif /* RT_SIMD_COMPAT_FMR */
 
+/* RT_SIMD_COMPAT_DOT when disabled changes the default behavior
+ * of dph*n_** instructions on AVX-512 targets to AVX512-VNNI variants */
+#ifndef RT_SIMD_COMPAT_DOT
+#define RT_SIMD_COMPAT_DOT      RT_SIMD_COMPAT_DOT_MASTER
+#endif /* RT_SIMD_COMPAT_DOT */
+
 /* RT_BASE_COMPAT_BMI when enabled changes the default behavior
  * of some bit-manipulation instructions to use BMI variants */
 #ifdef  RT_SIMD_CODE
@@ -1665,7 +1709,7 @@
 #elif (RT_128X4 != 0) && (RT_SIMD == 512)
 #error "x86_64: doesn't support quaded SSEx backends, check build flags"
 #elif (RT_256X1 &  4) && (RT_SIMD == 256) && (RT_REGS <= 32)
-#error "x86_64: doesn't yet support emulated 30-regs, check build flags"
+#include "rtarch_x64_256x1v4.h"
 #elif (RT_256X1 >= 8) && (RT_SIMD == 256) && (RT_REGS <= 32)
 #include "rtarch_x64_256x1v8.h"
 #elif (RT_256X1 >= 1) && (RT_SIMD == 256) && (RT_REGS <= 16)
@@ -1706,9 +1750,11 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
@@ -1732,12 +1778,14 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
         movwx_mi(Mebp, inf_FCTRL(2*4), IH(0x5F80))                          \
         movwx_mi(Mebp, inf_FCTRL(1*4), IH(0x3F80))                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
@@ -1777,10 +1825,12 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
@@ -1806,6 +1856,7 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0xFF80))                          \
         movwx_mi(Mebp, inf_FCTRL(2*4), IH(0xDF80))                          \
         movwx_mi(Mebp, inf_FCTRL(1*4), IH(0xBF80))                          \
@@ -1813,6 +1864,7 @@
         mxcsr_ld(Mebp, inf_FCTRL(0*4))
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
@@ -1973,9 +2025,11 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
@@ -1999,12 +2053,14 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
         movwx_mi(Mebp, inf_FCTRL(2*4), IH(0x5F80))                          \
         movwx_mi(Mebp, inf_FCTRL(1*4), IH(0x3F80))                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
@@ -2044,10 +2100,12 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
@@ -2073,6 +2131,7 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0xFF80))                          \
         movwx_mi(Mebp, inf_FCTRL(2*4), IH(0xDF80))                          \
         movwx_mi(Mebp, inf_FCTRL(1*4), IH(0xBF80))                          \
@@ -2080,6 +2139,7 @@
         mxcsr_ld(Mebp, inf_FCTRL(0*4))
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
@@ -2249,9 +2309,11 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(__Reax__)                                                  \
@@ -2272,12 +2334,14 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
         movwx_mi(Mebp, inf_FCTRL(2*4), IH(0x5F80))                          \
         movwx_mi(Mebp, inf_FCTRL(1*4), IH(0x3F80))                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
 
 #define ASM_LEAVE(__Info__)                                                 \
+        fpsts_la()                                                          \
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(__Reax__)                                                  \
@@ -2314,10 +2378,12 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
@@ -2340,6 +2406,7 @@
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
+        fpsts_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0xFF80))                          \
         movwx_mi(Mebp, inf_FCTRL(2*4), IH(0xDF80))                          \
         movwx_mi(Mebp, inf_FCTRL(1*4), IH(0xBF80))                          \
@@ -2347,6 +2414,7 @@
         mxcsr_ld(Mebp, inf_FCTRL(0*4))
 
 #define ASM_LEAVE_F(__Info__)                                               \
+        fpsts_la()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
@@ -2367,6 +2435,16 @@
 
 #endif /* OS, COMPILER, ARCH */
 
+/*
+ * Number of predicate registers (Pm#, Pz#, Px#) exposed by the chosen target.
+ * Predicated ops (cmd**P**, cmd**4**) are only available if RT_PRED != 0,
+ * which is set by rtarch_***_***x*vP.h extensions to AVX-512 and ARM-SVE,
+ * along with var-len loop control (cntox_rx, incox_rx) for such targets.
+ */
+#ifndef RT_PRED
+#define RT_PRED 0
+#endif /* RT_PRED */
+
 #endif /* RT_RTARCH_H */
 
 /******************************************************************************/
@@ -1521,6 +1521,23 @@
         andwx_ri(Resi, IV(0x5515174F)) /* NEON: 0,1,2,3,6,8,9; SVE: rest */ \
         movwx_st(Resi, Mebp, inf_VER)
 
+/* tsc (D = timestamp counter, lower 32-bit)
+ * set-flags: no
+ * reads CNTVCT_EL0 (generic timer), upper half is cleared */
+
+#define tscwx_rx(RD)                                                        \
+        EMITW(0xD53BE040 | MRM(REG(RD), 0x00,    0x00))                     \
+        EMITW(0x2A000000 | MRM(REG(RD), TZxx,    REG(RD)))
+
+/* fps (D = fp status flags), clears sticky flags in FPSR
+ * set-flags: no
+ * flags are FPSR bits [7] (IDC) and [4:0] (IXC UFC OFC DZC IOC) */
+
+#define fpswx_rx(RD)                                                        \
+        EMITW(0xD53B4420 | MRM(REG(RD), 0x00,    0x00))                     \
+        EMITW(0xD51B4420 | MRM(TZxx,    0x00,    0x00))                     \
+        andwx_ri(W(RD), IH(0x9F))
+
 /************************* address-sized instructions *************************/
 
 /* adr (D = adr S)
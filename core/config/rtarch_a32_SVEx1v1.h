@@ -753,6 +753,38 @@
         addwxZri(Reax, IB(RT_SIMD_MASK_##mask##32_SVE))                     \
         jezxx_lb(lb)
 
+/* cps (D = active lanes of S), RD = count, active lanes of mask XM are
+ * packed via COMPACT and stored under WHILELO predicate of RD elements,
+ * overrides generic version from rtbase.h, xpdpx_ld is left generic
+ * (SVE has no expand instruction) */
+
+#if (RT_ELEMENT == 32)
+
+#undef  cpspx_st
+#define cpspx_st(XS, XM, RD, MD, DD, lb) /* destroys Reax, RD = count */    \
+        movxx_ri(Reax, IB(0))                                               \
+        adrxx_ld(Reax, W(MD), W(DD))                                        \
+        EMITW(0x2480A000 | MXM(0x01,    REG(XM), TmmQ))                     \
+        EMITW(0x05A18400 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x25A08000 | MXM(TMxx,    0x01,    0x00))                     \
+        EMITW(0x25A01C01 | MXM(0x01,    TZxx,    TMxx))                     \
+        EMITW(0xE540E400 | MXM(TmmM,    Teax,    0x00))                     \
+        EMITW(0xAA000000 | MXM(REG(RD), TZxx,    TMxx))
+
+#endif /* RT_ELEMENT == 32 */
+
+/* mkc (D = active-lane count of mask S) via CNTP, overrides generic version
+ * from rtbase.h, mkmpx_rx is left generic (no predicate-to-bitmask move) */
+
+#if (RT_ELEMENT == 32)
+
+#undef  mkcpx_rx
+#define mkcpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane count */       \
+        EMITW(0x2480A000 | MXM(0x01,    REG(XS), TmmQ))                     \
+        EMITW(0x25A08000 | MXM(REG(RD), 0x01,    0x00))
+
+#endif /* RT_ELEMENT == 32 */
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
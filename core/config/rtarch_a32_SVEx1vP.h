@@ -0,0 +1,518 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTARCH_A32_SVEX1VP_H
+#define RT_RTARCH_A32_SVEX1VP_H
+
+#define RT_PRED                 6
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtarch_a32_SVEx1vP.h: Implementation of AArch64 fp32 SVE predicated ops.
+ *
+ * This file is a part of the unified SIMD assembler framework (rtarch.h)
+ * designed to be compatible with different processor architectures,
+ * while maintaining strictly defined common API.
+ *
+ * Recommended naming scheme for instructions:
+ *
+ * cmdo*Prr - applies [cmd] to var-len packed: [r]egister from [r]egister
+ * cmdo*Pld - applies [cmd] to var-len packed: [r]egister from memory
+ *            under predicate placed right after destination SIMD register
+ *
+ * cmdo*4rr - applies [cmd] to var-len packed: [r]egister from [r]egister
+ * cmdo*4ld - applies [cmd] to var-len packed: [r]egister from memory
+ *            three-operand form, predicate is placed right after XD
+ *
+ * Compare instructions write their result into a predicate placed 1st,
+ * while their 4-form combines the result with governing predicate (PG).
+ * Predicate registers are exposed as triplets similar to SIMD registers:
+ *
+ * Pm1..Pm6 - merging predicates, inactive elements keep destination values
+ * Pz1..Pz6 - zeroing predicates, inactive elements of destination are zeroed
+ * Px1..Px6 - plain predicates where merging/zeroing is not applicable
+ *
+ * Pm#, Pz#, Px# with the same number refer to the same physical predicate,
+ * on ARM-SVE they are mapped onto predicates p2..p7 (p0, p1 are internal).
+ * Zeroing in 2-operand ops is emulated with MOVPRFX selected via SIB field
+ * requiring (#G != #S), while 4-operand ops are always prefixed with MOVPRFX
+ * requiring (#D != #T), which also applies to AVX-512 for portable code.
+ *
+ * Loops over arrays of arbitrary length can be written without dependency
+ * on SIMD width: whloxPrr generates the predicate for remaining elements,
+ * while cntox_rx/incox_rx use actual number of 32-bit elements in register,
+ * which on ARM-SVE is read at runtime (CNTW/INCW) rather than from RT_SIMD,
+ * mkjoxPrx also checks FULL against the runtime count (DECW after CNTP).
+ * Predicated loads/stores (movoxPld/movoxPst) don't access memory in
+ * inactive elements, thus loop tails can be processed within array bounds.
+ * DP/DF/DG displacements still assume RT_SIMD-wide registers (structures),
+ * use BASE+index addressing (I***) with DP(0) for length-agnostic loops.
+ *
+ * Interpretation of instruction parameters:
+ *
+ * upper-case params have triplet structure and require W to pass-forward
+ * lower-case params are singular and can be used/passed as such directly
+ *
+ * XD - SIMD register serving as destination only, if present
+ * XG - SIMD register serving as destination and first source
+ * XS - SIMD register serving as second source (first if any)
+ * XT - SIMD register serving as third source (second if any)
+ *
+ * PD - predicate serving as destination only (in compare instructions)
+ * PG - predicate governing the operation (inactive elements merge/zero)
+ * PS - predicate serving as source (in mask-jump instructions)
+ *
+ * RD - BASE register serving as destination only (in loop control)
+ * RG - BASE register serving as destination and source (in loop control)
+ * RS - BASE register serving as first source (in loop control)
+ * RT - BASE register serving as second source (in loop control)
+ *
+ * MD - BASE addressing mode (Oeax, M***, I***) (memory-dest)
+ * MG - BASE addressing mode (Oeax, M***, I***) (memory-dsrc)
+ * MS - BASE addressing mode (Oeax, M***, I***) (memory-src2)
+ * MT - BASE addressing mode (Oeax, M***, I***) (memory-src3)
+ *
+ * DD - displacement value (DP, DF, DG, DH, DV) (memory-dest)
+ * DG - displacement value (DP, DF, DG, DH, DV) (memory-dsrc)
+ * DS - displacement value (DP, DF, DG, DH, DV) (memory-src2)
+ * DT - displacement value (DP, DF, DG, DH, DV) (memory-src3)
+ */
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#if (defined RT_SIMD_CODE)
+
+#if (RT_SVEX1 != 0)
+
+/* selectors  */
+
+#define MPX(xg, pg)  /* merging predicates don't need destination prefix */
+
+#define ZPX(xg, pg)                                                         \
+        EMITW(0x04902000 | MXM(xg, xg, 0x00) | (pg) << 10)
+
+/******************************************************************************/
+/********************************   EXTERNAL   ********************************/
+/******************************************************************************/
+
+/* predicates   REG,  MOD,  SIB */
+
+#define Pm1     0x02, 0x01, MPX         /* p2, merging */
+#define Pm2     0x03, 0x01, MPX         /* p3, merging */
+#define Pm3     0x04, 0x01, MPX         /* p4, merging */
+#define Pm4     0x05, 0x01, MPX         /* p5, merging */
+#define Pm5     0x06, 0x01, MPX         /* p6, merging */
+#define Pm6     0x07, 0x01, MPX         /* p7, merging */
+
+#define Pz1     0x02, 0x00, ZPX         /* p2, zeroing */
+#define Pz2     0x03, 0x00, ZPX         /* p3, zeroing */
+#define Pz3     0x04, 0x00, ZPX         /* p4, zeroing */
+#define Pz4     0x05, 0x00, ZPX         /* p5, zeroing */
+#define Pz5     0x06, 0x00, ZPX         /* p6, zeroing */
+#define Pz6     0x07, 0x00, ZPX         /* p7, zeroing */
+
+#define Px1     0x02, 0x01, MPX         /* p2 */
+#define Px2     0x03, 0x01, MPX         /* p3 */
+#define Px3     0x04, 0x01, MPX         /* p4 */
+#define Px4     0x05, 0x01, MPX         /* p5 */
+#define Px5     0x06, 0x01, MPX         /* p6 */
+#define Px6     0x07, 0x01, MPX         /* p7 */
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/*****************   packed single-precision predicated move   ****************/
+
+/* mov (G = S) under predicate */
+
+#define movoxPrr(XG, PG, XS)                                                \
+        EMITW(0x04902000 | MXM(REG(XG), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x04438000 | MXM(REG(XG), 0x00,    0x00) | REG(PG) << 10)
+
+#define movoxPld(XG, PG, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0xA540A000 | MXM(TmmM,    TPxx,    0x00) | REG(PG) << 10)     \
+        EMITW(0x04902000 | MXM(REG(XG), TmmM,    0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x04438000 | MXM(REG(XG), 0x00,    0x00) | REG(PG) << 10)
+
+/* mov (D = S) under predicate, inactive elements of memory are not written */
+
+#define movoxPst(XS, PS, MD, DD)                                            \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0xE540E000 | MXM(REG(XS), TPxx,    0x00) | REG(PS) << 10)
+
+/**************   packed single-precision predicated arithmetic   *************/
+
+/* add (G = G + S), (D = S + T) if (#D != #T) */
+
+#define addosPrr(XG, PG, XS)                                                \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x65808000 | MXM(REG(XG), REG(XS), 0x00) | REG(PG) << 10)
+
+#define addosPld(XG, PG, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x65808000 | MXM(REG(XG), TmmM,    0x00) | REG(PG) << 10)
+
+#define addos4rr(XD, PG, XS, XT)                                            \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x65808000 | MXM(REG(XD), REG(XT), 0x00) | REG(PG) << 10)
+
+#define addos4ld(XD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x65808000 | MXM(REG(XD), TmmM,    0x00) | REG(PG) << 10)
+
+/* sub (G = G - S), (D = S - T) if (#D != #T) */
+
+#define subosPrr(XG, PG, XS)                                                \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x65818000 | MXM(REG(XG), REG(XS), 0x00) | REG(PG) << 10)
+
+#define subosPld(XG, PG, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x65818000 | MXM(REG(XG), TmmM,    0x00) | REG(PG) << 10)
+
+#define subos4rr(XD, PG, XS, XT)                                            \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x65818000 | MXM(REG(XD), REG(XT), 0x00) | REG(PG) << 10)
+
+#define subos4ld(XD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x65818000 | MXM(REG(XD), TmmM,    0x00) | REG(PG) << 10)
+
+/* mul (G = G * S), (D = S * T) if (#D != #T) */
+
+#define mulosPrr(XG, PG, XS)                                                \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x65828000 | MXM(REG(XG), REG(XS), 0x00) | REG(PG) << 10)
+
+#define mulosPld(XG, PG, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x65828000 | MXM(REG(XG), TmmM,    0x00) | REG(PG) << 10)
+
+#define mulos4rr(XD, PG, XS, XT)                                            \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x65828000 | MXM(REG(XD), REG(XT), 0x00) | REG(PG) << 10)
+
+#define mulos4ld(XD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x65828000 | MXM(REG(XD), TmmM,    0x00) | REG(PG) << 10)
+
+/* div (G = G / S), (D = S / T) if (#D != #T) */
+
+#define divosPrr(XG, PG, XS)                                                \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x658D8000 | MXM(REG(XG), REG(XS), 0x00) | REG(PG) << 10)
+
+#define divosPld(XG, PG, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x658D8000 | MXM(REG(XG), TmmM,    0x00) | REG(PG) << 10)
+
+#define divos4rr(XD, PG, XS, XT)                                            \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x658D8000 | MXM(REG(XD), REG(XT), 0x00) | REG(PG) << 10)
+
+#define divos4ld(XD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x658D8000 | MXM(REG(XD), TmmM,    0x00) | REG(PG) << 10)
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minosPrr(XG, PG, XS)                                                \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x65878000 | MXM(REG(XG), REG(XS), 0x00) | REG(PG) << 10)
+
+#define minosPld(XG, PG, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x65878000 | MXM(REG(XG), TmmM,    0x00) | REG(PG) << 10)
+
+#define minos4rr(XD, PG, XS, XT)                                            \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x65878000 | MXM(REG(XD), REG(XT), 0x00) | REG(PG) << 10)
+
+#define minos4ld(XD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x65878000 | MXM(REG(XD), TmmM,    0x00) | REG(PG) << 10)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxosPrr(XG, PG, XS)                                                \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x65868000 | MXM(REG(XG), REG(XS), 0x00) | REG(PG) << 10)
+
+#define maxosPld(XG, PG, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x65868000 | MXM(REG(XG), TmmM,    0x00) | REG(PG) << 10)
+
+#define maxos4rr(XD, PG, XS, XT)                                            \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x65868000 | MXM(REG(XD), REG(XT), 0x00) | REG(PG) << 10)
+
+#define maxos4ld(XD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x65868000 | MXM(REG(XD), TmmM,    0x00) | REG(PG) << 10)
+
+/***************   packed single-precision predicated compare   ***************/
+
+/* ceq (P = S == T), (P = PG & (S == T)) */
+
+#define ceqosPrr(PD, XS, XT)                                                \
+        EMITW(0x65806000 | MXM(REG(PD), REG(XS), REG(XT)))
+
+#define ceqosPld(PD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65806000 | MXM(REG(PD), REG(XS), TmmM))
+
+#define ceqos4rr(PD, PG, XS, XT)                                            \
+        EMITW(0x65806000 | MXM(REG(PD), REG(XS), REG(XT)) |                 \
+                          REG(PG) << 10)
+
+#define ceqos4ld(PD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65806000 | MXM(REG(PD), REG(XS), TmmM) |                    \
+                          REG(PG) << 10)
+
+/* cne (P = S != T), (P = PG & (S != T)) */
+
+#define cneosPrr(PD, XS, XT)                                                \
+        EMITW(0x65806010 | MXM(REG(PD), REG(XS), REG(XT)))
+
+#define cneosPld(PD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65806010 | MXM(REG(PD), REG(XS), TmmM))
+
+#define cneos4rr(PD, PG, XS, XT)                                            \
+        EMITW(0x65806010 | MXM(REG(PD), REG(XS), REG(XT)) |                 \
+                          REG(PG) << 10)
+
+#define cneos4ld(PD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65806010 | MXM(REG(PD), REG(XS), TmmM) |                    \
+                          REG(PG) << 10)
+
+/* clt (P = S < T), (P = PG & (S < T)) */
+
+#define cltosPrr(PD, XS, XT)                                                \
+        EMITW(0x65804010 | MXM(REG(PD), REG(XT), REG(XS)))
+
+#define cltosPld(PD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65804010 | MXM(REG(PD), TmmM,    REG(XS)))
+
+#define cltos4rr(PD, PG, XS, XT)                                            \
+        EMITW(0x65804010 | MXM(REG(PD), REG(XT), REG(XS)) |                 \
+                          REG(PG) << 10)
+
+#define cltos4ld(PD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65804010 | MXM(REG(PD), TmmM,    REG(XS)) |                 \
+                          REG(PG) << 10)
+
+/* cle (P = S <= T), (P = PG & (S <= T)) */
+
+#define cleosPrr(PD, XS, XT)                                                \
+        EMITW(0x65804000 | MXM(REG(PD), REG(XT), REG(XS)))
+
+#define cleosPld(PD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65804000 | MXM(REG(PD), TmmM,    REG(XS)))
+
+#define cleos4rr(PD, PG, XS, XT)                                            \
+        EMITW(0x65804000 | MXM(REG(PD), REG(XT), REG(XS)) |                 \
+                          REG(PG) << 10)
+
+#define cleos4ld(PD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65804000 | MXM(REG(PD), TmmM,    REG(XS)) |                 \
+                          REG(PG) << 10)
+
+/* cgt (P = S > T), (P = PG & (S > T)) */
+
+#define cgtosPrr(PD, XS, XT)                                                \
+        EMITW(0x65804010 | MXM(REG(PD), REG(XS), REG(XT)))
+
+#define cgtosPld(PD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65804010 | MXM(REG(PD), REG(XS), TmmM))
+
+#define cgtos4rr(PD, PG, XS, XT)                                            \
+        EMITW(0x65804010 | MXM(REG(PD), REG(XS), REG(XT)) |                 \
+                          REG(PG) << 10)
+
+#define cgtos4ld(PD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65804010 | MXM(REG(PD), REG(XS), TmmM) |                    \
+                          REG(PG) << 10)
+
+/* cge (P = S >= T), (P = PG & (S >= T)) */
+
+#define cgeosPrr(PD, XS, XT)                                                \
+        EMITW(0x65804000 | MXM(REG(PD), REG(XS), REG(XT)))
+
+#define cgeosPld(PD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65804000 | MXM(REG(PD), REG(XS), TmmM))
+
+#define cgeos4rr(PD, PG, XS, XT)                                            \
+        EMITW(0x65804000 | MXM(REG(PD), REG(XS), REG(XT)) |                 \
+                          REG(PG) << 10)
+
+#define cgeos4ld(PD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x65804000 | MXM(REG(PD), REG(XS), TmmM) |                    \
+                          REG(PG) << 10)
+
+/* mkj (jump to lb) if (S satisfies mask condition) */
+
+#define RT_SIMD_MASK_NONE32_SVP(RD)   /* none satisfy the condition */      \
+        EMPTY
+
+#define RT_SIMD_MASK_FULL32_SVP(RD)   /* all satisfy, DECW: runtime VL */   \
+        EMITW(0x04B0E7E0 | MXM(REG(RD), 0x00,    0x00))
+
+#define mkjoxPrx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+        EMITW(0x25A08000 | MXM(Teax,    REG(PS), 0x00))                     \
+        RT_SIMD_MASK_##mask##32_SVP(Reax)                                   \
+        cmpwx_ri(Reax, IB(0))                                               \
+        jeqxx_lb(lb)
+
+/***************   packed single-precision var-len loop control   *************/
+
+/* cnt (D = number of 32-bit elements in var-len SIMD register) */
+
+#define cntox_rx(RD)                                                        \
+        EMITW(0x04A0E3E0 | MXM(REG(RD), 0x00,    0x00))
+
+/* inc (G = G + number of 32-bit elements in var-len SIMD register) */
+
+#define incox_rx(RG)                                                        \
+        EMITW(0x04B0E3E0 | MXM(REG(RG), 0x00,    0x00))
+
+/* whl (P = elements (i) for which (S + i < T)), signed 32-bit counters */
+
+#define whloxPrr(PD, RS, RT)   /* destroys Reax (on other targets) */       \
+        EMITW(0x25A00400 | MXM(REG(PD), REG(RS), REG(RT)))
+
+/**********   packed single-precision predicated integer arithmetic   *********/
+
+/* add (G = G + S), (D = S + T) if (#D != #T) */
+
+#define addoxPrr(XG, PG, XS)                                                \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x04800000 | MXM(REG(XG), REG(XS), 0x00) | REG(PG) << 10)
+
+#define addoxPld(XG, PG, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x04800000 | MXM(REG(XG), TmmM,    0x00) | REG(PG) << 10)
+
+#define addox4rr(XD, PG, XS, XT)                                            \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x04800000 | MXM(REG(XD), REG(XT), 0x00) | REG(PG) << 10)
+
+#define addox4ld(XD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x04800000 | MXM(REG(XD), TmmM,    0x00) | REG(PG) << 10)
+
+/* sub (G = G - S), (D = S - T) if (#D != #T) */
+
+#define suboxPrr(XG, PG, XS)                                                \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x04810000 | MXM(REG(XG), REG(XS), 0x00) | REG(PG) << 10)
+
+#define suboxPld(XG, PG, MS, DS)                                            \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        SIB(PG)(REG(XG), REG(PG))                                           \
+        EMITW(0x04810000 | MXM(REG(XG), TmmM,    0x00) | REG(PG) << 10)
+
+#define subox4rr(XD, PG, XS, XT)                                            \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x04810000 | MXM(REG(XD), REG(XT), 0x00) | REG(PG) << 10)
+
+#define subox4ld(XD, PG, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04902000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                          MOD(PG) << 16 | REG(PG) << 10)                    \
+        EMITW(0x04810000 | MXM(REG(XD), TmmM,    0x00) | REG(PG) << 10)
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#endif /* RT_SVEX1 */
+
+#endif /* RT_SIMD_CODE */
+
+#endif /* RT_RTARCH_A32_SVEX1VP_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -1575,6 +1575,23 @@
 #define verxx_xx() /* destroys Reax, Recx, Rebx, Redx, Resi, Redi */        \
         movwx_mi(Mebp, inf_VER, IB(0xF)) /* <- NEON to bits: 0,1,2,3 */
 
+/* tsc (D = timestamp counter, lower 32-bit)
+ * set-flags: no
+ * reads CNTVCT via mrrc (needs ARMv7 generic timer), destroys TMxx */
+
+#define tscwx_rx(RD)                                                        \
+        EMITW(0xEC500F1E | MRM(REG(RD), TMxx,    0x00))
+
+/* fps (D = fp status flags), clears sticky flags in FPSCR
+ * set-flags: no
+ * flags are FPSCR bits [7] (IDC) and [4:0] (IXC UFC OFC DZC IOC), uses TIxx */
+
+#define fpswx_rx(RD)                                                        \
+        EMITW(0xEEF10A10 | MRM(REG(RD), 0x00,    0x00))                     \
+        EMITW(0xE3C0009F | MRM(TIxx,    REG(RD), 0x00))                     \
+        EMITW(0xEEE10A10 | MRM(TIxx,    0x00,    0x00))                     \
+        EMITW(0xE200009F | MRM(REG(RD), REG(RD), 0x00))
+
 /************************* address-sized instructions *************************/
 
 /* adr (D = adr S)
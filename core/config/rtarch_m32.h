@@ -1668,6 +1668,24 @@
 #define verxx_xx() /* destroys Reax, Recx, Rebx, Redx, Resi, Redi */        \
         movwx_mi(Mebp, inf_VER, IM(0x34F)) /* <- MSA to bits: 0,1,2,3,6,8,9 */
 
+/* tsc (D = timestamp counter, lower 32-bit)
+ * set-flags: no
+ * reads CC via rdhwr $2 (counts at CCRes-scaled pipeline clock) */
+
+#define tscwx_rx(RD)                                                        \
+        EMITW(0x7C00103B | MRM(0x00,    0x00,    REG(RD)))
+
+/* fps (D = fp status flags), clears sticky flags in MSACSR
+ * set-flags: no
+ * flags are MSACSR bits [6:2] (V Z O U I), uses TIxx */
+
+#define fpswx_rx(RD)                                                        \
+        EMITW(0x787E0819 | REG(RD) << 6)                                    \
+        EMITW(0x3000007C | MRM(0x00,    REG(RD), TIxx))                     \
+        EMITW(0x00000026 | MRM(TIxx,    REG(RD), TIxx))                     \
+        EMITW(0x783E0059 | TIxx << 11)                                      \
+        EMITW(0x3000007C | MRM(0x00,    REG(RD), REG(RD)))
+
 /************************* address-sized instructions *************************/
 
 /* adr (D = adr S)
@@ -417,6 +417,20 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
         EMITW(0x78A0000D | MXM(REG(XD), REG(XS), TmmM))
 
+/***************   packed half-precision integer dot-products   ***************/
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed */
+
+#undef  dphin_rr
+#define dphin_rr(XG, XS, XT)                                                \
+        EMITW(0x79400013 | MXM(REG(XG), REG(XS), REG(XT)))
+
+#undef  dphin_ld
+#define dphin_ld(XG, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
+        EMITW(0x79400013 | MXM(REG(XG), REG(XS), TmmM))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
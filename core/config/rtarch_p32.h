@@ -1767,6 +1767,28 @@
 #define verxx_xx() /* destroys Reax, Recx, Rebx, Redx, Resi, Redi */        \
         movwx_mi(Mebp, inf_VER, IV(0x033F4F)) /* <- VSX1+2/3/VMX: 128,256,512 */
 
+/* tsc (D = timestamp counter, lower 32-bit)
+ * set-flags: no
+ * reads TBL via mftb (timebase), upper half is cleared on 64-bit */
+
+#define tscwx_rx(RD)                                                        \
+        EMITW(0x7C0C42A6 | MTM(REG(RD), 0x00,    0x00))                     \
+        EMITW(0x5400003E | MSM(REG(RD), REG(RD), 0x00))
+
+/* fps (D = fp status flags), clears sticky flags in FPSCR
+ * set-flags: undefined
+ * flags are FPSCR bits [0:7] (FX FEX VX OX UX ZX XX VXSNAN) in D bits [7:0],
+ * only VSX targets update FPSCR from SIMD ops, destroys cr0, cr1 */
+
+#define fpswx_rx(RD)                                                        \
+        EMITW(0xFC000080)                 /* <- mcrfs cr0, fpscr0 */        \
+        EMITW(0xFC840080)                 /* <- mcrfs cr1, fpscr1 */        \
+        EMITW(0xFD00010C)                 /* <- mtfsfi fpscr2, 0 */         \
+        EMITW(0xFE80010C)                 /* <- mtfsfi fpscr5, 0 */         \
+        EMITW(0xFD80008C)                 /* <- mtfsb0 VXVC */              \
+        EMITW(0x7C000026 | MTM(REG(RD), 0x00,    0x00))                     \
+        EMITW(0x5400463E | MSM(REG(RD), REG(RD), 0x00))
+
 /************************* address-sized instructions *************************/
 
 /* adr (D = adr S)
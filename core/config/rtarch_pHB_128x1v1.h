@@ -459,6 +459,34 @@
         EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
         EMITW(0x10000344 | MXM(REG(XD), REG(XS), TmmM))
 
+/***************   packed half-precision integer dot-products   ***************/
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed */
+
+#undef  dphin_rr
+#define dphin_rr(XG, XS, XT)                                                \
+        EMITW(0x10000028 | MXM(REG(XG), REG(XS), REG(XT)) | REG(XG) << 6)
+
+#undef  dphin_ld
+#define dphin_ld(XG, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000028 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 6)
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, unsigned */
+
+#undef  dpbix_rr
+#define dpbix_rr(XG, XS, XT)                                                \
+        EMITW(0x10000024 | MXM(REG(XG), REG(XS), REG(XT)) | REG(XG) << 6)
+
+#undef  dpbix_ld
+#define dpbix_ld(XG, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000024 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 6)
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -246,6 +246,13 @@
         EMITB(0x84 | (15-((ren)&15))<<3 | (pfx))                            \
         EMITB(0x10 | (16-((ren)&16))>>1 | (erm) << 5)
 
+/* 4-byte EVEX prefix with full customization (W0, predicate-reg, Z-bit) */
+#define EPX(rxg, rxm, ren, len, pfx, aux, prd)                              \
+        EMITB(0x62)                                                         \
+        EMITB(0x00 | (1-((rxg)&1))<<7|(2-((rxg)&2))<<3|(3-(rxm))<<5|(aux))  \
+        EMITB(0x04 | (15-((ren)&15))<<3 | (pfx))                            \
+        EMITB((prd) | (16-((ren)&16))>>1 | (len) << 5)
+
 /* selectors  */
 
 #define RXB(reg, mod, sib)  ((reg) >> 3 & 0x03) /* full-reg-extension-bit */
@@ -258,6 +265,7 @@
 #define REM(reg, mod, sib)  (((reg) & 0x0F)+16) /* 2nd 16-reg-bank 5-bits */
 #define MOD(reg, mod, sib)  mod
 #define SIB(reg, mod, sib)  sib
+#define PRD(reg, mod, sib)  ((reg) | (mod))     /* predicate-reg, Z-bit */
 
 #define VAL(val, typ, cmd)  val
 #define VYL(val, typ, cmd)  ((val) | 0x10)
@@ -1602,6 +1610,10 @@
         andwx_ri(Recx, IV(0x00003000))  /* <- AVX1/2 to bit12, bit13 */     \
         orrwx_rr(Resi, Recx)                                                \
         movwx_rr(Recx, Resi)                                                \
+        shlwx_ri(Recx, IB(3 - RT_SIMD_COMPAT_256))                          \
+        andwx_ri(Recx, IV(0x00000400))  /* <- AVX1/2 to bit10 */            \
+        orrwx_rr(Resi, Recx)                                                \
+        movwx_rr(Recx, Resi)                                                \
         shlwx_ri(Recx, IB(2))                                               \
         andwx_ri(Recx, IV(0x000C0000))  /* <- AVX512 to bit18, bit19 */     \
         orrwx_rr(Resi, Recx)                                                \
@@ -1629,6 +1641,39 @@
         orrwx_rr(Resi, Recx)                                                \
         movwx_st(Resi, Mebp, inf_VER)
 
+/* tsc (D = timestamp counter, lower 32-bit)
+ * set-flags: no
+ * reads RDTSC (constant-rate TSC), preserves Reax/Redx via stack */
+
+#define tscwx_rx(RD)                                                        \
+        EMITB(0x50) EMITB(0x52)           /* <- push rax, push rdx */       \
+        EMITB(0x0F) EMITB(0x31)           /* <- rdtsc to edx:eax */         \
+        EMITB(0x48) EMITB(0x87)           /* <- xchg rax, [rsp+8] */        \
+        MRM(0x00,    0x01,    0x04) EMITB(0x24) EMITB(0x08)                 \
+        EMITB(0x5A)                       /* <- pop rdx */                  \
+        stack_ld(W(RD))                   /* <- pop RD (stamp) */
+
+/* fps (D = fp status flags), clears sticky flags in MXCSR
+ * set-flags: undefined
+ * uses inf_SCR02(0) as scratch, flags are MXCSR bits [5:0] (PE UE OE ZE DE IE) */
+
+#define fpswx_rx(RD)                                                        \
+        fpswx_st(Mebp,  inf_SCR02(0))                                       \
+        movwx_ld(W(RD), Mebp,  inf_SCR02(0))                                \
+        andwx_mi(Mebp,  inf_SCR02(0), IV(0xFFFFFFC0))                       \
+        fpswx_ld(Mebp,  inf_SCR02(0))                                       \
+        andwx_ri(W(RD), IB(0x3F))
+
+#define fpswx_ld(MS, DS) /* not portable, do not use outside */             \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0xAE)                       \
+        MRM(0x02,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define fpswx_st(MD, DD) /* not portable, do not use outside */             \
+    ADR REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0xAE)                       \
+        MRM(0x03,    MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /************************* address-sized instructions *************************/
 
 /* adr (D = adr S)
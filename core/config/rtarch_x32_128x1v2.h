@@ -686,6 +686,28 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_128))                     \
         jeqxx_lb(lb)
 
+/* mkm (D = lane bitmask of mask S), mkc (D = active-lane count of mask S)
+ * mask S is moved to k1, overrides generic versions from rtbase.h */
+
+#define pc1wx_rr(RD, RS)     /* not portable, do not use outside */         \
+        EMITB(0xF3) REX(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xB8)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#if (RT_SIMD == 128) && (RT_ELEMENT == 32)
+
+#undef  mkmpx_rx
+#define mkmpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane bits */        \
+        ck1ix_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(W(RD))
+
+#undef  mkcpx_rx
+#define mkcpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane count */       \
+        ck1ix_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(Reax)                                                      \
+        pc1wx_rr(W(RD), Reax)
+
+#endif /* RT_SIMD == 128, RT_ELEMENT == 32 */
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
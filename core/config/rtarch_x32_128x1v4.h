@@ -847,6 +847,18 @@ ADR xF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_128))                     \
         jeqxx_lb(lb)
 
+/* mkm (D = lane bitmask of mask S) is moved via movmsk, overrides generic
+ * version from rtbase.h, mkcpx_rx is left generic (no popcnt before SSE4.2) */
+
+#if (RT_SIMD == 128) && (RT_ELEMENT == 32)
+
+#undef  mkmpx_rx
+#define mkmpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane bits */        \
+        REX(RXB(RD), RXB(XS)) EMITB(0x0F) EMITB(0x50)                       \
+        MRM(REG(RD), MOD(XS), REG(XS))
+
+#endif /* RT_SIMD == 128, RT_ELEMENT == 32 */
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -743,6 +743,28 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_128))                     \
         jeqxx_lb(lb)
 
+/* mkm (D = lane bitmask of mask S), mkc (D = active-lane count of mask S)
+ * mask S is moved via vmovmsk, overrides generic versions from rtbase.h */
+
+#define pc1wx_rr(RD, RS)     /* not portable, do not use outside */         \
+        EMITB(0xF3) REX(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xB8)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#if (RT_SIMD == 128) && (RT_ELEMENT == 32)
+
+#undef  mkmpx_rx
+#define mkmpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane bits */        \
+        VEX(RXB(RD), RXB(XS),    0x00, 0, 0, 1) EMITB(0x50)                 \
+        MRM(REG(RD), MOD(XS), REG(XS))
+
+#undef  mkcpx_rx
+#define mkcpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane count */       \
+        VEX(0,       RXB(XS),    0x00, 0, 0, 1) EMITB(0x50)                 \
+        MRM(0x00,    MOD(XS), REG(XS))                                      \
+        pc1wx_rr(W(RD), Reax)
+
+#endif /* RT_SIMD == 128, RT_ELEMENT == 32 */
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
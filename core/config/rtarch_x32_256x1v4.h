@@ -0,0 +1,1447 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTARCH_X32_256X1V4_H
+#define RT_RTARCH_X32_256X1V4_H
+
+#include "rtarch_x64.h"
+
+#define RT_SIMD_REGS_256        32
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtarch_x32_256x1v4.h: Implementation of x86_64 fp32 AVX1/2 30-regs emulation.
+ *
+ * This file is a part of the unified SIMD assembler framework (rtarch.h)
+ * designed to be compatible with different processor architectures,
+ * while maintaining strictly defined common API.
+ *
+ * Recommended naming scheme for instructions:
+ *
+ * cmdp*_ri - applies [cmd] to [p]acked: [r]egister from [i]mmediate
+ * cmdp*_rr - applies [cmd] to [p]acked: [r]egister from [r]egister
+ *
+ * cmdp*_rm - applies [cmd] to [p]acked: [r]egister from [m]emory
+ * cmdp*_ld - applies [cmd] to [p]acked: as above
+ *
+ * cmdi*_** - applies [cmd] to 32-bit SIMD element args, packed-128-bit
+ * cmdj*_** - applies [cmd] to 64-bit SIMD element args, packed-128-bit
+ * cmdl*_** - applies [cmd] to L-size SIMD element args, packed-128-bit
+ *
+ * cmdc*_** - applies [cmd] to 32-bit SIMD element args, packed-256-bit
+ * cmdd*_** - applies [cmd] to 64-bit SIMD element args, packed-256-bit
+ * cmdf*_** - applies [cmd] to L-size SIMD element args, packed-256-bit
+ *
+ * cmdo*_** - applies [cmd] to 32-bit SIMD element args, packed-var-len
+ * cmdp*_** - applies [cmd] to L-size SIMD element args, packed-var-len
+ * cmdq*_** - applies [cmd] to 64-bit SIMD element args, packed-var-len
+ *
+ * cmd*x_** - applies [cmd] to [p]acked unsigned integer args, [x] - default
+ * cmd*n_** - applies [cmd] to [p]acked   signed integer args, [n] - negatable
+ * cmd*s_** - applies [cmd] to [p]acked floating point   args, [s] - scalable
+ *
+ * The cmdp*_** (rtconf.h) instructions are intended for SPMD programming model
+ * and can be configured to work with 32/64-bit data elements (fp+int).
+ * In this model data paths are fixed-width, BASE and SIMD data elements are
+ * width-compatible, code path divergence is handled via mkj**_** pseudo-ops.
+ * Matching element-sized BASE subset cmdy*_** is defined in rtconf.h as well.
+ *
+ * Note, when using fixed-data-size 128/256-bit SIMD subsets simultaneously
+ * upper 128-bit halves of full 256-bit SIMD registers may end up undefined.
+ * On RISC targets they remain unchanged, while on x86-AVX they are zeroed.
+ * This happens when registers written in 128-bit subset are then used/read
+ * from within 256-bit subset. The same rule applies to mixing with 512-bit
+ * and wider vectors. Use of scalars may leave respective vector registers
+ * undefined, as seen from the perspective of any particular vector subset.
+ *
+ * 256-bit vectors used with wider subsets may not be compatible with regards
+ * to memory loads/stores when mixed in the code. It means that data loaded
+ * with wider vector and stored within 256-bit subset at the same address may
+ * result in changing the initial representation in memory. The same can be
+ * said about mixing vector and scalar subsets. Scalars can be completely
+ * detached on some architectures. Use elm*x_st to store 1st vector element.
+ * 128-bit vectors should be memory-compatible with any wider vector subset.
+ *
+ * Handling of NaNs in the floating point pipeline may not be consistent
+ * across different architectures. Avoid NaNs entering the data flow by using
+ * masking or control flow instructions. Apply special care when dealing with
+ * floating point compare and min/max input/output. The result of floating point
+ * compare instructions can be considered a -QNaN, though it is also interpreted
+ * as integer -1 and is often treated as a mask. Most arithmetic instructions
+ * should propagate QNaNs unchanged, however this behavior hasn't been verified.
+ *
+ * Register offloading: 30 SIMD registers (Xmm0 - XmmT) are exposed on top
+ * of 16 physical AVX registers. Xmm0 - XmmB are mapped to ymm0 - ymm11 as is,
+ * while XmmC - XmmT are kept in SIMD reg-file (rt_SIMD_REGS) and are loaded
+ * into temporary ymm12 - ymm15 before (stored back after) each instruction
+ * from var-len subsets (cmdm*, cmdo*, cmdp*, cmdq*) which references them.
+ * The split is a fixed bottom-up partition by register name, it is not
+ * based on usage: no liveness or frequency analysis is done, so allocate
+ * most-used registers from the bottom (Xmm0 first), as the code which stays
+ * within Xmm0 - XmmB runs at the speed of native 16-regs target.
+ * Fixed-data-size (cmdc*, cmdd*, cmdi*, ...) and scalar (cmdr*, cmds*, ...)
+ * subsets operate on native registers only (Xmm0 - XmmB) on this target.
+ * Passing XmmC - XmmT to them fails at compile time (assembler reports
+ * invalid operands for an undefined EmmC - EmmT symbol) instead of silently
+ * encoding temporary ymm12 - ymm15 or an out-of-range register number.
+ * BASE register r15 is used internally to address the SIMD reg-file.
+ *
+ * Interpretation of instruction parameters:
+ *
+ * upper-case params have triplet structure and require W to pass-forward
+ * lower-case params are singular and can be used/passed as such directly
+ *
+ * XD - SIMD register serving as destination only, if present
+ * XG - SIMD register serving as destination and first source
+ * XS - SIMD register serving as second source (first if any)
+ * XT - SIMD register serving as third source (second if any)
+ *
+ * RD - BASE register serving as destination only, if present
+ * RG - BASE register serving as destination and first source
+ * RS - BASE register serving as second source (first if any)
+ * RT - BASE register serving as third source (second if any)
+ *
+ * MD - BASE addressing mode (Oeax, M***, I***) (memory-dest)
+ * MG - BASE addressing mode (Oeax, M***, I***) (memory-dsrc)
+ * MS - BASE addressing mode (Oeax, M***, I***) (memory-src2)
+ * MT - BASE addressing mode (Oeax, M***, I***) (memory-src3)
+ *
+ * DD - displacement value (DP, DF, DG, DH, DV) (memory-dest)
+ * DG - displacement value (DP, DF, DG, DH, DV) (memory-dsrc)
+ * DS - displacement value (DP, DF, DG, DH, DV) (memory-src2)
+ * DT - displacement value (DP, DF, DG, DH, DV) (memory-src3)
+ *
+ * IS - immediate value (is used as a second or first source)
+ * IT - immediate value (is used as a third or second source)
+ */
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#if (defined RT_SIMD_CODE)
+
+#if (RT_256X1 == 4)
+
+#ifndef RT_RTARCH_X64_256X1V2_H
+#undef  RT_SIMD_REGS_256
+#undef  RT_256X1
+#define RT_256X1  RT_SIMD_COMPAT_256
+#include "rtarch_x64_256x1v2.h"
+#undef  RT_SIMD_REGS_256
+#define RT_SIMD_REGS_256        32
+#undef  RT_256X1
+#define RT_256X1  4
+#endif /* RT_RTARCH_X64_256X1V2_H */
+
+/* internal definitions for register offloading */
+
+#define TmmC    0x0C, 0x03, EMPTY  /* ymm12, temp-reg for 1st emulated arg */
+#define TmmD    0x0D, 0x03, EMPTY  /* ymm13, temp-reg for 2nd emulated arg */
+#define TmmE    0x0E, 0x03, EMPTY  /* ymm14, temp-reg for 3rd emulated arg */
+#define TmmF    0x0F, 0x03, EMPTY  /* ymm15, temp-reg for 4th emulated arg */
+
+#define TRxx    0x0F, 0x03, EMPTY  /* r15, SIMD reg-file address */
+#define TMxx    0x0F, 0x02, EMPTY  /* [r15 + DP], SIMD reg-file slot */
+
+/* register classes: native (NAT) in ymm0 - ymm11, emulated (EMU) in memory
+ * emulated register n occupies reg-file slot (n + 16) above sregs_sa,
+ * its REG field is symbolic (EmmC - EmmT), n is looked up via EMI_ table */
+
+#define EMX_0x00 NAT
+#define EMX_0x01 NAT
+#define EMX_0x02 NAT
+#define EMX_0x03 NAT
+#define EMX_0x04 NAT
+#define EMX_0x05 NAT
+#define EMX_0x06 NAT
+#define EMX_0x07 NAT
+#define EMX_0x08 NAT
+#define EMX_0x09 NAT
+#define EMX_0x0A NAT
+#define EMX_0x0B NAT
+#define EMX_EmmC EMU
+#define EMX_EmmD EMU
+#define EMX_EmmE EMU
+#define EMX_EmmF EMU
+#define EMX_EmmG EMU
+#define EMX_EmmH EMU
+#define EMX_EmmI EMU
+#define EMX_EmmJ EMU
+#define EMX_EmmK EMU
+#define EMX_EmmL EMU
+#define EMX_EmmM EMU
+#define EMX_EmmN EMU
+#define EMX_EmmO EMU
+#define EMX_EmmP EMU
+#define EMX_EmmQ EMU
+#define EMX_EmmR EMU
+#define EMX_EmmS EMU
+#define EMX_EmmT EMU
+
+#define EMI_EmmC 0x0C
+#define EMI_EmmD 0x0D
+#define EMI_EmmE 0x0E
+#define EMI_EmmF 0x0F
+#define EMI_EmmG 0x10
+#define EMI_EmmH 0x11
+#define EMI_EmmI 0x12
+#define EMI_EmmJ 0x13
+#define EMI_EmmK 0x14
+#define EMI_EmmL 0x15
+#define EMI_EmmM 0x16
+#define EMI_EmmN 0x17
+#define EMI_EmmO 0x18
+#define EMI_EmmP 0x19
+#define EMI_EmmQ 0x1A
+#define EMI_EmmR 0x1B
+#define EMI_EmmS 0x1C
+#define EMI_EmmT 0x1D
+
+#define EMN(reg, mod, sib)  reg
+#define EMI(reg, mod, sib)  EMC(EMI_, reg)
+#define EMC(a, b)           EMC_(a, b)
+#define EMC_(a, b)          a##b
+
+/* emr (select native XR or temp XT), eml/ems (load/store temp XT) */
+
+#define EMR(XR, XT) /* not portable, do not use outside */                  \
+        EMC(EMR_, EMC(EMX_, EMN(XR)))(W(XR), W(XT))
+
+#define EMR_NAT(XR, XT)     W(XR)
+#define EMR_EMU(XR, XT)     W(XT)
+
+#define EML(XR, XT) /* not portable, do not use outside */                  \
+        EMC(EML_, EMC(EMX_, EMN(XR)))(W(XR), W(XT))
+
+#define EML_NAT(XR, XT)
+
+#define EML_EMU(XR, XT) /* destroys r15 */                                  \
+        movxx_ld(TRxx, Mebp, inf_REGS)                                      \
+        movcx_ld(W(XT), TMxx, DP(0x20*(EMI(XR)+0x10)))
+
+#define EMS(XR, XT) /* not portable, do not use outside */                  \
+        EMC(EMS_, EMC(EMX_, EMN(XR)))(W(XR), W(XT))
+
+#define EMS_NAT(XR, XT)
+
+#define EMS_EMU(XR, XT) /* destroys r15 */                                  \
+        movxx_ld(TRxx, Mebp, inf_REGS)                                      \
+        movcx_st(W(XT), TMxx, DP(0x20*(EMI(XR)+0x10)))
+
+/******************************************************************************/
+/********************************   EXTERNAL   ********************************/
+/******************************************************************************/
+
+/* registers    REG,  MOD,  SIB */
+
+/* for var-len instructions only (stored in SIMD reg-file via offloading)
+ * XmmC - XmmF redefined from common baseline of 15 registers, XmmG - XmmT
+ * provided as an extension, all rejected by fixed-data-size/scalar subsets
+ * (previous definitions may come from rtarch_x32_128x1v8.h included above) */
+
+#undef  XmmC
+#undef  XmmD
+#undef  XmmE
+#undef  XmmF
+#undef  XmmG
+#undef  XmmH
+#undef  XmmI
+#undef  XmmJ
+#undef  XmmK
+#undef  XmmL
+#undef  XmmM
+#undef  XmmN
+#undef  XmmO
+#undef  XmmP
+#undef  XmmQ
+#undef  XmmR
+#undef  XmmS
+#undef  XmmT
+
+#define XmmC    EmmC, 0x03, EMPTY
+#define XmmD    EmmD, 0x03, EMPTY
+#define XmmE    EmmE, 0x03, EMPTY
+#define XmmF    EmmF, 0x03, EMPTY
+#define XmmG    EmmG, 0x03, EMPTY
+#define XmmH    EmmH, 0x03, EMPTY
+#define XmmI    EmmI, 0x03, EMPTY
+#define XmmJ    EmmJ, 0x03, EMPTY
+#define XmmK    EmmK, 0x03, EMPTY
+#define XmmL    EmmL, 0x03, EMPTY
+#define XmmM    EmmM, 0x03, EMPTY
+#define XmmN    EmmN, 0x03, EMPTY
+#define XmmO    EmmO, 0x03, EMPTY
+#define XmmP    EmmP, 0x03, EMPTY
+#define XmmQ    EmmQ, 0x03, EMPTY
+#define XmmR    EmmR, 0x03, EMPTY
+#define XmmS    EmmS, 0x03, EMPTY
+#define XmmT    EmmT, 0x03, EMPTY
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-32-bit element **** 256-bit ***/
+/******************************************************************************/
+
+/* elm (D = S), store first SIMD element with natural alignment
+ * allows to decouple scalar subset from SIMD where appropriate */
+
+#define elmox_st(XS, MD, DD) /* 1st elem as in mem with SIMD load/store */  \
+        EML(W(XS), TmmC)                                                    \
+        elmcx_st(EMR(W(XS), TmmC), W(MD), W(DD))
+
+/***************   packed single-precision generic move/logic   ***************/
+
+/* mov (D = S) */
+
+#define movox_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        movcx_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define movox_ld(XD, MS, DS)                                                \
+        movcx_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define movox_st(XS, MD, DD)                                                \
+        EML(W(XS), TmmC)                                                    \
+        movcx_st(EMR(W(XS), TmmC), W(MD), W(DD))
+
+/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
+ * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
+
+#define mmvox_rr(XD, XS)                                                    \
+        EML(W(XD), TmmC) EML(W(XS), TmmD)                                   \
+        mmvcx_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define mmvox_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mmvcx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mmvox_st(XS, MG, DG)                                                \
+        EML(W(XS), TmmC)                                                    \
+        mmvcx_st(EMR(W(XS), TmmC), W(MG), W(DG))
+
+/* and (G = G & S), (D = S & T) if (#D != #S) */
+
+#define andox_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        andcx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define andox_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        andcx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define andox3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        andcx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define andox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        andcx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+
+#define annox_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        anncx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define annox_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        anncx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define annox3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        anncx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define annox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        anncx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* orr (G = G | S), (D = S | T) if (#D != #S) */
+
+#define orrox_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        orrcx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define orrox_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        orrcx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define orrox3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        orrcx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define orrox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        orrcx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+
+#define ornox_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        orncx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define ornox_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        orncx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define ornox3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        orncx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define ornox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        orncx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+
+#define xorox_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        xorcx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define xorox_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        xorcx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define xorox3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        xorcx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define xorox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        xorcx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* not (G = ~G), (D = ~S) */
+
+#define notox_rx(XG)                                                        \
+        EML(W(XG), TmmC)                                                    \
+        notcx_rx(EMR(W(XG), TmmC))                                          \
+        EMS(W(XG), TmmC)
+
+#define notox_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        notcx_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+/************   packed single-precision floating-point arithmetic   ***********/
+
+/* neg (G = -G), (D = -S) */
+
+#define negos_rx(XG)                                                        \
+        EML(W(XG), TmmC)                                                    \
+        negcs_rx(EMR(W(XG), TmmC))                                          \
+        EMS(W(XG), TmmC)
+
+#define negos_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        negcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        addcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define addos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        addcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define addos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        addcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define addos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        addcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define adpos_rr(XG, XS) /* horizontal pairwise add, first 15-regs only */  \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        adpcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define adpos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        adpcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define adpos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        adpcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define adpos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        adpcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define adhos_rr(XG, XS) /* horizontal reductive add, first 15-regs only */ \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        adhcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define adhos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        adhcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        subcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define subos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        subcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define subos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        subcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define subos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        subcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mulcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mulos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mulcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mulos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mulcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mulos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mulcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mlpos_rr(XG, XS) /* horizontal pairwise mul */                      \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mlpcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mlpos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mlpcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mlpos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mlpcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mlpos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mlpcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        EML(W(XS), TmmD)                                                    \
+        mlhcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define mlhos_ld(XD, MS, DS)                                                \
+        mlhcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* div (G = G / S), (D = S / T) if (#D != #S) */
+
+#define divos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        divcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define divos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        divcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define divos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        divcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define divos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        divcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* sqr (D = sqrt S) */
+
+#define sqros_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        sqrcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define sqros_ld(XD, MS, DS)                                                \
+        sqrcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cbr (D = cbrt S) */
+
+#define cbros_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        EML(W(XS), TmmF)                                                    \
+        cbrcs_rr(EMR(W(XD), TmmC), EMR(W(X1), TmmD), EMR(W(X2), TmmE),      \
+                 EMR(W(XS), TmmF))                                          \
+        EMS(W(XD), TmmC)
+
+#define cbeos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        EML(W(XS), TmmF)                                                    \
+        cbecs_rr(EMR(W(XD), TmmC), EMR(W(X1), TmmD), EMR(W(X2), TmmE),      \
+                 EMR(W(XS), TmmF))                                          \
+        EMS(W(XD), TmmC)
+
+#define cbsos_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        EML(W(XG), TmmC) EML(W(XS), TmmF)                                   \
+        cbscs_rr(EMR(W(XG), TmmC), EMR(W(X1), TmmD), EMR(W(X2), TmmE),      \
+                 EMR(W(XS), TmmF))                                          \
+        EMS(W(XG), TmmC)
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rcpos_rr(XD, XS) /* destroys XS */                                  \
+        EML(W(XS), TmmD)                                                    \
+        rcpcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rceos_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        rcecs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rcsos_rr(XG, XS) /* destroys XS */                                  \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        rcscs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rsqos_rr(XD, XS) /* destroys XS */                                  \
+        EML(W(XS), TmmD)                                                    \
+        rsqcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rseos_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        rsecs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rssos_rr(XG, XS) /* destroys XS */                                  \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        rsscs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#define fmaos_rr(XG, XS, XT)                                                \
+        EML(W(XG), TmmC) EML(W(XS), TmmD) EML(W(XT), TmmE)                  \
+        fmacs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XG), TmmC)
+
+#define fmaos_ld(XG, XS, MT, DT)                                            \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        fmacs_ld(EMR(W(XG), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XG), TmmC)
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all POWER systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#define fmsos_rr(XG, XS, XT)                                                \
+        EML(W(XG), TmmC) EML(W(XS), TmmD) EML(W(XT), TmmE)                  \
+        fmscs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XG), TmmC)
+
+#define fmsos_ld(XG, XS, MT, DT)                                            \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        fmscs_ld(EMR(W(XG), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XG), TmmC)
+
+/*************   packed single-precision floating-point compare   *************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+
+#define minos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mincs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define minos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mincs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define minos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mincs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define minos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mincs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mnpos_rr(XG, XS) /* horizontal pairwise min */                      \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mnpcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mnpos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mnpcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mnpos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mnpcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mnpos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mnpcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mnhos_rr(XD, XS) /* horizontal reductive min */                     \
+        EML(W(XS), TmmD)                                                    \
+        mnhcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define mnhos_ld(XD, MS, DS)                                                \
+        mnhcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+
+#define maxos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        maxcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define maxos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        maxcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define maxos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        maxcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define maxos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        maxcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mxpos_rr(XG, XS) /* horizontal pairwise max */                      \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mxpcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mxpos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mxpcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mxpos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mxpcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mxpos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mxpcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mxhos_rr(XD, XS) /* horizontal reductive max */                     \
+        EML(W(XS), TmmD)                                                    \
+        mxhcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define mxhos_ld(XD, MS, DS)                                                \
+        mxhcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        ceqcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define ceqos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        ceqcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define ceqos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        ceqcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define ceqos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        ceqcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#define cneos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cnecs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cneos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cnecs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cneos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cnecs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cneos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cnecs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+
+#define cltos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cltcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cltos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cltcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cltos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cltcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cltos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cltcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+
+#define cleos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        clecs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cleos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        clecs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cleos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        clecs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cleos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        clecs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+
+#define cgtos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cgtcs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cgtos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cgtcs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cgtos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cgtcs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cgtos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cgtcs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+
+#define cgeos_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cgecs_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cgeos_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cgecs_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cgeos3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cgecs3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cgeos3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cgecs3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* mkj (jump to lb) if (S satisfies mask condition) */
+
+#define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+        EML(W(XS), TmmC)                                                    \
+        mkjcx_rx(EMR(W(XS), TmmC), mask, lb)
+
+/*************   packed single-precision floating-point convert   *************/
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnzos_rr(XD, XS)     /* round towards zero */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnzcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnzos_ld(XD, MS, DS) /* round towards zero */                       \
+        rnzcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvzos_rr(XD, XS)     /* round towards zero */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvzcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvzos_ld(XD, MS, DS) /* round towards zero */                       \
+        cvzcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnpos_rr(XD, XS)     /* round towards +inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnpcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnpos_ld(XD, MS, DS) /* round towards +inf */                       \
+        rnpcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvpos_rr(XD, XS)     /* round towards +inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvpcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvpos_ld(XD, MS, DS) /* round towards +inf */                       \
+        cvpcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnmos_rr(XD, XS)     /* round towards -inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnmcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnmos_ld(XD, MS, DS) /* round towards -inf */                       \
+        rnmcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvmos_rr(XD, XS)     /* round towards -inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvmcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvmos_ld(XD, MS, DS) /* round towards -inf */                       \
+        cvmcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnnos_rr(XD, XS)     /* round towards near */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnncs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnnos_ld(XD, MS, DS) /* round towards near */                       \
+        rnncs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvnos_rr(XD, XS)     /* round towards near */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvncs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvnos_ld(XD, MS, DS) /* round towards near */                       \
+        cvncs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvnon_rr(XD, XS)     /* round towards near */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvncn_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvnon_ld(XD, MS, DS) /* round towards near */                       \
+        cvncn_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: ROUNDZ is not supported on pre-VSX POWER systems, use cvz
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rndos_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        rndcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rndos_ld(XD, MS, DS)                                                \
+        rndcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvtos_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        cvtcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvtos_ld(XD, MS, DS)                                                \
+        cvtcs_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: only default ROUNDN is supported on pre-VSX POWER systems */
+
+#define cvton_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        cvtcn_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvton_ld(XD, MS, DS)                                                \
+        cvtcn_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
+ * isn't always taken into account when used within full-IEEE ASM block
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnros_rr(XD, XS, mode)                                              \
+        EML(W(XS), TmmD)                                                    \
+        rnrcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), mode)                  \
+        EMS(W(XD), TmmC)
+
+#define cvros_rr(XD, XS, mode)                                              \
+        EML(W(XS), TmmD)                                                    \
+        cvrcs_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), mode)                  \
+        EMS(W(XD), TmmC)
+
+/************   packed single-precision integer arithmetic/shifts   ***********/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addox_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        addcx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define addox_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        addcx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define addox3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        addcx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define addox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        addcx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subox_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        subcx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define subox_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        subcx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define subox3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        subcx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define subox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        subcx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulox_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mulcx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mulox_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mulcx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mulox3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mulcx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mulox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mulcx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed */
+
+#define dphon_rr(XG, XS, XT)                                                \
+        EML(W(XG), TmmC) EML(W(XS), TmmD) EML(W(XT), TmmE)                  \
+        dphcn_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XG), TmmC)
+
+#define dphon_ld(XG, XS, MT, DT)                                            \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        dphcn_ld(EMR(W(XG), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XG), TmmC)
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, signed */
+
+#define dpbon_rr(XG, XS, XT)                                                \
+        EML(W(XG), TmmC) EML(W(XS), TmmD) EML(W(XT), TmmE)                  \
+        dpbcn_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XG), TmmC)
+
+#define dpbon_ld(XG, XS, MT, DT)                                            \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        dpbcn_ld(EMR(W(XG), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XG), TmmC)
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, unsigned */
+
+#define dpbox_rr(XG, XS, XT)                                                \
+        EML(W(XG), TmmC) EML(W(XS), TmmD) EML(W(XT), TmmE)                  \
+        dpbcx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XG), TmmC)
+
+#define dpbox_ld(XG, XS, MT, DT)                                            \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        dpbcx_ld(EMR(W(XG), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XG), TmmC)
+
+/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define shlox_ri(XG, IS)                                                    \
+        EML(W(XG), TmmC)                                                    \
+        shlcx_ri(EMR(W(XG), TmmC), W(IS))                                   \
+        EMS(W(XG), TmmC)
+
+#define shlox_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        EML(W(XG), TmmC)                                                    \
+        shlcx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define shlox3ri(XD, XS, IT)                                                \
+        EML(W(XS), TmmD)                                                    \
+        shlcx3ri(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(IT))                 \
+        EMS(W(XD), TmmC)
+
+#define shlox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        shlcx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define shrox_ri(XG, IS)                                                    \
+        EML(W(XG), TmmC)                                                    \
+        shrcx_ri(EMR(W(XG), TmmC), W(IS))                                   \
+        EMS(W(XG), TmmC)
+
+#define shrox_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        EML(W(XG), TmmC)                                                    \
+        shrcx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define shrox3ri(XD, XS, IT)                                                \
+        EML(W(XS), TmmD)                                                    \
+        shrcx3ri(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(IT))                 \
+        EMS(W(XD), TmmC)
+
+#define shrox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        shrcx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define shron_ri(XG, IS)                                                    \
+        EML(W(XG), TmmC)                                                    \
+        shrcn_ri(EMR(W(XG), TmmC), W(IS))                                   \
+        EMS(W(XG), TmmC)
+
+#define shron_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        EML(W(XG), TmmC)                                                    \
+        shrcn_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define shron3ri(XD, XS, IT)                                                \
+        EML(W(XS), TmmD)                                                    \
+        shrcn3ri(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(IT))                 \
+        EMS(W(XD), TmmC)
+
+#define shron3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        shrcn3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define svlox_rr(XG, XS)     /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        svlcx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define svlox_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC)                                                    \
+        svlcx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define svlox3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        svlcx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define svlox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        svlcx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define svrox_rr(XG, XS)     /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        svrcx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define svrox_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC)                                                    \
+        svrcx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define svrox3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        svrcx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define svrox3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        svrcx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define svron_rr(XG, XS)     /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        svrcn_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define svron_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC)                                                    \
+        svrcn_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define svron3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        svrcn3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define svron3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        svrcn3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-32-bit element **** 128-bit ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+/* sregs (XmmC - XmmF are emulated on this target, save physical TmmC - TmmF
+ * instead, emulated registers themselves stay in SIMD reg-file at all times) */
+
+#undef  sregs_sa
+#define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        muvcx_st(Xmm0, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(Xmm1, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(Xmm2, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(Xmm3, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(Xmm4, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(Xmm5, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(Xmm6, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(Xmm7, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(Xmm8, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(Xmm9, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(XmmA, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(XmmB, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(TmmC, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(TmmD, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(TmmE, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_st(TmmF, Oeax, PLAIN)
+
+#undef  sregs_la
+#define sregs_la() /* load all SIMD regs, destroys Reax */                  \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        muvcx_ld(Xmm0, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(Xmm1, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(Xmm2, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(Xmm3, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(Xmm4, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(Xmm5, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(Xmm6, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(Xmm7, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(Xmm8, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(Xmm9, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(XmmA, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(XmmB, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(TmmC, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(TmmD, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(TmmE, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
+        muvcx_ld(TmmF, Oeax, PLAIN)
+
+#endif /* RT_256X1 */
+
+#endif /* RT_SIMD_CODE */
+
+#endif /* RT_RTARCH_X32_256X1V4_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
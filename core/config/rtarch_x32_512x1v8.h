@@ -739,6 +739,56 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_512))                     \
         jeqxx_lb(lb)
 
+/* cps (D = active lanes of S), xpd (G = active lanes from S), RD = count
+ * active lanes of mask XM are moved to k1 for vcompressps/vexpandps, which
+ * only access RD elements, overrides generic versions from rtbase.h */
+
+#define pc1wx_rr(RD, RS)     /* not portable, do not use outside */         \
+        EMITB(0xF3) REX(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xB8)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#if (RT_ELEMENT == 32)
+
+#undef  cpspx_st
+#define cpspx_st(XS, XM, RD, MD, DD, lb) /* destroys Reax, RD = count */    \
+        ck1ox_rm(W(XM), Mebp, inf_GPC07)                                    \
+        movxx_ri(Reax, IB(0))                                               \
+    ADR EKX(RXB(XS), RXB(MD),    0x00, K, 1, 2) EMITB(0x8A)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)                                        \
+        mk1wx_rx(Reax)                                                      \
+        pc1wx_rr(W(RD), Reax)
+
+#undef  xpdpx_ld
+#define xpdpx_ld(XG, XM, RD, MS, DS, lb) /* destroys Reax, RD = count */    \
+        ck1ox_rm(W(XM), Mebp, inf_GPC07)                                    \
+        movxx_ri(Reax, IB(0))                                               \
+    ADR EKX(RXB(XG), RXB(MS),    0x00, K, 1, 2) EMITB(0x88)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)                                        \
+        mk1wx_rx(Reax)                                                      \
+        pc1wx_rr(W(RD), Reax)
+
+#endif /* RT_ELEMENT == 32 */
+
+/* mkm (D = lane bitmask of mask S), mkc (D = active-lane count of mask S)
+ * mask S is moved to k1, overrides generic versions from rtbase.h */
+
+#if (RT_ELEMENT == 32)
+
+#undef  mkmpx_rx
+#define mkmpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane bits */        \
+        ck1ox_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(W(RD))
+
+#undef  mkcpx_rx
+#define mkcpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane count */       \
+        ck1ox_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(Reax)                                                      \
+        pc1wx_rr(W(RD), Reax)
+
+#endif /* RT_ELEMENT == 32 */
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -895,6 +945,42 @@
         ERX(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x5B)\
         MRM(REG(XD), MOD(XS), REG(XS))
 
+/************   packed single-precision rounding-mode arithmetic   ************/
+
+/* add/sub/mul/div (D = S op T), sqr (D = sqrt S), cvr (D = int-to-fp S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * overrides generic versions from rtbase.h, which write fp control register */
+
+#undef  addosRrr
+#define addosRrr(XD, XS, XT, mode)                                          \
+        ERX(RXB(XD), RXB(XT), REN(XS), RT_SIMD_MODE_##mode&3, 0, 1)         \
+        EMITB(0x58) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  subosRrr
+#define subosRrr(XD, XS, XT, mode)                                          \
+        ERX(RXB(XD), RXB(XT), REN(XS), RT_SIMD_MODE_##mode&3, 0, 1)         \
+        EMITB(0x5C) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  mulosRrr
+#define mulosRrr(XD, XS, XT, mode)                                          \
+        ERX(RXB(XD), RXB(XT), REN(XS), RT_SIMD_MODE_##mode&3, 0, 1)         \
+        EMITB(0x59) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  divosRrr
+#define divosRrr(XD, XS, XT, mode)                                          \
+        ERX(RXB(XD), RXB(XT), REN(XS), RT_SIMD_MODE_##mode&3, 0, 1)         \
+        EMITB(0x5E) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  sqrosRrr
+#define sqrosRrr(XD, XS, mode)                                              \
+        ERX(RXB(XD), RXB(XS),    0x00, RT_SIMD_MODE_##mode&3, 0, 1)         \
+        EMITB(0x51) MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvron_rr
+#define cvron_rr(XD, XS, mode)                                              \
+        ERX(RXB(XD), RXB(XS),    0x00, RT_SIMD_MODE_##mode&3, 0, 1)         \
+        EMITB(0x5B) MRM(REG(XD), MOD(XS), REG(XS))
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -0,0 +1,479 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTARCH_X32_512X1VP_H
+#define RT_RTARCH_X32_512X1VP_H
+
+#define RT_PRED                 6
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtarch_x32_512x1vP.h: Implementation of x86_64 fp32 AVX512F predicated ops.
+ *
+ * This file is a part of the unified SIMD assembler framework (rtarch.h)
+ * designed to be compatible with different processor architectures,
+ * while maintaining strictly defined common API.
+ *
+ * Recommended naming scheme for instructions:
+ *
+ * cmdo*Prr - applies [cmd] to var-len packed: [r]egister from [r]egister
+ * cmdo*Pld - applies [cmd] to var-len packed: [r]egister from memory
+ *            under predicate placed right after destination SIMD register
+ *
+ * cmdo*4rr - applies [cmd] to var-len packed: [r]egister from [r]egister
+ * cmdo*4ld - applies [cmd] to var-len packed: [r]egister from memory
+ *            three-operand form, predicate is placed right after XD
+ *
+ * Compare instructions write their result into a predicate placed 1st,
+ * while their 4-form combines the result with governing predicate (PG).
+ * Predicate registers are exposed as triplets similar to SIMD registers:
+ *
+ * Pm1..Pm6 - merging predicates, inactive elements keep destination values
+ * Pz1..Pz6 - zeroing predicates, inactive elements of destination are zeroed
+ * Px1..Px6 - plain predicates where merging/zeroing is not applicable
+ *
+ * Pm#, Pz#, Px# with the same number refer to the same physical predicate,
+ * on AVX-512 they are mapped onto mask registers k2..k7 (k1 is internal).
+ * Portable code should also follow operand rules of predicated ARM-SVE:
+ * (#D != #T) in 4-operand ops and (#G != #S) in 2-operand ops with Pz#.
+ *
+ * Loops over arrays of arbitrary length can be written without dependency
+ * on SIMD width: whloxPrr generates the predicate for remaining elements,
+ * while cntox_rx/incox_rx use actual number of 32-bit elements in register,
+ * which on ARM-SVE is read at runtime (CNTW/INCW) rather than from RT_SIMD.
+ * Predicated loads/stores (movoxPld/movoxPst) don't access memory in
+ * inactive elements, thus loop tails can be processed within array bounds.
+ * DP/DF/DG displacements still assume RT_SIMD-wide registers (structures),
+ * use BASE+index addressing (I***) with DP(0) for length-agnostic loops.
+ *
+ * Interpretation of instruction parameters:
+ *
+ * upper-case params have triplet structure and require W to pass-forward
+ * lower-case params are singular and can be used/passed as such directly
+ *
+ * XD - SIMD register serving as destination only, if present
+ * XG - SIMD register serving as destination and first source
+ * XS - SIMD register serving as second source (first if any)
+ * XT - SIMD register serving as third source (second if any)
+ *
+ * PD - predicate serving as destination only (in compare instructions)
+ * PG - predicate governing the operation (inactive elements merge/zero)
+ * PS - predicate serving as source (in mask-jump instructions)
+ *
+ * RD - BASE register serving as destination only (in loop control)
+ * RG - BASE register serving as destination and source (in loop control)
+ * RS - BASE register serving as first source (in loop control)
+ * RT - BASE register serving as second source (in loop control)
+ *
+ * MD - BASE addressing mode (Oeax, M***, I***) (memory-dest)
+ * MG - BASE addressing mode (Oeax, M***, I***) (memory-dsrc)
+ * MS - BASE addressing mode (Oeax, M***, I***) (memory-src2)
+ * MT - BASE addressing mode (Oeax, M***, I***) (memory-src3)
+ *
+ * DD - displacement value (DP, DF, DG, DH, DV) (memory-dest)
+ * DG - displacement value (DP, DF, DG, DH, DV) (memory-dsrc)
+ * DS - displacement value (DP, DF, DG, DH, DV) (memory-src2)
+ * DT - displacement value (DP, DF, DG, DH, DV) (memory-src3)
+ */
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#if (defined RT_SIMD_CODE)
+
+#if (RT_512X1 >= 1 && RT_512X1 <= 8)
+
+/******************************************************************************/
+/********************************   EXTERNAL   ********************************/
+/******************************************************************************/
+
+/* predicates   REG,  MOD,  SIB */
+
+#define Pm1     0x02, 0x00, EMPTY       /* k2, merging */
+#define Pm2     0x03, 0x00, EMPTY       /* k3, merging */
+#define Pm3     0x04, 0x00, EMPTY       /* k4, merging */
+#define Pm4     0x05, 0x00, EMPTY       /* k5, merging */
+#define Pm5     0x06, 0x00, EMPTY       /* k6, merging */
+#define Pm6     0x07, 0x00, EMPTY       /* k7, merging */
+
+#define Pz1     0x02, 0x80, EMPTY       /* k2, zeroing */
+#define Pz2     0x03, 0x80, EMPTY       /* k3, zeroing */
+#define Pz3     0x04, 0x80, EMPTY       /* k4, zeroing */
+#define Pz4     0x05, 0x80, EMPTY       /* k5, zeroing */
+#define Pz5     0x06, 0x80, EMPTY       /* k6, zeroing */
+#define Pz6     0x07, 0x80, EMPTY       /* k7, zeroing */
+
+#define Px1     0x02, 0x00, EMPTY       /* k2 */
+#define Px2     0x03, 0x00, EMPTY       /* k3 */
+#define Px3     0x04, 0x00, EMPTY       /* k4 */
+#define Px4     0x05, 0x00, EMPTY       /* k5 */
+#define Px5     0x06, 0x00, EMPTY       /* k6 */
+#define Px6     0x07, 0x00, EMPTY       /* k7 */
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/*****************   packed single-precision predicated move   ****************/
+
+/* mov (G = S) under predicate */
+
+#define movoxPrr(XG, PG, XS)                                                \
+        EPX(RXB(XG), RXB(XS),    0x00, K, 0, 1, PRD(PG)) EMITB(0x28)        \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define movoxPld(XG, PG, MS, DS)                                            \
+    ADR EPX(RXB(XG), RXB(MS),    0x00, K, 0, 1, PRD(PG)) EMITB(0x28)        \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* mov (D = S) under predicate, inactive elements of memory are not written */
+
+#define movoxPst(XS, PS, MD, DD)                                            \
+    ADR EPX(RXB(XS), RXB(MD),    0x00, K, 0, 1, REG(PS)) EMITB(0x29)        \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/**************   packed single-precision predicated arithmetic   *************/
+
+/* add (G = G + S), (D = S + T) if (#D != #T) */
+
+#define addosPrr(XG, PG, XS)                                                \
+        addos4rr(W(XG), W(PG), W(XG), W(XS))
+
+#define addosPld(XG, PG, MS, DS)                                            \
+        addos4ld(W(XG), W(PG), W(XG), W(MS), W(DS))
+
+#define addos4rr(XD, PG, XS, XT)                                            \
+        EPX(RXB(XD), RXB(XT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x58)        \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define addos4ld(XD, PG, XS, MT, DT)                                        \
+    ADR EPX(RXB(XD), RXB(MT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x58)        \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* sub (G = G - S), (D = S - T) if (#D != #T) */
+
+#define subosPrr(XG, PG, XS)                                                \
+        subos4rr(W(XG), W(PG), W(XG), W(XS))
+
+#define subosPld(XG, PG, MS, DS)                                            \
+        subos4ld(W(XG), W(PG), W(XG), W(MS), W(DS))
+
+#define subos4rr(XD, PG, XS, XT)                                            \
+        EPX(RXB(XD), RXB(XT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x5C)        \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define subos4ld(XD, PG, XS, MT, DT)                                        \
+    ADR EPX(RXB(XD), RXB(MT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x5C)        \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* mul (G = G * S), (D = S * T) if (#D != #T) */
+
+#define mulosPrr(XG, PG, XS)                                                \
+        mulos4rr(W(XG), W(PG), W(XG), W(XS))
+
+#define mulosPld(XG, PG, MS, DS)                                            \
+        mulos4ld(W(XG), W(PG), W(XG), W(MS), W(DS))
+
+#define mulos4rr(XD, PG, XS, XT)                                            \
+        EPX(RXB(XD), RXB(XT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x59)        \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define mulos4ld(XD, PG, XS, MT, DT)                                        \
+    ADR EPX(RXB(XD), RXB(MT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x59)        \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* div (G = G / S), (D = S / T) if (#D != #T) */
+
+#define divosPrr(XG, PG, XS)                                                \
+        divos4rr(W(XG), W(PG), W(XG), W(XS))
+
+#define divosPld(XG, PG, MS, DS)                                            \
+        divos4ld(W(XG), W(PG), W(XG), W(MS), W(DS))
+
+#define divos4rr(XD, PG, XS, XT)                                            \
+        EPX(RXB(XD), RXB(XT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x5E)        \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define divos4ld(XD, PG, XS, MT, DT)                                        \
+    ADR EPX(RXB(XD), RXB(MT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x5E)        \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minosPrr(XG, PG, XS)                                                \
+        minos4rr(W(XG), W(PG), W(XG), W(XS))
+
+#define minosPld(XG, PG, MS, DS)                                            \
+        minos4ld(W(XG), W(PG), W(XG), W(MS), W(DS))
+
+#define minos4rr(XD, PG, XS, XT)                                            \
+        EPX(RXB(XD), RXB(XT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x5D)        \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minos4ld(XD, PG, XS, MT, DT)                                        \
+    ADR EPX(RXB(XD), RXB(MT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x5D)        \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxosPrr(XG, PG, XS)                                                \
+        maxos4rr(W(XG), W(PG), W(XG), W(XS))
+
+#define maxosPld(XG, PG, MS, DS)                                            \
+        maxos4ld(W(XG), W(PG), W(XG), W(MS), W(DS))
+
+#define maxos4rr(XD, PG, XS, XT)                                            \
+        EPX(RXB(XD), RXB(XT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x5F)        \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxos4ld(XD, PG, XS, MT, DT)                                        \
+    ADR EPX(RXB(XD), RXB(MT), REN(XS), K, 0, 1, PRD(PG)) EMITB(0x5F)        \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/***************   packed single-precision predicated compare   ***************/
+
+/* ceq (P = S == T), (P = PG & (S == T)) */
+
+#define ceqosPrr(PD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x00))
+
+#define ceqosPld(PD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x00))
+
+#define ceqos4rr(PD, PG, XS, XT)                                            \
+        EPX(0,       RXB(XT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x00))
+
+#define ceqos4ld(PD, PG, XS, MT, DT)                                        \
+    ADR EPX(0,       RXB(MT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x00))
+
+/* cne (P = S != T), (P = PG & (S != T)) */
+
+#define cneosPrr(PD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))
+
+#define cneosPld(PD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x04))
+
+#define cneos4rr(PD, PG, XS, XT)                                            \
+        EPX(0,       RXB(XT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))
+
+#define cneos4ld(PD, PG, XS, MT, DT)                                        \
+    ADR EPX(0,       RXB(MT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x04))
+
+/* clt (P = S < T), (P = PG & (S < T)) */
+
+#define cltosPrr(PD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+#define cltosPld(PD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x01))
+
+#define cltos4rr(PD, PG, XS, XT)                                            \
+        EPX(0,       RXB(XT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+#define cltos4ld(PD, PG, XS, MT, DT)                                        \
+    ADR EPX(0,       RXB(MT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x01))
+
+/* cle (P = S <= T), (P = PG & (S <= T)) */
+
+#define cleosPrr(PD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x02))
+
+#define cleosPld(PD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x02))
+
+#define cleos4rr(PD, PG, XS, XT)                                            \
+        EPX(0,       RXB(XT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x02))
+
+#define cleos4ld(PD, PG, XS, MT, DT)                                        \
+    ADR EPX(0,       RXB(MT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x02))
+
+/* cgt (P = S > T), (P = PG & (S > T)) */
+
+#define cgtosPrr(PD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x06))
+
+#define cgtosPld(PD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x06))
+
+#define cgtos4rr(PD, PG, XS, XT)                                            \
+        EPX(0,       RXB(XT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x06))
+
+#define cgtos4ld(PD, PG, XS, MT, DT)                                        \
+    ADR EPX(0,       RXB(MT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x06))
+
+/* cge (P = S >= T), (P = PG & (S >= T)) */
+
+#define cgeosPrr(PD, XS, XT)                                                \
+        EVX(0,       RXB(XT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x05))
+
+#define cgeosPld(PD, XS, MT, DT)                                            \
+    ADR EVX(0,       RXB(MT), REN(XS), K, 0, 1) EMITB(0xC2)                 \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x05))
+
+#define cgeos4rr(PD, PG, XS, XT)                                            \
+        EPX(0,       RXB(XT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x05))
+
+#define cgeos4ld(PD, PG, XS, MT, DT)                                        \
+    ADR EPX(0,       RXB(MT), REN(XS), K, 0, 1, REG(PG)) EMITB(0xC2)        \
+        MRM(REG(PD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(0x05))
+
+/* mkj (jump to lb) if (S satisfies mask condition) */
+
+#define mkpwx_rx(RD, PS)     /* not portable, do not use outside */         \
+        VEX(RXB(RD),       0,    0x00, 0, 0, 1) EMITB(0x93)                 \
+        MRM(REG(RD),    0x03,    REG(PS))
+
+#define mkjoxPrx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+        mkpwx_rx(Reax, W(PS))                                               \
+        cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##32_512))                     \
+        jeqxx_lb(lb)
+
+/***************   packed single-precision var-len loop control   *************/
+
+/* cnt (D = number of 32-bit elements in var-len SIMD register) */
+
+#define cntox_rx(RD)                                                        \
+        movwx_ri(W(RD), IB(RT_SIMD/32))
+
+/* inc (G = G + number of 32-bit elements in var-len SIMD register) */
+
+#define incox_rx(RG)                                                        \
+        addwx_ri(W(RG), IB(RT_SIMD/32))
+
+/* whl (P = elements (i) for which (S + i < T)), signed 32-bit counters */
+
+#define whloxPrr(PD, RS, RT)   /* destroys Reax, uses BMI2 (AVX512) */      \
+        movwx_rr(Reax, W(RT))               /* eax <- T - S (flags) */      \
+        REX(0,       RXB(RS)) EMITB(0x2B)                                   \
+        MRM(0x00,    MOD(RS), REG(RS))                                      \
+        REX(0,             1) EMITB(0xC7)   /* r15d <- 0 */                 \
+        MRM(0x00,       0x03,    0x07)                                      \
+        EMITW(0x00000000)                                                   \
+        REX(0,             1) EMITB(0x0F) EMITB(0x4C) /* cmovl */           \
+        MRM(0x00,       0x03,    0x07)                                      \
+        REX(0,             1) EMITB(0xC7)   /* r15d <- N */                 \
+        MRM(0x00,       0x03,    0x07)                                      \
+        EMITW(RT_SIMD/32)                                                   \
+        REX(0,             1) EMITB(0x3B)                                   \
+        MRM(0x00,       0x03,    0x07)                                      \
+        REX(0,             1) EMITB(0x0F) EMITB(0x47) /* cmova */           \
+        MRM(0x00,       0x03,    0x07)                                      \
+        REX(0,             1) EMITB(0xC7)   /* r15d <- all-ones */          \
+        MRM(0x00,       0x03,    0x07)                                      \
+        EMITW(0xFFFFFFFF)                                                   \
+        VEX(0,             1,    0x00, 0, 0, 2) EMITB(0xF5) /* bzhi */      \
+        MRM(0x00,       0x03,    0x07)                                      \
+        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x92) /* kmovw */     \
+        MRM(REG(PD),    0x03,    0x00)
+
+/**********   packed single-precision predicated integer arithmetic   *********/
+
+/* add (G = G + S), (D = S + T) if (#D != #T) */
+
+#define addoxPrr(XG, PG, XS)                                                \
+        addox4rr(W(XG), W(PG), W(XG), W(XS))
+
+#define addoxPld(XG, PG, MS, DS)                                            \
+        addox4ld(W(XG), W(PG), W(XG), W(MS), W(DS))
+
+#define addox4rr(XD, PG, XS, XT)                                            \
+        EPX(RXB(XD), RXB(XT), REN(XS), K, 1, 1, PRD(PG)) EMITB(0xFE)        \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define addox4ld(XD, PG, XS, MT, DT)                                        \
+    ADR EPX(RXB(XD), RXB(MT), REN(XS), K, 1, 1, PRD(PG)) EMITB(0xFE)        \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* sub (G = G - S), (D = S - T) if (#D != #T) */
+
+#define suboxPrr(XG, PG, XS)                                                \
+        subox4rr(W(XG), W(PG), W(XG), W(XS))
+
+#define suboxPld(XG, PG, MS, DS)                                            \
+        subox4ld(W(XG), W(PG), W(XG), W(MS), W(DS))
+
+#define subox4rr(XD, PG, XS, XT)                                            \
+        EPX(RXB(XD), RXB(XT), REN(XS), K, 1, 1, PRD(PG)) EMITB(0xFA)        \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define subox4ld(XD, PG, XS, MT, DT)                                        \
+    ADR EPX(RXB(XD), RXB(MT), REN(XS), K, 1, 1, PRD(PG)) EMITB(0xFA)        \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#endif /* RT_512X1 */
+
+#endif /* RT_SIMD_CODE */
+
+#endif /* RT_RTARCH_X32_512X1VP_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -797,6 +797,18 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xC2)                       \
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_128))                     \
         jeqxx_lb(lb)
 
+/* mkm (D = lane bitmask of mask S) is moved via movmsk, overrides generic
+ * version from rtbase.h, mkcpx_rx is left generic (no popcnt before SSE4.2) */
+
+#if (RT_SIMD == 128) && (RT_ELEMENT == 64)
+
+#undef  mkmpx_rx
+#define mkmpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane bits */        \
+    ESC REX(RXB(RD), RXB(XS)) EMITB(0x0F) EMITB(0x50)                       \
+        MRM(REG(RD), MOD(XS), REG(XS))
+
+#endif /* RT_SIMD == 128, RT_ELEMENT == 64 */
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -0,0 +1,1174 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTARCH_X64_256X1V4_H
+#define RT_RTARCH_X64_256X1V4_H
+
+#include "rtarch_x32_256x1v4.h"
+#include "rtarch_xHB_256x1v4.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtarch_x64_256x1v4.h: Implementation of x86_64 fp64 AVX1/2 30-regs emulation.
+ *
+ * This file is a part of the unified SIMD assembler framework (rtarch.h)
+ * designed to be compatible with different processor architectures,
+ * while maintaining strictly defined common API.
+ *
+ * Recommended naming scheme for instructions:
+ *
+ * cmdp*_ri - applies [cmd] to [p]acked: [r]egister from [i]mmediate
+ * cmdp*_rr - applies [cmd] to [p]acked: [r]egister from [r]egister
+ *
+ * cmdp*_rm - applies [cmd] to [p]acked: [r]egister from [m]emory
+ * cmdp*_ld - applies [cmd] to [p]acked: as above
+ *
+ * cmdi*_** - applies [cmd] to 32-bit SIMD element args, packed-128-bit
+ * cmdj*_** - applies [cmd] to 64-bit SIMD element args, packed-128-bit
+ * cmdl*_** - applies [cmd] to L-size SIMD element args, packed-128-bit
+ *
+ * cmdc*_** - applies [cmd] to 32-bit SIMD element args, packed-256-bit
+ * cmdd*_** - applies [cmd] to 64-bit SIMD element args, packed-256-bit
+ * cmdf*_** - applies [cmd] to L-size SIMD element args, packed-256-bit
+ *
+ * cmdo*_** - applies [cmd] to 32-bit SIMD element args, packed-var-len
+ * cmdp*_** - applies [cmd] to L-size SIMD element args, packed-var-len
+ * cmdq*_** - applies [cmd] to 64-bit SIMD element args, packed-var-len
+ *
+ * cmd*x_** - applies [cmd] to [p]acked unsigned integer args, [x] - default
+ * cmd*n_** - applies [cmd] to [p]acked   signed integer args, [n] - negatable
+ * cmd*s_** - applies [cmd] to [p]acked floating point   args, [s] - scalable
+ *
+ * The cmdp*_** (rtconf.h) instructions are intended for SPMD programming model
+ * and can be configured to work with 32/64-bit data elements (fp+int).
+ * In this model data paths are fixed-width, BASE and SIMD data elements are
+ * width-compatible, code path divergence is handled via mkj**_** pseudo-ops.
+ * Matching element-sized BASE subset cmdy*_** is defined in rtconf.h as well.
+ *
+ * Note, when using fixed-data-size 128/256-bit SIMD subsets simultaneously
+ * upper 128-bit halves of full 256-bit SIMD registers may end up undefined.
+ * On RISC targets they remain unchanged, while on x86-AVX they are zeroed.
+ * This happens when registers written in 128-bit subset are then used/read
+ * from within 256-bit subset. The same rule applies to mixing with 512-bit
+ * and wider vectors. Use of scalars may leave respective vector registers
+ * undefined, as seen from the perspective of any particular vector subset.
+ *
+ * 256-bit vectors used with wider subsets may not be compatible with regards
+ * to memory loads/stores when mixed in the code. It means that data loaded
+ * with wider vector and stored within 256-bit subset at the same address may
+ * result in changing the initial representation in memory. The same can be
+ * said about mixing vector and scalar subsets. Scalars can be completely
+ * detached on some architectures. Use elm*x_st to store 1st vector element.
+ * 128-bit vectors should be memory-compatible with any wider vector subset.
+ *
+ * Handling of NaNs in the floating point pipeline may not be consistent
+ * across different architectures. Avoid NaNs entering the data flow by using
+ * masking or control flow instructions. Apply special care when dealing with
+ * floating point compare and min/max input/output. The result of floating point
+ * compare instructions can be considered a -QNaN, though it is also interpreted
+ * as integer -1 and is often treated as a mask. Most arithmetic instructions
+ * should propagate QNaNs unchanged, however this behavior hasn't been verified.
+ *
+ * Register offloading for var-len fp64 subset (cmdq*) is implemented here
+ * on top of the fp32 target (rtarch_x32_256x1v4.h), refer to it for details
+ * on the fixed bottom-up register partition and its compile-time checks.
+ *
+ * Interpretation of instruction parameters:
+ *
+ * upper-case params have triplet structure and require W to pass-forward
+ * lower-case params are singular and can be used/passed as such directly
+ *
+ * XD - SIMD register serving as destination only, if present
+ * XG - SIMD register serving as destination and first source
+ * XS - SIMD register serving as second source (first if any)
+ * XT - SIMD register serving as third source (second if any)
+ *
+ * RD - BASE register serving as destination only, if present
+ * RG - BASE register serving as destination and first source
+ * RS - BASE register serving as second source (first if any)
+ * RT - BASE register serving as third source (second if any)
+ *
+ * MD - BASE addressing mode (Oeax, M***, I***) (memory-dest)
+ * MG - BASE addressing mode (Oeax, M***, I***) (memory-dsrc)
+ * MS - BASE addressing mode (Oeax, M***, I***) (memory-src2)
+ * MT - BASE addressing mode (Oeax, M***, I***) (memory-src3)
+ *
+ * DD - displacement value (DP, DF, DG, DH, DV) (memory-dest)
+ * DG - displacement value (DP, DF, DG, DH, DV) (memory-dsrc)
+ * DS - displacement value (DP, DF, DG, DH, DV) (memory-src2)
+ * DT - displacement value (DP, DF, DG, DH, DV) (memory-src3)
+ *
+ * IS - immediate value (is used as a second or first source)
+ * IT - immediate value (is used as a third or second source)
+ */
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#if (defined RT_SIMD_CODE)
+
+#if (RT_256X1 == 4)
+
+/******************************************************************************/
+/********************************   EXTERNAL   ********************************/
+/******************************************************************************/
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-64-bit element **** 256-bit ***/
+/******************************************************************************/
+
+/* elm (D = S), store first SIMD element with natural alignment
+ * allows to decouple scalar subset from SIMD where appropriate */
+
+#define elmqx_st(XS, MD, DD) /* 1st elem as in mem with SIMD load/store */  \
+        EML(W(XS), TmmC)                                                    \
+        elmdx_st(EMR(W(XS), TmmC), W(MD), W(DD))
+
+/***************   packed double-precision generic move/logic   ***************/
+
+/* mov (D = S) */
+
+#define movqx_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        movdx_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define movqx_ld(XD, MS, DS)                                                \
+        movdx_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define movqx_st(XS, MD, DD)                                                \
+        EML(W(XS), TmmC)                                                    \
+        movdx_st(EMR(W(XS), TmmC), W(MD), W(DD))
+
+/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
+ * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
+
+#define mmvqx_rr(XD, XS)                                                    \
+        EML(W(XD), TmmC) EML(W(XS), TmmD)                                   \
+        mmvdx_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define mmvqx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mmvdx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mmvqx_st(XS, MG, DG)                                                \
+        EML(W(XS), TmmC)                                                    \
+        mmvdx_st(EMR(W(XS), TmmC), W(MG), W(DG))
+
+/* and (G = G & S), (D = S & T) if (#D != #S) */
+
+#define andqx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        anddx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define andqx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        anddx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define andqx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        anddx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define andqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        anddx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+
+#define annqx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        anndx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define annqx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        anndx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define annqx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        anndx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define annqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        anndx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* orr (G = G | S), (D = S | T) if (#D != #S) */
+
+#define orrqx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        orrdx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define orrqx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        orrdx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define orrqx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        orrdx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define orrqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        orrdx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+
+#define ornqx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        orndx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define ornqx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        orndx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define ornqx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        orndx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define ornqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        orndx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+
+#define xorqx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        xordx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define xorqx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        xordx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define xorqx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        xordx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define xorqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        xordx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* not (G = ~G), (D = ~S) */
+
+#define notqx_rx(XG)                                                        \
+        EML(W(XG), TmmC)                                                    \
+        notdx_rx(EMR(W(XG), TmmC))                                          \
+        EMS(W(XG), TmmC)
+
+#define notqx_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        notdx_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+/************   packed double-precision floating-point arithmetic   ***********/
+
+/* neg (G = -G), (D = -S) */
+
+#define negqs_rx(XG)                                                        \
+        EML(W(XG), TmmC)                                                    \
+        negds_rx(EMR(W(XG), TmmC))                                          \
+        EMS(W(XG), TmmC)
+
+#define negqs_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        negds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        addds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define addqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        addds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define addqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        addds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define addqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        addds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define adpqs_rr(XG, XS) /* horizontal pairwise add, first 15-regs only */  \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        adpds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define adpqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        adpds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define adpqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        adpds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define adpqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        adpds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define adhqs_rr(XG, XS) /* horizontal reductive add, first 15-regs only */ \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        adhds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define adhqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        adhds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        subds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define subqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        subds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define subqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        subds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define subqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        subds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mulds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mulqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mulds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mulqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mulds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mulqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mulds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mlpqs_rr(XG, XS) /* horizontal pairwise mul */                      \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mlpds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mlpqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mlpds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mlpqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mlpds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mlpqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mlpds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        EML(W(XS), TmmD)                                                    \
+        mlhds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define mlhqs_ld(XD, MS, DS)                                                \
+        mlhds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* div (G = G / S), (D = S / T) if (#D != #S) */
+
+#define divqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        divds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define divqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        divds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define divqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        divds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define divqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        divds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* sqr (D = sqrt S) */
+
+#define sqrqs_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        sqrds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define sqrqs_ld(XD, MS, DS)                                                \
+        sqrds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cbr (D = cbrt S) */
+
+#define cbrqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        EML(W(XS), TmmF)                                                    \
+        cbrds_rr(EMR(W(XD), TmmC), EMR(W(X1), TmmD), EMR(W(X2), TmmE),      \
+                 EMR(W(XS), TmmF))                                          \
+        EMS(W(XD), TmmC)
+
+#define cbeqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        EML(W(XS), TmmF)                                                    \
+        cbeds_rr(EMR(W(XD), TmmC), EMR(W(X1), TmmD), EMR(W(X2), TmmE),      \
+                 EMR(W(XS), TmmF))                                          \
+        EMS(W(XD), TmmC)
+
+#define cbsqs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        EML(W(XG), TmmC) EML(W(XS), TmmF)                                   \
+        cbsds_rr(EMR(W(XG), TmmC), EMR(W(X1), TmmD), EMR(W(X2), TmmE),      \
+                 EMR(W(XS), TmmF))                                          \
+        EMS(W(XG), TmmC)
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rcpqs_rr(XD, XS) /* destroys XS */                                  \
+        EML(W(XS), TmmD)                                                    \
+        rcpds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rceqs_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        rceds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rcsqs_rr(XG, XS) /* destroys XS */                                  \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        rcsds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rsqqs_rr(XD, XS) /* destroys XS */                                  \
+        EML(W(XS), TmmD)                                                    \
+        rsqds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rseqs_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        rseds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rssqs_rr(XG, XS) /* destroys XS */                                  \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        rssds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#define fmaqs_rr(XG, XS, XT)                                                \
+        EML(W(XG), TmmC) EML(W(XS), TmmD) EML(W(XT), TmmE)                  \
+        fmads_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XG), TmmC)
+
+#define fmaqs_ld(XG, XS, MT, DT)                                            \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        fmads_ld(EMR(W(XG), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XG), TmmC)
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all POWER systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#define fmsqs_rr(XG, XS, XT)                                                \
+        EML(W(XG), TmmC) EML(W(XS), TmmD) EML(W(XT), TmmE)                  \
+        fmsds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XG), TmmC)
+
+#define fmsqs_ld(XG, XS, MT, DT)                                            \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        fmsds_ld(EMR(W(XG), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XG), TmmC)
+
+/*************   packed double-precision floating-point compare   *************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+
+#define minqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        minds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define minqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        minds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define minqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        minds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define minqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        minds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mnpqs_rr(XG, XS) /* horizontal pairwise min */                      \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mnpds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mnpqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mnpds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mnpqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mnpds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mnpqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mnpds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mnhqs_rr(XD, XS) /* horizontal reductive min */                     \
+        EML(W(XS), TmmD)                                                    \
+        mnhds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define mnhqs_ld(XD, MS, DS)                                                \
+        mnhds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+
+#define maxqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        maxds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define maxqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        maxds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define maxqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        maxds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define maxqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        maxds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mxpqs_rr(XG, XS) /* horizontal pairwise max */                      \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mxpds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mxpqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mxpds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mxpqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mxpds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mxpqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mxpds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+#define mxhqs_rr(XD, XS) /* horizontal reductive max */                     \
+        EML(W(XS), TmmD)                                                    \
+        mxhds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define mxhqs_ld(XD, MS, DS)                                                \
+        mxhds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        ceqds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define ceqqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        ceqds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define ceqqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        ceqds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define ceqqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        ceqds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#define cneqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cneds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cneqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cneds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cneqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cneds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cneqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cneds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+
+#define cltqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cltds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cltqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cltds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cltqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cltds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cltqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cltds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+
+#define cleqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cleds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cleqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cleds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cleqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cleds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cleqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cleds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+
+#define cgtqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cgtds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cgtqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cgtds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cgtqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cgtds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cgtqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cgtds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+
+#define cgeqs_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cgeds_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cgeqs_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cgeds_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cgeqs3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cgeds3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cgeqs3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cgeds3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* mkj (jump to lb) if (S satisfies mask condition) */
+
+#define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+        EML(W(XS), TmmC)                                                    \
+        mkjdx_rx(EMR(W(XS), TmmC), mask, lb)
+
+/*************   packed double-precision floating-point convert   *************/
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnzqs_rr(XD, XS)     /* round towards zero */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnzds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnzqs_ld(XD, MS, DS) /* round towards zero */                       \
+        rnzds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvzqs_rr(XD, XS)     /* round towards zero */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvzds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvzqs_ld(XD, MS, DS) /* round towards zero */                       \
+        cvzds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnpqs_rr(XD, XS)     /* round towards +inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnpds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnpqs_ld(XD, MS, DS) /* round towards +inf */                       \
+        rnpds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvpqs_rr(XD, XS)     /* round towards +inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvpds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvpqs_ld(XD, MS, DS) /* round towards +inf */                       \
+        cvpds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnmqs_rr(XD, XS)     /* round towards -inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnmds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnmqs_ld(XD, MS, DS) /* round towards -inf */                       \
+        rnmds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvmqs_rr(XD, XS)     /* round towards -inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvmds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvmqs_ld(XD, MS, DS) /* round towards -inf */                       \
+        cvmds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnnqs_rr(XD, XS)     /* round towards near */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnnds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnnqs_ld(XD, MS, DS) /* round towards near */                       \
+        rnnds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvnqs_rr(XD, XS)     /* round towards near */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvnds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvnqs_ld(XD, MS, DS) /* round towards near */                       \
+        cvnds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvnqn_rr(XD, XS)     /* round towards near */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvndn_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvnqn_ld(XD, MS, DS) /* round towards near */                       \
+        cvndn_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: ROUNDZ is not supported on pre-VSX POWER systems, use cvz
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rndqs_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        rndds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rndqs_ld(XD, MS, DS)                                                \
+        rndds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvtqs_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        cvtds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvtqs_ld(XD, MS, DS)                                                \
+        cvtds_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: only default ROUNDN is supported on pre-VSX POWER systems */
+
+#define cvtqn_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        cvtdn_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvtqn_ld(XD, MS, DS)                                                \
+        cvtdn_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
+ * isn't always taken into account when used within full-IEEE ASM block
+ * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
+ * round instructions are only accurate within 64-bit signed int range */
+
+#define rnrqs_rr(XD, XS, mode)                                              \
+        EML(W(XS), TmmD)                                                    \
+        rnrds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), mode)                  \
+        EMS(W(XD), TmmC)
+
+#define cvrqs_rr(XD, XS, mode)                                              \
+        EML(W(XS), TmmD)                                                    \
+        cvrds_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), mode)                  \
+        EMS(W(XD), TmmC)
+
+/************   packed double-precision integer arithmetic/shifts   ***********/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addqx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        adddx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define addqx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        adddx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define addqx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        adddx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define addqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        adddx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subqx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        subdx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define subqx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        subdx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define subqx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        subdx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define subqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        subdx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulqx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        muldx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mulqx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        muldx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mulqx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        muldx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mulqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        muldx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define shlqx_ri(XG, IS)                                                    \
+        EML(W(XG), TmmC)                                                    \
+        shldx_ri(EMR(W(XG), TmmC), W(IS))                                   \
+        EMS(W(XG), TmmC)
+
+#define shlqx_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        EML(W(XG), TmmC)                                                    \
+        shldx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define shlqx3ri(XD, XS, IT)                                                \
+        EML(W(XS), TmmD)                                                    \
+        shldx3ri(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(IT))                 \
+        EMS(W(XD), TmmC)
+
+#define shlqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        shldx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define shrqx_ri(XG, IS)                                                    \
+        EML(W(XG), TmmC)                                                    \
+        shrdx_ri(EMR(W(XG), TmmC), W(IS))                                   \
+        EMS(W(XG), TmmC)
+
+#define shrqx_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        EML(W(XG), TmmC)                                                    \
+        shrdx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define shrqx3ri(XD, XS, IT)                                                \
+        EML(W(XS), TmmD)                                                    \
+        shrdx3ri(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(IT))                 \
+        EMS(W(XD), TmmC)
+
+#define shrqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        shrdx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define shrqn_ri(XG, IS)                                                    \
+        EML(W(XG), TmmC)                                                    \
+        shrdn_ri(EMR(W(XG), TmmC), W(IS))                                   \
+        EMS(W(XG), TmmC)
+
+#define shrqn_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        EML(W(XG), TmmC)                                                    \
+        shrdn_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define shrqn3ri(XD, XS, IT)                                                \
+        EML(W(XS), TmmD)                                                    \
+        shrdn3ri(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(IT))                 \
+        EMS(W(XD), TmmC)
+
+#define shrqn3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        shrdn3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define svlqx_rr(XG, XS)     /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        svldx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define svlqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC)                                                    \
+        svldx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define svlqx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        svldx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define svlqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        svldx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define svrqx_rr(XG, XS)     /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        svrdx_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define svrqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC)                                                    \
+        svrdx_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define svrqx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        svrdx3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define svrqx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        svrdx3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define svrqn_rr(XG, XS)     /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        svrdn_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define svrqn_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC)                                                    \
+        svrdn_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define svrqn3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        svrdn3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define svrqn3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        svrdn3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-64-bit element **** 128-bit ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#endif /* RT_256X1 */
+
+#endif /* RT_SIMD_CODE */
+
+#endif /* RT_RTARCH_X64_256X1V4_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
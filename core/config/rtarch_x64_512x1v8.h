@@ -9,6 +9,7 @@
 
 #include "rtarch_x32_512x1v8.h"
 #include "rtarch_xHB_512x1v8.h"
+#include "rtarch_x32_512x1vP.h"
 
 /******************************************************************************/
 /*********************************   LEGEND   *********************************/
@@ -728,6 +729,54 @@
         cmpwx_ri(Reax, IH(RT_SIMD_MASK_##mask##64_512))                     \
         jeqxx_lb(lb)
 
+/* cps (D = active lanes of S), xpd (G = active lanes from S), RD = count
+ * active lanes of mask XM are moved to k1 for vcompresspd/vexpandpd, which
+ * only access RD elements, overrides generic versions from rtbase.h */
+
+/* #define pc1wx_rr(RD, RS)                (defined in 32_512-bit header) */
+
+#if (RT_ELEMENT == 64)
+
+#undef  cpspx_st
+#define cpspx_st(XS, XM, RD, MD, DD, lb) /* destroys Reax, RD = count */    \
+        ck1qx_rm(W(XM), Mebp, inf_GPC07)                                    \
+        movxx_ri(Reax, IB(0))                                               \
+    ADR EKW(RXB(XS), RXB(MD),    0x00, K, 1, 2) EMITB(0x8A)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)                                        \
+        mk1wx_rx(Reax)                                                      \
+        pc1wx_rr(W(RD), Reax)
+
+#undef  xpdpx_ld
+#define xpdpx_ld(XG, XM, RD, MS, DS, lb) /* destroys Reax, RD = count */    \
+        ck1qx_rm(W(XM), Mebp, inf_GPC07)                                    \
+        movxx_ri(Reax, IB(0))                                               \
+    ADR EKW(RXB(XG), RXB(MS),    0x00, K, 1, 2) EMITB(0x88)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)                                        \
+        mk1wx_rx(Reax)                                                      \
+        pc1wx_rr(W(RD), Reax)
+
+#endif /* RT_ELEMENT == 64 */
+
+/* mkm (D = lane bitmask of mask S), mkc (D = active-lane count of mask S)
+ * mask S is moved to k1, overrides generic versions from rtbase.h */
+
+#if (RT_ELEMENT == 64)
+
+#undef  mkmpx_rx
+#define mkmpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane bits */        \
+        ck1qx_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(W(RD))
+
+#undef  mkcpx_rx
+#define mkcpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane count */       \
+        ck1qx_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(Reax)                                                      \
+        pc1wx_rr(W(RD), Reax)
+
+#endif /* RT_ELEMENT == 64 */
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1052,6 +1101,46 @@
 
 #endif /* RT_512X1 == 2, 8 */
 
+/************   packed double-precision rounding-mode arithmetic   ************/
+
+/* add/sub/mul/div (D = S op T), sqr (D = sqrt S), cvr (D = int-to-fp S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * overrides generic versions from rtbase.h, which write fp control register */
+
+#undef  addqsRrr
+#define addqsRrr(XD, XS, XT, mode)                                          \
+        ERW(RXB(XD), RXB(XT), REN(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x58) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  subqsRrr
+#define subqsRrr(XD, XS, XT, mode)                                          \
+        ERW(RXB(XD), RXB(XT), REN(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5C) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  mulqsRrr
+#define mulqsRrr(XD, XS, XT, mode)                                          \
+        ERW(RXB(XD), RXB(XT), REN(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x59) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  divqsRrr
+#define divqsRrr(XD, XS, XT, mode)                                          \
+        ERW(RXB(XD), RXB(XT), REN(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5E) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  sqrqsRrr
+#define sqrqsRrr(XD, XS, mode)                                              \
+        ERW(RXB(XD), RXB(XS),    0x00, RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x51) MRM(REG(XD), MOD(XS), REG(XS))
+
+#if (RT_512X1 == 2 || RT_512X1 == 8)
+
+#undef  cvrqn_rr
+#define cvrqn_rr(XD, XS, mode)                                              \
+        ERW(RXB(XD), RXB(XS),    0x00, RT_SIMD_MODE_##mode&3, 2, 1)         \
+        EMITB(0xE6) MRM(REG(XD), MOD(XS), REG(XS))
+
+#endif /* RT_512X1 == 2, 8 */
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
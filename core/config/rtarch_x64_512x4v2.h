@@ -1885,6 +1885,82 @@
 
 #endif /* RT_512X4 >= 2 */
 
+/************   packed double-precision rounding-mode arithmetic   ************/
+
+/* add/sub/mul/div (D = S op T), sqr (D = sqrt S), cvr (D = int-to-fp S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * overrides generic versions from rtbase.h, which write fp control register */
+
+#undef  addqsRrr
+#define addqsRrr(XD, XS, XT, mode)                                          \
+        ERW(0,             0, REG(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x58) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(1,             1, REH(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x58) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(2,             2, REI(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x58) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(3,             3, REJ(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x58) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  subqsRrr
+#define subqsRrr(XD, XS, XT, mode)                                          \
+        ERW(0,             0, REG(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5C) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(1,             1, REH(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5C) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(2,             2, REI(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5C) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(3,             3, REJ(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5C) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  mulqsRrr
+#define mulqsRrr(XD, XS, XT, mode)                                          \
+        ERW(0,             0, REG(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x59) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(1,             1, REH(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x59) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(2,             2, REI(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x59) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(3,             3, REJ(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x59) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  divqsRrr
+#define divqsRrr(XD, XS, XT, mode)                                          \
+        ERW(0,             0, REG(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5E) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(1,             1, REH(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5E) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(2,             2, REI(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5E) MRM(REG(XD), MOD(XT), REG(XT))                          \
+        ERW(3,             3, REJ(XS), RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x5E) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  sqrqsRrr
+#define sqrqsRrr(XD, XS, mode)                                              \
+        ERW(0,             0,    0x00, RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x51) MRM(REG(XD), MOD(XS), REG(XS))                          \
+        ERW(1,             1,    0x00, RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x51) MRM(REG(XD), MOD(XS), REG(XS))                          \
+        ERW(2,             2,    0x00, RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x51) MRM(REG(XD), MOD(XS), REG(XS))                          \
+        ERW(3,             3,    0x00, RT_SIMD_MODE_##mode&3, 1, 1)         \
+        EMITB(0x51) MRM(REG(XD), MOD(XS), REG(XS))
+
+#if (RT_512X4 >= 2)
+
+#undef  cvrqn_rr
+#define cvrqn_rr(XD, XS, mode)                                              \
+        ERW(0,             0,    0x00, RT_SIMD_MODE_##mode&3, 2, 1)         \
+        EMITB(0xE6) MRM(REG(XD), MOD(XS), REG(XS))                          \
+        ERW(1,             1,    0x00, RT_SIMD_MODE_##mode&3, 2, 1)         \
+        EMITB(0xE6) MRM(REG(XD), MOD(XS), REG(XS))                          \
+        ERW(2,             2,    0x00, RT_SIMD_MODE_##mode&3, 2, 1)         \
+        EMITB(0xE6) MRM(REG(XD), MOD(XS), REG(XS))                          \
+        ERW(3,             3,    0x00, RT_SIMD_MODE_##mode&3, 2, 1)         \
+        EMITB(0xE6) MRM(REG(XD), MOD(XS), REG(XS))
+
+#endif /* RT_512X4 >= 2 */
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
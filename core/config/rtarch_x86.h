@@ -1449,6 +1449,39 @@
         orrwx_rr(Resi, Recx)                                                \
         movwx_st(Resi, Mebp, inf_VER)
 
+/* tsc (D = timestamp counter, lower 32-bit)
+ * set-flags: no
+ * reads RDTSC (constant-rate TSC), preserves Reax/Redx via stack */
+
+#define tscwx_rx(RD)                                                        \
+        EMITB(0x50) EMITB(0x52)           /* <- push eax, push edx */       \
+        EMITB(0x0F) EMITB(0x31)           /* <- rdtsc to edx:eax */         \
+        EMITB(0x87)                       /* <- xchg eax, [esp+4] */        \
+        MRM(0x00,    0x01,    0x04) EMITB(0x24) EMITB(0x04)                 \
+        EMITB(0x5A)                       /* <- pop edx */                  \
+        stack_ld(W(RD))                   /* <- pop RD (stamp) */
+
+/* fps (D = fp status flags), clears sticky flags in MXCSR
+ * set-flags: undefined
+ * uses inf_SCR02(0) as scratch, flags are MXCSR bits [5:0] (PE UE OE ZE DE IE) */
+
+#define fpswx_rx(RD)                                                        \
+        fpswx_st(Mebp,  inf_SCR02(0))                                       \
+        movwx_ld(W(RD), Mebp,  inf_SCR02(0))                                \
+        andwx_mi(Mebp,  inf_SCR02(0), IV(0xFFFFFFC0))                       \
+        fpswx_ld(Mebp,  inf_SCR02(0))                                       \
+        andwx_ri(W(RD), IB(0x3F))
+
+#define fpswx_ld(MS, DS) /* not portable, do not use outside */             \
+        EMITB(0x0F) EMITB(0xAE)                                             \
+        MRM(0x02,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define fpswx_st(MD, DD) /* not portable, do not use outside */             \
+        EMITB(0x0F) EMITB(0xAE)                                             \
+        MRM(0x03,    MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /************************* address-sized instructions *************************/
 
 /* adr (D = adr S)
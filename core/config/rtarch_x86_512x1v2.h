@@ -938,6 +938,42 @@
         ERX(0x00,    RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x5B)               \
         MRM(REG(XD), MOD(XS), REG(XS))
 
+/************   packed single-precision rounding-mode arithmetic   ************/
+
+/* add/sub/mul/div (D = S op T), sqr (D = sqrt S), cvr (D = int-to-fp S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * overrides generic versions from rtbase.h, which write fp control register */
+
+#undef  addosRrr
+#define addosRrr(XD, XS, XT, mode)                                          \
+        ERX(REG(XS), RT_SIMD_MODE_##mode&3, 0, 1)                           \
+        EMITB(0x58) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  subosRrr
+#define subosRrr(XD, XS, XT, mode)                                          \
+        ERX(REG(XS), RT_SIMD_MODE_##mode&3, 0, 1)                           \
+        EMITB(0x5C) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  mulosRrr
+#define mulosRrr(XD, XS, XT, mode)                                          \
+        ERX(REG(XS), RT_SIMD_MODE_##mode&3, 0, 1)                           \
+        EMITB(0x59) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  divosRrr
+#define divosRrr(XD, XS, XT, mode)                                          \
+        ERX(REG(XS), RT_SIMD_MODE_##mode&3, 0, 1)                           \
+        EMITB(0x5E) MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  sqrosRrr
+#define sqrosRrr(XD, XS, mode)                                              \
+        ERX(0x00,    RT_SIMD_MODE_##mode&3, 0, 1)                           \
+        EMITB(0x51) MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvron_rr
+#define cvron_rr(XD, XS, mode)                                              \
+        ERX(0x00,    RT_SIMD_MODE_##mode&3, 0, 1)                           \
+        EMITB(0x5B) MRM(REG(XD), MOD(XS), REG(XS))
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
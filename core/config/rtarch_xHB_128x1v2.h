@@ -440,6 +440,131 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/***************   packed half-precision integer dot-products   ***************/
+
+#if (RT_SIMD_COMPAT_DOT == 0)
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed
+ * native AVX512-VNNI form, no register restrictions apply in practice */
+
+#undef  dphin_rr
+#define dphin_rr(XG, XS, XT)                                                \
+        EVX(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0x52)                 \
+        MRM(REG(XG), MOD(XT), REG(XT))
+
+#undef  dphin_ld
+#define dphin_ld(XG, XS, MT, DT)                                            \
+    ADR EVX(RXB(XG), RXB(MT), REN(XS), 0, 1, 2) EMITB(0x52)                 \
+        MRM(REG(XG), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#else /* RT_SIMD_COMPAT_DOT != 0 */
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed */
+
+#undef  dphin_rr
+#define dphin_rr(XG, XS, XT)                                                \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        mahix3rr(W(XG), W(XS), W(XT))                                       \
+        addix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  dphin_ld
+#define dphin_ld(XG, XS, MT, DT)                                            \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        mahix3ld(W(XG), W(XS), W(MT), W(DT))                                \
+        addix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_DOT != 0 */
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, signed
+ * odd/even bytes are widened to halves, then combined via pmaddwd */
+
+#undef  dpbin_rr
+#define dpbin_rr(XG, XS, XT)                                                \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrgn3ri(W(XG), W(XS), IB(8))                                       \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrgn3ri(W(XG), W(XT), IB(8))                                       \
+        mahix3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlgx3ri(W(XG), W(XS), IB(8))                                       \
+        shrgn_ri(W(XG), IB(8))                                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlgx3ri(W(XG), W(XT), IB(8))                                       \
+        shrgn_ri(W(XG), IB(8))                                              \
+        mahix3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  dpbin_ld
+#define dpbin_ld(XG, XS, MT, DT)                                            \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrgn3ri(W(XG), W(XS), IB(8))                                       \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), W(MT), W(DT))                                       \
+        shrgn_ri(W(XG), IB(8))                                              \
+        mahix3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlgx3ri(W(XG), W(XS), IB(8))                                       \
+        shrgn_ri(W(XG), IB(8))                                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), W(MT), W(DT))                                       \
+        shlgx_ri(W(XG), IB(8))                                              \
+        shrgn_ri(W(XG), IB(8))                                              \
+        mahix3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addix_ld(W(XG), Mebp, inf_SCR01(0))
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, unsigned
+ * odd/even bytes are widened to halves, then combined via pmaddwd */
+
+#undef  dpbix_rr
+#define dpbix_rr(XG, XS, XT)                                                \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrgx3ri(W(XG), W(XS), IB(8))                                       \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrgx3ri(W(XG), W(XT), IB(8))                                       \
+        mahix3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlgx3ri(W(XG), W(XS), IB(8))                                       \
+        shrgx_ri(W(XG), IB(8))                                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlgx3ri(W(XG), W(XT), IB(8))                                       \
+        shrgx_ri(W(XG), IB(8))                                              \
+        mahix3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  dpbix_ld
+#define dpbix_ld(XG, XS, MT, DT)                                            \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrgx3ri(W(XG), W(XS), IB(8))                                       \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), W(MT), W(DT))                                       \
+        shrgx_ri(W(XG), IB(8))                                              \
+        mahix3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlgx3ri(W(XG), W(XS), IB(8))                                       \
+        shrgx_ri(W(XG), IB(8))                                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), W(MT), W(DT))                                       \
+        shlgx_ri(W(XG), IB(8))                                              \
+        shrgx_ri(W(XG), IB(8))                                              \
+        mahix3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addix_ld(W(XG), Mebp, inf_SCR01(0))
+
+/* mah (D = S * T) - half-pairs, signed (pmaddwd), internal use only */
+
+#define mahix3rr(XD, XS, XT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XT), REN(XS), 0, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define mahix3ld(XD, XS, MT, DT) /* not portable, do not use */             \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), 0, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -846,6 +846,115 @@
         shrhn_mx(Mebp,  inf_SCR01(0x1E))                                    \
         stack_ld(Recx)
 
+/***************   packed half-precision integer dot-products   ***************/
+
+#if (RT_256X1 >= 2)
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed */
+
+#undef  dphcn_rr
+#define dphcn_rr(XG, XS, XT)                                                \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        mahcx3rr(W(XG), W(XS), W(XT))                                       \
+        addcx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  dphcn_ld
+#define dphcn_ld(XG, XS, MT, DT)                                            \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        mahcx3ld(W(XG), W(XS), W(MT), W(DT))                                \
+        addcx_ld(W(XG), Mebp, inf_SCR01(0))
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, signed
+ * odd/even bytes are widened to halves, then combined via pmaddwd */
+
+#undef  dpbcn_rr
+#define dpbcn_rr(XG, XS, XT)                                                \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shran3ri(W(XG), W(XS), IB(8))                                       \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shran3ri(W(XG), W(XT), IB(8))                                       \
+        mahcx3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlax3ri(W(XG), W(XS), IB(8))                                       \
+        shran_ri(W(XG), IB(8))                                              \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlax3ri(W(XG), W(XT), IB(8))                                       \
+        shran_ri(W(XG), IB(8))                                              \
+        mahcx3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  dpbcn_ld
+#define dpbcn_ld(XG, XS, MT, DT)                                            \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shran3ri(W(XG), W(XS), IB(8))                                       \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), W(MT), W(DT))                                       \
+        shran_ri(W(XG), IB(8))                                              \
+        mahcx3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlax3ri(W(XG), W(XS), IB(8))                                       \
+        shran_ri(W(XG), IB(8))                                              \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), W(MT), W(DT))                                       \
+        shlax_ri(W(XG), IB(8))                                              \
+        shran_ri(W(XG), IB(8))                                              \
+        mahcx3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR01(0))
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, unsigned
+ * odd/even bytes are widened to halves, then combined via pmaddwd */
+
+#undef  dpbcx_rr
+#define dpbcx_rr(XG, XS, XT)                                                \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrax3ri(W(XG), W(XS), IB(8))                                       \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrax3ri(W(XG), W(XT), IB(8))                                       \
+        mahcx3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlax3ri(W(XG), W(XS), IB(8))                                       \
+        shrax_ri(W(XG), IB(8))                                              \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlax3ri(W(XG), W(XT), IB(8))                                       \
+        shrax_ri(W(XG), IB(8))                                              \
+        mahcx3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  dpbcx_ld
+#define dpbcx_ld(XG, XS, MT, DT)                                            \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrax3ri(W(XG), W(XS), IB(8))                                       \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), W(MT), W(DT))                                       \
+        shrax_ri(W(XG), IB(8))                                              \
+        mahcx3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlax3ri(W(XG), W(XS), IB(8))                                       \
+        shrax_ri(W(XG), IB(8))                                              \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), W(MT), W(DT))                                       \
+        shlax_ri(W(XG), IB(8))                                              \
+        shrax_ri(W(XG), IB(8))                                              \
+        mahcx3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR01(0))
+
+/* mah (D = S * T) - half-pairs, signed (pmaddwd), internal use only */
+
+#define mahcx3rr(XD, XS, XT) /* not portable, do not use outside */         \
+        VEX(RXB(XD), RXB(XT), REN(XS), 1, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define mahcx3ld(XD, XS, MT, DT) /* not portable, do not use */             \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
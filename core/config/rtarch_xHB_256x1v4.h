@@ -0,0 +1,1046 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTARCH_XHB_256X1V4_H
+#define RT_RTARCH_XHB_256X1V4_H
+
+#include "rtarch_x32_256x1v4.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtarch_xHB_256x1v4.h: Implementation of x86_64 half+byte AVX1/2 30-regs emul.
+ *
+ * This file is a part of the unified SIMD assembler framework (rtarch.h)
+ * designed to be compatible with different processor architectures,
+ * while maintaining strictly defined common API.
+ *
+ * Recommended naming scheme for instructions:
+ *
+ * cmda*_rx - applies [cmd] to 256-bit packed-half: [r]egister (one operand)
+ * cmda*_rr - applies [cmd] to 256-bit packed-half: [r]egister from [r]egister
+ *
+ * cmda*_rm - applies [cmd] to 256-bit packed-half: [r]egister from [m]emory
+ * cmda*_ld - applies [cmd] to 256-bit packed-half: as above (friendly alias)
+ *
+ * Register offloading for var-len fp16 subset (cmdm*) is implemented here
+ * on top of the fp32 target (rtarch_x32_256x1v4.h), refer to it for details
+ * on the fixed bottom-up register partition and its compile-time checks.
+ *
+ * Interpretation of instruction parameters:
+ *
+ * upper-case params have triplet structure and require W to pass-forward
+ * lower-case params are singular and can be used/passed as such directly
+ *
+ * XD - SIMD register serving as destination only, if present
+ * XG - SIMD register serving as destination and first source
+ * XS - SIMD register serving as second source (first if any)
+ * XT - SIMD register serving as third source (second if any)
+ *
+ * RD - BASE register serving as destination only, if present
+ * RG - BASE register serving as destination and first source
+ * RS - BASE register serving as second source (first if any)
+ * RT - BASE register serving as third source (second if any)
+ *
+ * MD - BASE addressing mode (Oeax, M***, I***) (memory-dest)
+ * MG - BASE addressing mode (Oeax, M***, I***) (memory-dsrc)
+ * MS - BASE addressing mode (Oeax, M***, I***) (memory-src2)
+ * MT - BASE addressing mode (Oeax, M***, I***) (memory-src3)
+ *
+ * DD - displacement value (DP, DF, DG, DH, DV) (memory-dest)
+ * DG - displacement value (DP, DF, DG, DH, DV) (memory-dsrc)
+ * DS - displacement value (DP, DF, DG, DH, DV) (memory-src2)
+ * DT - displacement value (DP, DF, DG, DH, DV) (memory-src3)
+ *
+ * IS - immediate value (is used as a second or first source)
+ * IT - immediate value (is used as a third or second source)
+ */
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#if (defined RT_SIMD_CODE)
+
+#if (RT_256X1 == 4)
+
+/******************************************************************************/
+/********************************   EXTERNAL   ********************************/
+/******************************************************************************/
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-16-bit element **** 256-bit ***/
+/******************************************************************************/
+
+/* elm (D = S), store first SIMD element with natural alignment
+ * allows to decouple scalar subset from SIMD where appropriate */
+
+#define elmmx_st(XS, MD, DD) /* 1st elem as in mem with SIMD load/store */  \
+        EML(W(XS), TmmC)                                                    \
+        elmax_st(EMR(W(XS), TmmC), W(MD), W(DD))
+
+/****************   packed half-precision generic move/logic   ****************/
+
+/* mov (D = S) */
+
+#define movmx_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        movax_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define movmx_ld(XD, MS, DS)                                                \
+        movax_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define movmx_st(XS, MD, DD)                                                \
+        EML(W(XS), TmmC)                                                    \
+        movax_st(EMR(W(XS), TmmC), W(MD), W(DD))
+
+/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
+ * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
+
+#define mmvmx_rr(XD, XS)                                                    \
+        EML(W(XD), TmmC) EML(W(XS), TmmD)                                   \
+        mmvax_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define mmvmx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mmvax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mmvmx_st(XS, MG, DG)                                                \
+        EML(W(XS), TmmC)                                                    \
+        mmvax_st(EMR(W(XS), TmmC), W(MG), W(DG))
+
+/* and (G = G & S), (D = S & T) if (#D != #S) */
+
+#define andmx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        andax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define andmx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        andax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define andmx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        andax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define andmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        andax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+
+#define annmx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        annax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define annmx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        annax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define annmx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        annax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define annmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        annax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* orr (G = G | S), (D = S | T) if (#D != #S) */
+
+#define orrmx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        orrax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define orrmx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        orrax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define orrmx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        orrax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define orrmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        orrax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+
+#define ornmx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        ornax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define ornmx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        ornax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define ornmx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        ornax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define ornmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        ornax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+
+#define xormx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        xorax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define xormx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        xorax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define xormx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        xorax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define xormx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        xorax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* not (G = ~G), (D = ~S) */
+
+#define notmx_rx(XG)                                                        \
+        EML(W(XG), TmmC)                                                    \
+        notax_rx(EMR(W(XG), TmmC))                                          \
+        EMS(W(XG), TmmC)
+
+#define notmx_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        notax_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+/*************   packed half-precision floating-point arithmetic   ************/
+
+/* neg (G = -G), (D = -S) */
+
+#define negms_rx(XG)                                                        \
+        EML(W(XG), TmmC)                                                    \
+        negas_rx(EMR(W(XG), TmmC))                                          \
+        EMS(W(XG), TmmC)
+
+#define negms_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        negas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addms_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        addas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define addms_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        addas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define addms3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        addas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define addms3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        addas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subms_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        subas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define subms_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        subas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define subms3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        subas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define subms3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        subas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulms_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mulas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mulms_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mulas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mulms3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mulas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mulms3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mulas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* div (G = G / S), (D = S / T) if (#D != #S) */
+
+#define divms_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        divas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define divms_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        divas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define divms3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        divas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define divms3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        divas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* sqr (D = sqrt S) */
+
+#define sqrms_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        sqras_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define sqrms_ld(XD, MS, DS)                                                \
+        sqras_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* rcp (D = 1.0 / S) */
+
+#define rcems_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        rceas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rcsms_rr(XG, XS) /* destroys XS */                                  \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        rcsas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+/* rsq (D = 1.0 / sqrt S) */
+
+#define rsems_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        rseas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rssms_rr(XG, XS) /* destroys XS */                                  \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        rssas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T) */
+
+#define fmams_rr(XG, XS, XT)                                                \
+        EML(W(XG), TmmC) EML(W(XS), TmmD) EML(W(XT), TmmE)                  \
+        fmaas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XG), TmmC)
+
+#define fmams_ld(XG, XS, MT, DT)                                            \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        fmaas_ld(EMR(W(XG), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XG), TmmC)
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T) */
+
+#define fmsms_rr(XG, XS, XT)                                                \
+        EML(W(XG), TmmC) EML(W(XS), TmmD) EML(W(XT), TmmE)                  \
+        fmsas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XG), TmmC)
+
+#define fmsms_ld(XG, XS, MT, DT)                                            \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        fmsas_ld(EMR(W(XG), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XG), TmmC)
+
+/**************   packed half-precision floating-point compare   **************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+
+#define minms_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        minas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define minms_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        minas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define minms3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        minas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define minms3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        minas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+
+#define maxms_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        maxas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define maxms_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        maxas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define maxms3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        maxas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define maxms3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        maxas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqms_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        ceqas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define ceqms_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        ceqas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define ceqms3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        ceqas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define ceqms3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        ceqas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#define cnems_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cneas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cnems_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cneas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cnems3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cneas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cnems3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cneas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+
+#define cltms_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cltas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cltms_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cltas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cltms3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cltas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cltms3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cltas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+
+#define clems_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cleas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define clems_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cleas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define clems3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cleas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define clems3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cleas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+
+#define cgtms_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cgtas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cgtms_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cgtas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cgtms3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cgtas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cgtms3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cgtas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+
+#define cgems_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        cgeas_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define cgems_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        cgeas_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define cgems3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        cgeas3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define cgems3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        cgeas3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* mkj (jump to lb) if (S satisfies mask condition) */
+
+#define mkjmx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+        EML(W(XS), TmmC)                                                    \
+        mkjax_rx(EMR(W(XS), TmmC), mask, lb)
+
+/**************   packed half-precision floating-point convert   **************/
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks) */
+
+#define rnzms_rr(XD, XS)     /* round towards zero */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnzas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnzms_ld(XD, MS, DS) /* round towards zero */                       \
+        rnzas_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvzms_rr(XD, XS)     /* round towards zero */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvzas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvzms_ld(XD, MS, DS) /* round towards zero */                       \
+        cvzas_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks) */
+
+#define rnpms_rr(XD, XS)     /* round towards +inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnpas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnpms_ld(XD, MS, DS) /* round towards +inf */                       \
+        rnpas_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvpms_rr(XD, XS)     /* round towards +inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvpas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvpms_ld(XD, MS, DS) /* round towards +inf */                       \
+        cvpas_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks) */
+
+#define rnmms_rr(XD, XS)     /* round towards -inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnmas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnmms_ld(XD, MS, DS) /* round towards -inf */                       \
+        rnmas_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvmms_rr(XD, XS)     /* round towards -inf */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvmas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvmms_ld(XD, MS, DS) /* round towards -inf */                       \
+        cvmas_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks) */
+
+#define rnnms_rr(XD, XS)     /* round towards near */                       \
+        EML(W(XS), TmmD)                                                    \
+        rnnas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rnnms_ld(XD, MS, DS) /* round towards near */                       \
+        rnnas_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvnms_rr(XD, XS)     /* round towards near */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvnas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvnms_ld(XD, MS, DS) /* round towards near */                       \
+        cvnas_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvnmn_rr(XD, XS)     /* round towards near */                       \
+        EML(W(XS), TmmD)                                                    \
+        cvnan_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvnmn_ld(XD, MS, DS) /* round towards near */                       \
+        cvnan_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from control register (set in FCTRL blocks) */
+
+#define rndms_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        rndas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define rndms_ld(XD, MS, DS)                                                \
+        rndas_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+#define cvtms_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        cvtas_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvtms_ld(XD, MS, DS)                                                \
+        cvtas_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from control register (set in FCTRL blocks) */
+
+#define cvtmn_rr(XD, XS)                                                    \
+        EML(W(XS), TmmD)                                                    \
+        cvtan_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XD), TmmC)
+
+#define cvtmn_ld(XD, MS, DS)                                                \
+        cvtan_ld(EMR(W(XD), TmmC), W(MS), W(DS))                            \
+        EMS(W(XD), TmmC)
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks) */
+
+#define rnrms_rr(XD, XS, mode)                                              \
+        EML(W(XS), TmmD)                                                    \
+        rnras_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), mode)                  \
+        EMS(W(XD), TmmC)
+
+#define cvrms_rr(XD, XS, mode)                                              \
+        EML(W(XS), TmmD)                                                    \
+        cvras_rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), mode)                  \
+        EMS(W(XD), TmmC)
+
+/*************   packed half-precision integer arithmetic/shifts   ************/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addmx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        addax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define addmx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        addax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define addmx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        addax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define addmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        addax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, unsigned */
+
+#define adsmx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        adsax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define adsmx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        adsax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define adsmx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        adsax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define adsmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        adsax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* ads (G = G + S), (D = S + T) if (#D != #S) - saturate, signed */
+
+#define adsmn_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        adsan_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define adsmn_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        adsan_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define adsmn3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        adsan3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define adsmn3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        adsan3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define submx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        subax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define submx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        subax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define submx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        subax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define submx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        subax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, unsigned */
+
+#define sbsmx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        sbsax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define sbsmx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        sbsax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define sbsmx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        sbsax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define sbsmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        sbsax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* sbs (G = G - S), (D = S - T) if (#D != #S) - saturate, signed */
+
+#define sbsmn_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        sbsan_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define sbsmn_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        sbsan_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define sbsmn3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        sbsan3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define sbsmn3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        sbsan3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulmx_rr(XG, XS)                                                    \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        mulax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define mulmx_ld(XG, MS, DS)                                                \
+        EML(W(XG), TmmC)                                                    \
+        mulax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define mulmx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        mulax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define mulmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        mulax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define shlmx_ri(XG, IS)                                                    \
+        EML(W(XG), TmmC)                                                    \
+        shlax_ri(EMR(W(XG), TmmC), W(IS))                                   \
+        EMS(W(XG), TmmC)
+
+#define shlmx_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        EML(W(XG), TmmC)                                                    \
+        shlax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define shlmx3ri(XD, XS, IT)                                                \
+        EML(W(XS), TmmD)                                                    \
+        shlax3ri(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(IT))                 \
+        EMS(W(XD), TmmC)
+
+#define shlmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        shlax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define shrmx_ri(XG, IS)                                                    \
+        EML(W(XG), TmmC)                                                    \
+        shrax_ri(EMR(W(XG), TmmC), W(IS))                                   \
+        EMS(W(XG), TmmC)
+
+#define shrmx_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        EML(W(XG), TmmC)                                                    \
+        shrax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define shrmx3ri(XD, XS, IT)                                                \
+        EML(W(XS), TmmD)                                                    \
+        shrax3ri(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(IT))                 \
+        EMS(W(XD), TmmC)
+
+#define shrmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        shrax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define shrmn_ri(XG, IS)                                                    \
+        EML(W(XG), TmmC)                                                    \
+        shran_ri(EMR(W(XG), TmmC), W(IS))                                   \
+        EMS(W(XG), TmmC)
+
+#define shrmn_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        EML(W(XG), TmmC)                                                    \
+        shran_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define shrmn3ri(XD, XS, IT)                                                \
+        EML(W(XS), TmmD)                                                    \
+        shran3ri(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(IT))                 \
+        EMS(W(XD), TmmC)
+
+#define shrmn3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        shran3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define svlmx_rr(XG, XS)     /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        svlax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define svlmx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC)                                                    \
+        svlax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define svlmx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        svlax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define svlmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        svlax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define svrmx_rr(XG, XS)     /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        svrax_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define svrmx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC)                                                    \
+        svrax_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define svrmx3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        svrax3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define svrmx3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        svrax3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
+ * for maximum compatibility: shift count must be modulo elem-size */
+
+#define svrmn_rr(XG, XS)     /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC) EML(W(XS), TmmD)                                   \
+        svran_rr(EMR(W(XG), TmmC), EMR(W(XS), TmmD))                        \
+        EMS(W(XG), TmmC)
+
+#define svrmn_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        EML(W(XG), TmmC)                                                    \
+        svran_ld(EMR(W(XG), TmmC), W(MS), W(DS))                            \
+        EMS(W(XG), TmmC)
+
+#define svrmn3rr(XD, XS, XT)                                                \
+        EML(W(XS), TmmD) EML(W(XT), TmmE)                                   \
+        svran3rr(EMR(W(XD), TmmC), EMR(W(XS), TmmD), EMR(W(XT), TmmE))      \
+        EMS(W(XD), TmmC)
+
+#define svrmn3ld(XD, XS, MT, DT)                                            \
+        EML(W(XS), TmmD)                                                    \
+        svran3ld(EMR(W(XD), TmmC), EMR(W(XS), TmmD), W(MT), W(DT))          \
+        EMS(W(XD), TmmC)
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-16-bit element **** 128-bit ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#endif /* RT_256X1 */
+
+#endif /* RT_SIMD_CODE */
+
+#endif /* RT_RTARCH_XHB_256X1V4_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -1024,6 +1024,135 @@
 
 #endif /* RT_512X1 == 2, 8 */
 
+/***************   packed half-precision integer dot-products   ***************/
+
+#if (RT_512X1 == 2 || RT_512X1 == 8)
+
+#if (RT_SIMD_COMPAT_DOT == 0)
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed
+ * native AVX512-VNNI form, no register restrictions apply in practice */
+
+#undef  dphon_rr
+#define dphon_rr(XG, XS, XT)                                                \
+        EVX(RXB(XG), RXB(XT), REN(XS), K, 1, 2) EMITB(0x52)                 \
+        MRM(REG(XG), MOD(XT), REG(XT))
+
+#undef  dphon_ld
+#define dphon_ld(XG, XS, MT, DT)                                            \
+    ADR EVX(RXB(XG), RXB(MT), REN(XS), K, 1, 2) EMITB(0x52)                 \
+        MRM(REG(XG), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#else /* RT_SIMD_COMPAT_DOT != 0 */
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed */
+
+#undef  dphon_rr
+#define dphon_rr(XG, XS, XT)                                                \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        mahox3rr(W(XG), W(XS), W(XT))                                       \
+        addox_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  dphon_ld
+#define dphon_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        mahox3ld(W(XG), W(XS), W(MT), W(DT))                                \
+        addox_ld(W(XG), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_DOT != 0 */
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, signed
+ * odd/even bytes are widened to halves, then combined via pmaddwd */
+
+#undef  dpbon_rr
+#define dpbon_rr(XG, XS, XT)                                                \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrmn3ri(W(XG), W(XS), IB(8))                                       \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrmn3ri(W(XG), W(XT), IB(8))                                       \
+        mahox3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlmx3ri(W(XG), W(XS), IB(8))                                       \
+        shrmn_ri(W(XG), IB(8))                                              \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlmx3ri(W(XG), W(XT), IB(8))                                       \
+        shrmn_ri(W(XG), IB(8))                                              \
+        mahox3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  dpbon_ld
+#define dpbon_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrmn3ri(W(XG), W(XS), IB(8))                                       \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XG), W(MT), W(DT))                                       \
+        shrmn_ri(W(XG), IB(8))                                              \
+        mahox3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlmx3ri(W(XG), W(XS), IB(8))                                       \
+        shrmn_ri(W(XG), IB(8))                                              \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XG), W(MT), W(DT))                                       \
+        shlmx_ri(W(XG), IB(8))                                              \
+        shrmn_ri(W(XG), IB(8))                                              \
+        mahox3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR01(0))
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, unsigned
+ * odd/even bytes are widened to halves, then combined via pmaddwd */
+
+#undef  dpbox_rr
+#define dpbox_rr(XG, XS, XT)                                                \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrmx3ri(W(XG), W(XS), IB(8))                                       \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrmx3ri(W(XG), W(XT), IB(8))                                       \
+        mahox3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlmx3ri(W(XG), W(XS), IB(8))                                       \
+        shrmx_ri(W(XG), IB(8))                                              \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlmx3ri(W(XG), W(XT), IB(8))                                       \
+        shrmx_ri(W(XG), IB(8))                                              \
+        mahox3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  dpbox_ld
+#define dpbox_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrmx3ri(W(XG), W(XS), IB(8))                                       \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XG), W(MT), W(DT))                                       \
+        shrmx_ri(W(XG), IB(8))                                              \
+        mahox3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlmx3ri(W(XG), W(XS), IB(8))                                       \
+        shrmx_ri(W(XG), IB(8))                                              \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XG), W(MT), W(DT))                                       \
+        shlmx_ri(W(XG), IB(8))                                              \
+        shrmx_ri(W(XG), IB(8))                                              \
+        mahox3ld(W(XG), W(XG), Mebp, inf_SCR02(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR01(0))
+
+/* mah (D = S * T) - half-pairs, signed (pmaddwd), internal use only */
+
+#define mahox3rr(XD, XS, XT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define mahox3ld(XD, XS, MT, DT) /* not portable, do not use */             \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#endif /* RT_512X1 == 2, 8 */
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
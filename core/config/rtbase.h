@@ -10,6 +10,8 @@
 #include <math.h>
 #include <float.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
 
 #include "rtzero.h"
 
@@ -70,11 +72,21 @@
 /**** 256-bit **** (horizontal SIMD) with fixed-64-bit element ****************/
 /**** 128-bit **** (horizontal SIMD) with fixed-64-bit element ****************/
 
+/**** var-len **** (dot-product SIMD) with fixed-32-bit element ***************/
+/**** 256-bit **** (dot-product SIMD) with fixed-32-bit element ***************/
+/**** 128-bit **** (dot-product SIMD) with fixed-32-bit element ***************/
+
+/**** var-len **** (rounding-mode SIMD) with fixed-32-bit element *************/
+/**** var-len **** (rounding-mode SIMD) with fixed-64-bit element *************/
+
 /************************   COMMON BASE INSTRUCTIONS   ************************/
 
 /***************** original forms of deprecated cmdx* aliases *****************/
 /***************** original forms of one-operand instructions *****************/
 /***************** original forms of deprecated cmd*z aliases *****************/
+/******************* timestamp region accumulators (32-bit) *******************/
+/******************** mask-jump site profiling (optional) *********************/
+/******************** fp status flags capture (optional) **********************/
 
 /*********************************   CONFIG   *********************************/
 
@@ -563,6 +575,8 @@ typedef const char         *rt_pstr;
 
 #define RT_CEIL32(a)        (ceilf(a))
 
+#define RT_NEXT32(a, b)     (nextafterf(a, b))
+
 #define RT_SIGN32(a)        ((a)  <    0.0f ? -1 :                          \
                              (a)  >    0.0f ? +1 :                          \
                               0)
@@ -609,6 +623,8 @@ typedef const char         *rt_pstr;
 
 #define RT_CEIL64(a)        (ceil(a))
 
+#define RT_NEXT64(a, b)     (nextafter(a, b))
+
 #define RT_SIGN64(a)        ((a)  <    0.0 ? -1 :                           \
                              (a)  >    0.0 ? +1 :                           \
                               0)
@@ -651,6 +667,7 @@ typedef const char         *rt_pstr;
 #define RT_FABS(a)          RT_FABS32(a)
 #define RT_FLOOR(a)         RT_FLOOR32(a)
 #define RT_CEIL(a)          RT_CEIL32(a)
+#define RT_NEXT(a, b)       RT_NEXT32(a, b)
 #define RT_SIGN(a)          RT_SIGN32(a)
 #define RT_POW(a, b)        RT_POW32(a, b)
 #define RT_SQRT(a)          RT_SQRT32(a)
@@ -666,6 +683,7 @@ typedef const char         *rt_pstr;
 #define RT_FABS(a)          RT_FABS64(a)
 #define RT_FLOOR(a)         RT_FLOOR64(a)
 #define RT_CEIL(a)          RT_CEIL64(a)
+#define RT_NEXT(a, b)       RT_NEXT64(a, b)
 #define RT_SIGN(a)          RT_SIGN64(a)
 #define RT_POW(a, b)        RT_POW64(a, b)
 #define RT_SQRT(a)          RT_SQRT64(a)
@@ -676,6 +694,57 @@ typedef const char         *rt_pstr;
 
 #endif /* RT_ELEMENT */
 
+/******************************************************************************/
+/**************************   COMPILE-TIME CHECKS   ***************************/
+/******************************************************************************/
+
+/*
+ * Instruction operands are plain macro triplets (REG, MOD, SIB) which only
+ * the assembler sees, thus a mismatch between a hand-written DP offset and
+ * its structure field is not caught by the compiler. The checks below cost
+ * nothing at runtime and fail the build instead (C++11 static_assert if
+ * available).
+ * RT_DISP(dp) yields the byte offset of a DP, DE, DF, DG or DH displacement
+ * (first element of the triplet on all targets, low bits masked on RISCs).
+ * RT_CHECK_DISP compares it against the field's offsetof plus endian
+ * correction (corr: 0, B, C, D, E, F, G, H, I), use for new SIMD structs.
+ * RT_CHECK_ELEM(type) checks that C-side data matches SIMD element size.
+ */
+#if (defined __cplusplus && __cplusplus >= 201103L) ||                      \
+    (defined _MSC_VER && _MSC_VER >= 1600)
+
+#define RT_CHECK(cond, msg)                                                 \
+        static_assert(cond, #msg)
+
+#else  /* C++98 fallback: negative array size */
+
+#define RT_CHECK(cond, msg)                                                 \
+        RT_CHECK_TYPE(msg, __LINE__)[(cond) ? 1 : -1]
+
+#define RT_CHECK_TYPE(msg, ln)                                              \
+        RT_CHECK_NAME(msg, ln)
+
+#define RT_CHECK_NAME(msg, ln)                                              \
+        typedef char rt_check_##msg##_##ln
+
+#endif /* static_assert */
+
+#define RT_DISP(dp)                                                         \
+        RT_DISP_ARGS((dp))
+
+#define RT_DISP_ARGS(args)                                                  \
+        RT_DISP_TRIP args
+
+#define RT_DISP_TRIP(dp, mod, sib)                                          \
+        (dp)
+
+#define RT_CHECK_DISP(type, field, corr, dp)                                \
+        RT_CHECK(RT_DISP_ARGS((dp)) == offsetof(type, field) + (corr),      \
+                 displacement_mismatch_##field)
+
+#define RT_CHECK_ELEM(type)                                                 \
+        RT_CHECK(sizeof(type) * 8 == RT_ELEMENT, SIMD_element_mismatch)
+
 /******************************************************************************/
 /*************************   SIMD BACKEND STRUCTURE   *************************/
 /******************************************************************************/
@@ -687,6 +756,11 @@ typedef const char         *rt_pstr;
  * use DF, DG, DH and DV for 14, 15, 16 and 31-bit offsets respectively.
  * SIMD width is taken into account via S and Q defined in rtarch.h.
  * Structure is read-write in backend.
+ * General purpose constants are kept in every instance (not shared between
+ * threads) as instructions address them directly via [Mebp + DP] and
+ * backends have no spare base register to reach a shared block
+ * (legacy x86 has only 8 in total), their footprint is Q*0xD0 bytes per
+ * instance, which is small compared to the register file in rt_SIMD_REGS.
  */
 struct rt_SIMD_INFO
 {
@@ -781,6 +855,46 @@ struct rt_SIMD_INFO
 #endif /* RT_ELEMENT */
 
 
+/*
+ * RT_SIMD_PROFILE enables instrumented mask-jump sites (mkppx_rx) when set
+ * to the number of sites in the profile table (0 - plain mkjpx_rx jumps).
+ */
+#ifndef RT_SIMD_PROFILE
+#define RT_SIMD_PROFILE     0
+#endif /* RT_SIMD_PROFILE */
+
+/*
+ * RT_SIMD_FPSTAT enables capturing of sticky fp status flags (fpswx_rx)
+ * into rt_SIMD_REGS at ASM_LEAVE, flags are cleared at ASM_ENTER (0 - off).
+ */
+#ifndef RT_SIMD_FPSTAT
+#define RT_SIMD_FPSTAT      0
+#endif /* RT_SIMD_FPSTAT */
+
+/*
+ * Mask-jump site profile for SPMD divergence analysis (mkppx_rx).
+ * Holds the number of NONE, FULL and mixed masks seen at the site
+ * and per-element sums of active lanes (wrapping at element size),
+ * all active lanes at the site are the sum of lane[] over S elements.
+ * Structure is read-write in backend, table lives in rt_SIMD_REGS.
+ */
+struct rt_SIMD_MKJPF
+{
+    rt_ui32 cnt[R];         /* NONE, FULL, mixed counts, rest reserved */
+#define RT_MKP_NONE         (Q*0x000+0x00)
+#define RT_MKP_FULL         (Q*0x000+0x04)
+#define RT_MKP_MIXD         (Q*0x000+0x08)
+
+    rt_elem lane[S];        /* active-lane sums per element */
+#define RT_MKP_LANE         (Q*0x010)
+
+    rt_elem save[S];        /* register save area, internal */
+#define RT_MKP_SAVE         (Q*0x020)
+
+};
+
+#define RT_MKP_SIZE         (Q*0x030)
+
 struct rt_SIMD_REGS
 {
     /* register file (maximum of 64 2K8-bit registers) */
@@ -788,6 +902,54 @@ struct rt_SIMD_REGS
     rt_ui32 file[64*64];
 #define reg_FILE            DP(Q*0x000)
 
+    /* upper part of the file (above sregs_sa area of up to 34 registers
+     * on SVE) keeps spill slots of virtual registers allocated by
+     * simd_vreg.awk (28 slots at 2K8, more at smaller SIMD widths) */
+
+#define reg_SPILL(nx)       DH(0x2400 + Q*0x010*(nx))
+
+    /* fp status flags captured at ASM_LEAVE (RT_SIMD_FPSTAT) */
+
+    rt_ui32 fpst[R];
+#define reg_FPST            DH(0x4000)
+
+    /* fp control mode stack for nestable FCTRL blocks (FCTRL_PUSH/POP) */
+
+    rt_ui32 fcst[R];
+#define reg_FCST            DH(0x4000 + Q*0x010)
+
+#if RT_SIMD_PROFILE
+
+    /* mask-jump site profiles (16-bit offsets limit table to 48KB) */
+
+    rt_SIMD_MKJPF mkp[RT_SIMD_PROFILE];
+#define reg_MKP(nx)         DH(0x4000 + Q*0x020 + nx)
+
+#endif /* RT_SIMD_PROFILE */
+
+};
+
+/*
+ * Timestamp region accumulator for in-section cycle counting (tmrwx_**).
+ * Holds the lower 32-bit timestamp taken at region entry, accumulated
+ * timestamp delta and number of region entries, both wrapping at 32-bit.
+ * Accumulated deltas are expected to be folded into wider counters by C code
+ * after ASM_LEAVE to avoid wrap-around on long-running sections.
+ */
+struct rt_SIMD_TIMER
+{
+    rt_ui32 beg;            /* timestamp at region entry */
+#define RT_TMR_BEG          0x00
+
+    rt_ui32 acc;            /* accumulated timestamp delta */
+#define RT_TMR_ACC          0x04
+
+    rt_ui32 cnt;            /* number of region entries */
+#define RT_TMR_CNT          0x08
+
+    rt_ui32 pad;            /* reserved, keeps 16-byte stride */
+#define RT_TMR_PAD          0x0C
+
 };
 
 #define ASM_INIT(__Info__, __Regs__)                                        \
@@ -804,7 +966,20 @@ struct rt_SIMD_REGS
     RT_SIMD_SET64(__Info__->gpc04_64, LL(0x7FFFFFFFFFFFFFFF));              \
     RT_SIMD_SET64(__Info__->gpc05_64, LL(0x3FF0000000000000));              \
     RT_SIMD_SET64(__Info__->gpc06_64, LL(0x8000000000000000));              \
-    __Info__->regs = (rt_ui64)(rt_word)__Regs__;
+    __Info__->regs = (rt_ui64)(rt_word)__Regs__;                            \
+    memset(__Regs__->fcst, 0, sizeof(__Regs__->fcst));                      \
+    ASM_INIT_MKP(__Regs__)
+
+#if RT_SIMD_PROFILE
+
+#define ASM_INIT_MKP(__Regs__)                                              \
+    memset(__Regs__->mkp, 0, sizeof(__Regs__->mkp));
+
+#else  /* RT_SIMD_PROFILE */
+
+#define ASM_INIT_MKP(__Regs__)
+
+#endif /* RT_SIMD_PROFILE */
 
 #define ASM_DONE(__Info__)
 
@@ -1216,6 +1391,254 @@ rt_si32 from_mask(rt_si32 mask)
 #define FCTRL_LEAVE(mode) /* resumes default mode (ROUNDN) upon leave */    \
         FCTRL_RESET()
 
+/******************* nestable FCTRL blocks (up to 7 levels) *******************/
+
+/*
+ * FCTRL_PUSH/FCTRL_POP pairs can be nested (in helper meta-instructions
+ * called from within other pairs) and skip fp control register writes
+ * if the mode doesn't change, modes are kept in a 32-bit stack of 4-bit
+ * slots in rt_SIMD_REGS (relative to ROUNDN, so that zeroed stack holds
+ * default mode at the bottom), each pair needs its own label (lb) for
+ * internal jumps, all BASE registers are preserved (but not flags),
+ * original FCTRL blocks cannot be used inside.
+ */
+#define RT_FCST_MODE(mode)  (RT_SIMD_MODE_##mode ^ RT_SIMD_MODE_ROUNDN)
+
+#define FCTRL_PUSH(mode, lb) /* sets mode, saves previous on fctrl stack */ \
+        stack_st(Recx)                                                      \
+        stack_st(Reax)                                                      \
+        movxx_ld(Recx, Mebp, inf_REGS)                                      \
+        movwx_ld(Reax, Mecx, reg_FCST)                                      \
+        shlwx_mi(Mecx, reg_FCST, IB(4))                                     \
+        orrwx_mi(Mecx, reg_FCST, IB(RT_FCST_MODE(mode)))                    \
+        andwx_ri(Reax, IB(0xF))                                             \
+        cmjwx_ri(Reax, IB(RT_FCST_MODE(mode)),                              \
+        /* if */ EQ_x, lb##_fp)                                             \
+        FCTRL_SET(mode)                                                     \
+    LBL(lb##_fp)                                                            \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)
+
+#define FCTRL_POP(lb) /* resumes previous mode from fctrl stack */          \
+        stack_st(Recx)                                                      \
+        stack_st(Reax)                                                      \
+        movxx_ld(Recx, Mebp, inf_REGS)                                      \
+        movwx_ld(Reax, Mecx, reg_FCST)                                      \
+        shrwx_ri(Reax, IB(4))                                               \
+        xorwx_ld(Reax, Mecx, reg_FCST)                                      \
+        shrwx_mi(Mecx, reg_FCST, IB(4))                                     \
+        andwx_ri(Reax, IB(0xF))                                             \
+        cmjwx_rz(Reax,                                                      \
+        /* if */ EQ_x, lb##_fd)                                             \
+        movwx_ld(Reax, Mecx, reg_FCST)                                      \
+        andwx_ri(Reax, IB(0xF))                                             \
+        FCTRL_CASE(ROUNDN, lb, 0)                                           \
+        FCTRL_CASE(ROUNDM, lb, 1)                                           \
+        FCTRL_CASE(ROUNDP, lb, 2)                                           \
+        FCTRL_CASE(ROUNDZ, lb, 3)                                           \
+        FCTRL_CASE(ROUNDN_F, lb, 4)                                         \
+        FCTRL_CASE(ROUNDM_F, lb, 5)                                         \
+        FCTRL_CASE(ROUNDP_F, lb, 6)                                         \
+        FCTRL_CASE(ROUNDZ_F, lb, 7)                                         \
+    LBL(lb##_fd)                                                            \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)
+
+#define FCTRL_CASE(mode, lb, nx) /* internal, sets mode if it's in Reax */  \
+        cmjwx_ri(Reax, IB(RT_FCST_MODE(mode)),                              \
+        /* if */ NE_x, lb##_f##nx)                                          \
+        FCTRL_SET(mode)                                                     \
+        jmpxx_lb(lb##_fd)                                                   \
+    LBL(lb##_f##nx)
+
+/***************** SPMD control flow (nested execution masks) *****************/
+
+/*
+ * SPMD_IF/SPMD_ELSE/SPMD_ENDIF and SPMD_DO/SPMD_WHILE/SPMD_ENDDO run
+ * divergent control flow on SIMD lanes under execution mask XM (from cmdp
+ * compares, all-ones at the top level), each nesting level saves its parent
+ * mask in its own register XP (mask stack kept in registers), a side whose
+ * mask is NONE is skipped via mkjpx_rx (destroys Reax), on a partial mask
+ * register results are merged via SPMD_MOVE and stores via SPMD_STORE.
+ * Jump targets are regular labels placed by the caller (no internal labels),
+ * which keeps the macros usable with virtual registers (simd_vreg.awk).
+ *
+ *      SPMD_IF(XM, XS, XP, el)         SPMD_DO(XM, XP)
+ *      ...  (then-side)            LBL(wh)
+ *  LBL(el)                             ...  (condition into XS)
+ *      SPMD_ELSE(XM, XP, ex)           SPMD_WHILE(XM, XS, ex)
+ *      ...  (else-side)                ...  (loop body)
+ *  LBL(ex)                             jmpxx_lb(wh)
+ *      SPMD_ENDIF(XM, XP)          LBL(ex)
+ *                                      SPMD_ENDDO(XM, XP)
+ *
+ * An if without else jumps straight to ex from SPMD_IF, a loop runs until
+ * all lanes have left, lanes which failed the condition stay inactive.
+ */
+
+#define SPMD_IF(XM, XS, XP, lb) /* XP = XM, XM &= XS, jump lb if NONE */    \
+        movpx_rr(W(XP), W(XM))                                              \
+        andpx_rr(W(XM), W(XS))                                              \
+        mkjpx_rx(W(XM), NONE, lb)
+
+#define SPMD_ELSE(XM, XP, lb) /* XM = XP & ~XM, jump lb if NONE */          \
+        annpx_rr(W(XM), W(XP))                                              \
+        mkjpx_rx(W(XM), NONE, lb)
+
+#define SPMD_ENDIF(XM, XP) /* XM = XP (parent mask) */                      \
+        movpx_rr(W(XM), W(XP))
+
+#define SPMD_DO(XM, XP) /* XP = XM, loop head label follows */              \
+        movpx_rr(W(XP), W(XM))
+
+#define SPMD_WHILE(XM, XS, lb) /* XM &= XS, jump lb if NONE */              \
+        andpx_rr(W(XM), W(XS))                                              \
+        mkjpx_rx(W(XM), NONE, lb)
+
+#define SPMD_ENDDO(XM, XP) /* XM = XP (parent mask) */                      \
+        movpx_rr(W(XM), W(XP))
+
+#define SPMD_MOVE(XD, XS, XM) /* XD = XS in XM lanes, destroys XS */        \
+        xorpx_rr(W(XS), W(XD))                                              \
+        andpx_rr(W(XS), W(XM))                                              \
+        xorpx_rr(W(XD), W(XS))
+
+#define SPMD_STORE(XS, XM, XT, MD, DD) /* masked store, destroys XT */      \
+        movpx_ld(W(XT), W(MD), W(DD))                                       \
+        xorpx_rr(W(XT), W(XS))                                              \
+        andpx_rr(W(XT), W(XM))                                              \
+        xorpx_ld(W(XT), W(MD), W(DD))                                       \
+        movpx_st(W(XT), W(MD), W(DD))
+
+/************** stream compaction (compress-store, expand-load) ***************/
+
+/*
+ * cpspx_st stores active lanes of XS (where mask XM is all-ones, from cmdp
+ * compares) contiguously to memory, xpdpx_ld loads contiguous elements
+ * from memory into active lanes of XG (inactive lanes keep their values),
+ * both return the number of active lanes in RD. Memory is addressed via
+ * index mode (I***) with Reax as running offset, MD/MS base holds output
+ * or input pointer, which is advanced by the caller by RD*4*L bytes.
+ * Lanes are processed one by one in BASE registers via scratchpads
+ * inf_SCR01/inf_SCR02, therefore only RD active elements are accessed,
+ * registers Redx, Resi, Redi are saved and restored (on stack), thus
+ * they cannot be used as MD/MS base. AVX-512 targets override both
+ * with vcompress/vexpand via k1, SVE targets override cpspx_st via COMPACT.
+ * Internal labels are derived from lb, so each use needs its own label.
+ */
+
+#define cpspx_st(XS, XM, RD, MD, DD, lb) /* destroys Reax, RD = count */    \
+        movpx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movpx_st(W(XM), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        stack_st(Resi)                                                      \
+        stack_st(Redi)                                                      \
+        adrxx_ld(Resi, Mebp, inf_SCR01(0))                                  \
+        movxx_ri(Redx, IB(S))                                               \
+        movxx_ri(Reax, IB(0))                                               \
+    LBL(lb##_cb)                                                            \
+        cmjwx_mz(Mesi, DP(Q*0x010),                                         \
+        /* if */ EZ_x, lb##_cn)                                             \
+        movyx_ld(Redi, Mesi, DP(0))                                         \
+        movyx_st(Redi, W(MD), W(DD))                                        \
+        addxx_ri(Reax, IB(4*L))                                             \
+    LBL(lb##_cn)                                                            \
+        addxx_ri(Resi, IB(4*L))                                             \
+        subxx_ri(Redx, IB(1))                                               \
+        cmjxx_rz(Redx,                                                      \
+        /* if */ NZ_x, lb##_cb)                                             \
+        stack_ld(Redi)                                                      \
+        stack_ld(Resi)                                                      \
+        stack_ld(Redx)                                                      \
+        movxx_rr(W(RD), Reax)                                               \
+        shrxx_ri(W(RD), IB(L+1))
+
+#define xpdpx_ld(XG, XM, RD, MS, DS, lb) /* destroys Reax, RD = count */    \
+        movpx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movpx_st(W(XM), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        stack_st(Resi)                                                      \
+        stack_st(Redi)                                                      \
+        adrxx_ld(Resi, Mebp, inf_SCR01(0))                                  \
+        movxx_ri(Redx, IB(S))                                               \
+        movxx_ri(Reax, IB(0))                                               \
+    LBL(lb##_xb)                                                            \
+        cmjwx_mz(Mesi, DP(Q*0x010),                                         \
+        /* if */ EZ_x, lb##_xn)                                             \
+        movyx_ld(Redi, W(MS), W(DS))                                        \
+        movyx_st(Redi, Mesi, DP(0))                                         \
+        addxx_ri(Reax, IB(4*L))                                             \
+    LBL(lb##_xn)                                                            \
+        addxx_ri(Resi, IB(4*L))                                             \
+        subxx_ri(Redx, IB(1))                                               \
+        cmjxx_rz(Redx,                                                      \
+        /* if */ NZ_x, lb##_xb)                                             \
+        stack_ld(Redi)                                                      \
+        stack_ld(Resi)                                                      \
+        stack_ld(Redx)                                                      \
+        movpx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        movxx_rr(W(RD), Reax)                                               \
+        shrxx_ri(W(RD), IB(L+1))
+
+/*************** mask to BASE (lane bitmask, active-lane count) ***************/
+
+/*
+ * mkmpx_rx moves mask XS (all-ones or zero lanes, from cmdp compares) into
+ * element-sized BASE register RD as a bitmask (lane i to bit i), which
+ * requires S <= RT_ELEMENT (all but 2K8 with 32-bit elements, where any
+ * use of mkmpx_rx fails the build instead of dropping upper lanes),
+ * mkcpx_rx counts active lanes of mask XS into RD. Unlike mkjpx_rx, which
+ * only checks the mask against NONE/FULL, mask value is walked lane by lane
+ * via scratchpad inf_SCR01, registers Redx, Resi are saved and restored
+ * (on stack). Single-register x86_64 targets override them via movmsk
+ * or kmov and popcnt (only mkmpx_rx on SSE), SVE overrides mkcpx_rx (CNTP).
+ * Internal labels are derived from lb, so each use needs its own label.
+ */
+
+#if (S > RT_ELEMENT)
+
+#define mkmpx_rx(XS, RD, lb)     /* lane bitmask doesn't fit element */     \
+        mkmpx_rx_not_supported_if_S_exceeds_RT_ELEMENT
+
+#else  /* S <= RT_ELEMENT */
+
+#define mkmpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane bits */        \
+        movpx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Redx)                                                      \
+        stack_st(Resi)                                                      \
+        adrxx_ld(Resi, Mebp, inf_SCR01(Q*0x010))                            \
+        movxx_ri(Redx, IB(S))                                               \
+        movyx_ri(Reax, IB(0))                                               \
+    LBL(lb##_mb)                                                            \
+        subxx_ri(Resi, IB(4*L))                                             \
+        shlyx_ri(Reax, IB(1))                                               \
+        subyx_ld(Reax, Mesi, DP(0))                                         \
+        subxx_ri(Redx, IB(1))                                               \
+        cmjxx_rz(Redx,                                                      \
+        /* if */ NZ_x, lb##_mb)                                             \
+        stack_ld(Resi)                                                      \
+        stack_ld(Redx)                                                      \
+        movyx_rr(W(RD), Reax)
+
+#endif /* S <= RT_ELEMENT */
+
+#define mkcpx_rx(XS, RD, lb)     /* destroys Reax, RD = lane count */       \
+        movpx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Redx)                                                      \
+        stack_st(Resi)                                                      \
+        adrxx_ld(Resi, Mebp, inf_SCR01(0))                                  \
+        movxx_ri(Redx, IB(S))                                               \
+        movyx_ri(Reax, IB(0))                                               \
+    LBL(lb##_mc)                                                            \
+        subyx_ld(Reax, Mesi, DP(0))                                         \
+        addxx_ri(Resi, IB(4*L))                                             \
+        subxx_ri(Redx, IB(1))                                               \
+        cmjxx_rz(Redx,                                                      \
+        /* if */ NZ_x, lb##_mc)                                             \
+        stack_ld(Resi)                                                      \
+        stack_ld(Redx)                                                      \
+        movyx_rr(W(RD), Reax)
+
 /******************************************************************************/
 /**** var-len **** (cbr/cbe/cbs/...) with fixed-32-bit element ****************/
 /******************************************************************************/
@@ -5266,6 +5689,420 @@ rt_si32 from_mask(rt_si32 mask)
         maxts_ld(W(XD), Mebp, inf_SCR02(0x08))                              \
         movts_st(W(XD), Mebp, inf_SCR01(0x08))
 
+/******************************************************************************/
+/**** var-len **** (dot-product SIMD) with fixed-32-bit element ***************/
+/******************************************************************************/
+
+/*
+ * Integer dot-products below are exact emulations built on BASE registers.
+ * Elements of S are combined with elements of T at the same positions,
+ * therefore the results don't depend on the endianness of the target.
+ * Targets with native support redefine them in half+byte SIMD headers.
+ * As the "lane" parameter is a macro name, it is not wrapped into W().
+ */
+
+#if   (RT_SIMD >= 512) || (RT_SIMD == 256 && defined RT_SVEX1)
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed
+ * dot-product of adjacent 16-bit elements accumulated into 32-bit elements
+ * wraps around on 32-bit overflow, pairs of -32768 * -32768 produce 2^31 */
+
+#define dphon_rr(XG, XS, XT)                                                \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dpxox_rx(W(XG), W(XS), Mebp, inf_SCR02(0), dphwn_rx)
+
+#define dphon_ld(XG, XS, MT, DT)                                            \
+        dpxox_rx(W(XG), W(XS), W(MT), W(DT), dphwn_rx)
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, signed
+ * dot-product of adjacent 8-bit elements accumulated into 32-bit elements
+ * each 32-bit element of G adds up products of its 4 corresponding bytes */
+
+#define dpbon_rr(XG, XS, XT)                                                \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dpxox_rx(W(XG), W(XS), Mebp, inf_SCR02(0), dpbwn_rx)
+
+#define dpbon_ld(XG, XS, MT, DT)                                            \
+        dpxox_rx(W(XG), W(XS), W(MT), W(DT), dpbwn_rx)
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, unsigned
+ * dot-product of adjacent 8-bit elements accumulated into 32-bit elements
+ * each 32-bit element of G adds up products of its 4 corresponding bytes */
+
+#define dpbox_rr(XG, XS, XT)                                                \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dpxox_rx(W(XG), W(XS), Mebp, inf_SCR02(0), dpbwx_rx)
+
+#define dpbox_ld(XG, XS, MT, DT)                                            \
+        dpxox_rx(W(XG), W(XS), W(MT), W(DT), dpbwx_rx)
+
+#define dpxox_rx(XG, XS, MT, DT, lane) /* not portable, do not use */       \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Recx)                                                      \
+        stack_st(Redx)                                                      \
+        stack_st(Rebx)                                                      \
+        stack_st(Resi)                                                      \
+        adrxx_ld(Resi,  W(MT), W(DT))                                       \
+        dpxox_lx(lane)                                                      \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        dpxox_lx(dpawx_rx)                                                  \
+        stack_ld(Resi)                                                      \
+        stack_ld(Rebx)                                                      \
+        stack_ld(Redx)                                                      \
+        stack_ld(Recx)                                                      \
+        movox_ld(W(XG), Mebp, inf_SCR01(0))
+
+#if   (RT_SIMD == 2048)
+
+#define dpxox_lx(lane) /* not portable, do not use outside */               \
+        lane(0x00) lane(0x04) lane(0x08) lane(0x0C)                         \
+        lane(0x10) lane(0x14) lane(0x18) lane(0x1C)                         \
+        lane(0x20) lane(0x24) lane(0x28) lane(0x2C)                         \
+        lane(0x30) lane(0x34) lane(0x38) lane(0x3C)                         \
+        lane(0x40) lane(0x44) lane(0x48) lane(0x4C)                         \
+        lane(0x50) lane(0x54) lane(0x58) lane(0x5C)                         \
+        lane(0x60) lane(0x64) lane(0x68) lane(0x6C)                         \
+        lane(0x70) lane(0x74) lane(0x78) lane(0x7C)                         \
+        lane(0x80) lane(0x84) lane(0x88) lane(0x8C)                         \
+        lane(0x90) lane(0x94) lane(0x98) lane(0x9C)                         \
+        lane(0xA0) lane(0xA4) lane(0xA8) lane(0xAC)                         \
+        lane(0xB0) lane(0xB4) lane(0xB8) lane(0xBC)                         \
+        lane(0xC0) lane(0xC4) lane(0xC8) lane(0xCC)                         \
+        lane(0xD0) lane(0xD4) lane(0xD8) lane(0xDC)                         \
+        lane(0xE0) lane(0xE4) lane(0xE8) lane(0xEC)                         \
+        lane(0xF0) lane(0xF4) lane(0xF8) lane(0xFC)
+
+#elif (RT_SIMD == 1024)
+
+#define dpxox_lx(lane) /* not portable, do not use outside */               \
+        lane(0x00) lane(0x04) lane(0x08) lane(0x0C)                         \
+        lane(0x10) lane(0x14) lane(0x18) lane(0x1C)                         \
+        lane(0x20) lane(0x24) lane(0x28) lane(0x2C)                         \
+        lane(0x30) lane(0x34) lane(0x38) lane(0x3C)                         \
+        lane(0x40) lane(0x44) lane(0x48) lane(0x4C)                         \
+        lane(0x50) lane(0x54) lane(0x58) lane(0x5C)                         \
+        lane(0x60) lane(0x64) lane(0x68) lane(0x6C)                         \
+        lane(0x70) lane(0x74) lane(0x78) lane(0x7C)
+
+#elif (RT_SIMD == 512)
+
+#define dpxox_lx(lane) /* not portable, do not use outside */               \
+        lane(0x00) lane(0x04) lane(0x08) lane(0x0C)                         \
+        lane(0x10) lane(0x14) lane(0x18) lane(0x1C)                         \
+        lane(0x20) lane(0x24) lane(0x28) lane(0x2C)                         \
+        lane(0x30) lane(0x34) lane(0x38) lane(0x3C)
+
+#elif (RT_SIMD == 256)
+
+#define dpxox_lx(lane) /* not portable, do not use outside */               \
+        lane(0x00) lane(0x04) lane(0x08) lane(0x0C)                         \
+        lane(0x10) lane(0x14) lane(0x18) lane(0x1C)
+
+#endif /* RT_SIMD: 2K8, 1K4, 512, 256 */
+
+#endif /* RT_SIMD: 2K8, 1K4, 512, 256 */
+
+/******************************************************************************/
+/**** 256-bit **** (dot-product SIMD) with fixed-32-bit element ***************/
+/******************************************************************************/
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed
+ * dot-product of adjacent 16-bit elements accumulated into 32-bit elements
+ * wraps around on 32-bit overflow, pairs of -32768 * -32768 produce 2^31 */
+
+#define dphcn_rr(XG, XS, XT)                                                \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dpxcx_rx(W(XG), W(XS), Mebp, inf_SCR02(0), dphwn_rx)
+
+#define dphcn_ld(XG, XS, MT, DT)                                            \
+        dpxcx_rx(W(XG), W(XS), W(MT), W(DT), dphwn_rx)
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, signed
+ * dot-product of adjacent 8-bit elements accumulated into 32-bit elements
+ * each 32-bit element of G adds up products of its 4 corresponding bytes */
+
+#define dpbcn_rr(XG, XS, XT)                                                \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dpxcx_rx(W(XG), W(XS), Mebp, inf_SCR02(0), dpbwn_rx)
+
+#define dpbcn_ld(XG, XS, MT, DT)                                            \
+        dpxcx_rx(W(XG), W(XS), W(MT), W(DT), dpbwn_rx)
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, unsigned
+ * dot-product of adjacent 8-bit elements accumulated into 32-bit elements
+ * each 32-bit element of G adds up products of its 4 corresponding bytes */
+
+#define dpbcx_rr(XG, XS, XT)                                                \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dpxcx_rx(W(XG), W(XS), Mebp, inf_SCR02(0), dpbwx_rx)
+
+#define dpbcx_ld(XG, XS, MT, DT)                                            \
+        dpxcx_rx(W(XG), W(XS), W(MT), W(DT), dpbwx_rx)
+
+#define dpxcx_rx(XG, XS, MT, DT, lane) /* not portable, do not use */       \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Recx)                                                      \
+        stack_st(Redx)                                                      \
+        stack_st(Rebx)                                                      \
+        stack_st(Resi)                                                      \
+        adrxx_ld(Resi,  W(MT), W(DT))                                       \
+        dpxcx_lx(lane)                                                      \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        dpxcx_lx(dpawx_rx)                                                  \
+        stack_ld(Resi)                                                      \
+        stack_ld(Rebx)                                                      \
+        stack_ld(Redx)                                                      \
+        stack_ld(Recx)                                                      \
+        movcx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define dpxcx_lx(lane) /* not portable, do not use outside */               \
+        lane(0x00) lane(0x04) lane(0x08) lane(0x0C)                         \
+        lane(0x10) lane(0x14) lane(0x18) lane(0x1C)
+
+/******************************************************************************/
+/**** 128-bit **** (dot-product SIMD) with fixed-32-bit element ***************/
+/******************************************************************************/
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed
+ * dot-product of adjacent 16-bit elements accumulated into 32-bit elements
+ * wraps around on 32-bit overflow, pairs of -32768 * -32768 produce 2^31 */
+
+#define dphin_rr(XG, XS, XT)                                                \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dpxix_rx(W(XG), W(XS), Mebp, inf_SCR02(0), dphwn_rx)
+
+#define dphin_ld(XG, XS, MT, DT)                                            \
+        dpxix_rx(W(XG), W(XS), W(MT), W(DT), dphwn_rx)
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, signed
+ * dot-product of adjacent 8-bit elements accumulated into 32-bit elements
+ * each 32-bit element of G adds up products of its 4 corresponding bytes */
+
+#define dpbin_rr(XG, XS, XT)                                                \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dpxix_rx(W(XG), W(XS), Mebp, inf_SCR02(0), dpbwn_rx)
+
+#define dpbin_ld(XG, XS, MT, DT)                                            \
+        dpxix_rx(W(XG), W(XS), W(MT), W(DT), dpbwn_rx)
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, unsigned
+ * dot-product of adjacent 8-bit elements accumulated into 32-bit elements
+ * each 32-bit element of G adds up products of its 4 corresponding bytes */
+
+#define dpbix_rr(XG, XS, XT)                                                \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dpxix_rx(W(XG), W(XS), Mebp, inf_SCR02(0), dpbwx_rx)
+
+#define dpbix_ld(XG, XS, MT, DT)                                            \
+        dpxix_rx(W(XG), W(XS), W(MT), W(DT), dpbwx_rx)
+
+#define dpxix_rx(XG, XS, MT, DT, lane) /* not portable, do not use */       \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Recx)                                                      \
+        stack_st(Redx)                                                      \
+        stack_st(Rebx)                                                      \
+        stack_st(Resi)                                                      \
+        adrxx_ld(Resi,  W(MT), W(DT))                                       \
+        dpxix_lx(lane)                                                      \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        dpxix_lx(dpawx_rx)                                                  \
+        stack_ld(Resi)                                                      \
+        stack_ld(Rebx)                                                      \
+        stack_ld(Redx)                                                      \
+        stack_ld(Recx)                                                      \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define dpxix_lx(lane) /* not portable, do not use outside */               \
+        lane(0x00) lane(0x04) lane(0x08) lane(0x0C)
+
+/* internal helpers for all dot-product subsets above (single 32-bit lane) */
+
+#define dphwn_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        shlwx_ri(Redx,  IB(16))                                             \
+        shrwn_ri(Redx,  IB(16))                                             \
+        movwx_ld(Rebx,  Mesi, DP(nx))                                       \
+        shlwx_ri(Rebx,  IB(16))                                             \
+        shrwn_ri(Rebx,  IB(16))                                             \
+        mulwx_rr(Redx,  Rebx)                                               \
+        movwx_ld(Recx,  Mebp, inf_SCR01(nx))                                \
+        shrwn_ri(Recx,  IB(16))                                             \
+        movwx_ld(Rebx,  Mesi, DP(nx))                                       \
+        shrwn_ri(Rebx,  IB(16))                                             \
+        mulwx_rr(Recx,  Rebx)                                               \
+        addwx_rr(Recx,  Redx)                                               \
+        movwx_st(Recx,  Mebp, inf_SCR01(nx))
+
+#define dpbwn_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Recx,  Mebp, inf_SCR01(nx))                                \
+        shrwn_ri(Recx,  IB(24))                                             \
+        movwx_ld(Rebx,  Mesi, DP(nx))                                       \
+        shrwn_ri(Rebx,  IB(24))                                             \
+        mulwx_rr(Recx,  Rebx)                                               \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        shlwx_ri(Redx,  IB(8))                                              \
+        shrwn_ri(Redx,  IB(24))                                             \
+        movwx_ld(Rebx,  Mesi, DP(nx))                                       \
+        shlwx_ri(Rebx,  IB(8))                                              \
+        shrwn_ri(Rebx,  IB(24))                                             \
+        mulwx_rr(Redx,  Rebx)                                               \
+        addwx_rr(Recx,  Redx)                                               \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        shlwx_ri(Redx,  IB(16))                                             \
+        shrwn_ri(Redx,  IB(24))                                             \
+        movwx_ld(Rebx,  Mesi, DP(nx))                                       \
+        shlwx_ri(Rebx,  IB(16))                                             \
+        shrwn_ri(Rebx,  IB(24))                                             \
+        mulwx_rr(Redx,  Rebx)                                               \
+        addwx_rr(Recx,  Redx)                                               \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        shlwx_ri(Redx,  IB(24))                                             \
+        shrwn_ri(Redx,  IB(24))                                             \
+        movwx_ld(Rebx,  Mesi, DP(nx))                                       \
+        shlwx_ri(Rebx,  IB(24))                                             \
+        shrwn_ri(Rebx,  IB(24))                                             \
+        mulwx_rr(Redx,  Rebx)                                               \
+        addwx_rr(Recx,  Redx)                                               \
+        movwx_st(Recx,  Mebp, inf_SCR01(nx))
+
+#define dpbwx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Recx,  Mebp, inf_SCR01(nx))                                \
+        shrwx_ri(Recx,  IB(24))                                             \
+        movwx_ld(Rebx,  Mesi, DP(nx))                                       \
+        shrwx_ri(Rebx,  IB(24))                                             \
+        mulwx_rr(Recx,  Rebx)                                               \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        shlwx_ri(Redx,  IB(8))                                              \
+        shrwx_ri(Redx,  IB(24))                                             \
+        movwx_ld(Rebx,  Mesi, DP(nx))                                       \
+        shlwx_ri(Rebx,  IB(8))                                              \
+        shrwx_ri(Rebx,  IB(24))                                             \
+        mulwx_rr(Redx,  Rebx)                                               \
+        addwx_rr(Recx,  Redx)                                               \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        shlwx_ri(Redx,  IB(16))                                             \
+        shrwx_ri(Redx,  IB(24))                                             \
+        movwx_ld(Rebx,  Mesi, DP(nx))                                       \
+        shlwx_ri(Rebx,  IB(16))                                             \
+        shrwx_ri(Rebx,  IB(24))                                             \
+        mulwx_rr(Redx,  Rebx)                                               \
+        addwx_rr(Recx,  Redx)                                               \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        shlwx_ri(Redx,  IB(24))                                             \
+        shrwx_ri(Redx,  IB(24))                                             \
+        movwx_ld(Rebx,  Mesi, DP(nx))                                       \
+        shlwx_ri(Rebx,  IB(24))                                             \
+        shrwx_ri(Rebx,  IB(24))                                             \
+        mulwx_rr(Redx,  Rebx)                                               \
+        addwx_rr(Recx,  Redx)                                               \
+        movwx_st(Recx,  Mebp, inf_SCR01(nx))
+
+#define dpawx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Recx,  Mebp, inf_SCR01(nx))                                \
+        addwx_ld(Recx,  Mebp, inf_SCR02(nx))                                \
+        movwx_st(Recx,  Mebp, inf_SCR01(nx))
+
+/******************************************************************************/
+/**** var-len **** (rounding-mode SIMD) with fixed-32-bit element *************/
+/******************************************************************************/
+
+/*
+ * Instructions below take rounding mode (ROUNDN, ROUNDM, ROUNDP, ROUNDZ)
+ * as a parameter and apply it to a single operation. Generic versions set
+ * the mode into fp control register around the operation, targets with
+ * static rounding (AVX-512) redefine them to encode the mode directly.
+ * As the fp control register is reset to ROUNDN afterwards, instructions
+ * of this group cannot be used within FCTRL blocks (same as cvr**_rr).
+ */
+
+/* add (D = S + T) with given rounding mode */
+
+#define addosRrr(XD, XS, XT, mode)                                          \
+        FCTRL_ENTER(mode)                                                   \
+        addos3rr(W(XD), W(XS), W(XT))                                       \
+        FCTRL_LEAVE(mode)
+
+/* sub (D = S - T) with given rounding mode */
+
+#define subosRrr(XD, XS, XT, mode)                                          \
+        FCTRL_ENTER(mode)                                                   \
+        subos3rr(W(XD), W(XS), W(XT))                                       \
+        FCTRL_LEAVE(mode)
+
+/* mul (D = S * T) with given rounding mode */
+
+#define mulosRrr(XD, XS, XT, mode)                                          \
+        FCTRL_ENTER(mode)                                                   \
+        mulos3rr(W(XD), W(XS), W(XT))                                       \
+        FCTRL_LEAVE(mode)
+
+/* div (D = S / T) with given rounding mode */
+
+#define divosRrr(XD, XS, XT, mode)                                          \
+        FCTRL_ENTER(mode)                                                   \
+        divos3rr(W(XD), W(XS), W(XT))                                       \
+        FCTRL_LEAVE(mode)
+
+/* sqr (D = sqrt S) with given rounding mode */
+
+#define sqrosRrr(XD, XS, mode)                                              \
+        FCTRL_ENTER(mode)                                                   \
+        sqros_rr(W(XD), W(XS))                                              \
+        FCTRL_LEAVE(mode)
+
+/* cvr (D = signed-int-to-fp S) with given rounding mode */
+
+#define cvron_rr(XD, XS, mode)                                              \
+        FCTRL_ENTER(mode)                                                   \
+        cvton_rr(W(XD), W(XS))                                              \
+        FCTRL_LEAVE(mode)
+
+/******************************************************************************/
+/**** var-len **** (rounding-mode SIMD) with fixed-64-bit element *************/
+/******************************************************************************/
+
+/* add (D = S + T) with given rounding mode */
+
+#define addqsRrr(XD, XS, XT, mode)                                          \
+        FCTRL_ENTER(mode)                                                   \
+        addqs3rr(W(XD), W(XS), W(XT))                                       \
+        FCTRL_LEAVE(mode)
+
+/* sub (D = S - T) with given rounding mode */
+
+#define subqsRrr(XD, XS, XT, mode)                                          \
+        FCTRL_ENTER(mode)                                                   \
+        subqs3rr(W(XD), W(XS), W(XT))                                       \
+        FCTRL_LEAVE(mode)
+
+/* mul (D = S * T) with given rounding mode */
+
+#define mulqsRrr(XD, XS, XT, mode)                                          \
+        FCTRL_ENTER(mode)                                                   \
+        mulqs3rr(W(XD), W(XS), W(XT))                                       \
+        FCTRL_LEAVE(mode)
+
+/* div (D = S / T) with given rounding mode */
+
+#define divqsRrr(XD, XS, XT, mode)                                          \
+        FCTRL_ENTER(mode)                                                   \
+        divqs3rr(W(XD), W(XS), W(XT))                                       \
+        FCTRL_LEAVE(mode)
+
+/* sqr (D = sqrt S) with given rounding mode */
+
+#define sqrqsRrr(XD, XS, mode)                                              \
+        FCTRL_ENTER(mode)                                                   \
+        sqrqs_rr(W(XD), W(XS))                                              \
+        FCTRL_LEAVE(mode)
+
+/* cvr (D = signed-int-to-fp S) with given rounding mode */
+
+#define cvrqn_rr(XD, XS, mode)                                              \
+        FCTRL_ENTER(mode)                                                   \
+        cvtqn_rr(W(XD), W(XS))                                              \
+        FCTRL_LEAVE(mode)
+
 #endif /* RT_SIMD_CODE */
 
 /******************************************************************************/
@@ -6407,6 +7244,155 @@ rt_si32 from_mask(rt_si32 mask)
 #define roryz_mr(MG, DG, RS)                                                \
         roryxZmr(W(MG), W(DG), W(RS))
 
+/******************************************************************************/
+/******************* timestamp region accumulators (32-bit) *******************/
+/******************************************************************************/
+
+/*
+ * Cycle counting of code regions within a single ASM section, where nx-th
+ * rt_SIMD_TIMER (16-byte stride) is addressed via user-defined DT(nx) macro.
+ * Timestamps come from tscwx_rx (lower 32-bit of the target's time-base),
+ * which ticks at core clock on x86 (rdtsc) and at a fixed rate elsewhere.
+ * Register RD is used as a scratch and contains garbage upon completion,
+ * flags are destroyed by both forms. Regions can nest if nx is different.
+ */
+
+/* tmr (region begin, D is scratch)
+ * set-flags: undefined */
+
+#define tmrwx_bg(RD, MT, DT, nx)   /* DT(nx) is a displacement macro */     \
+        tscwx_rx(W(RD))                                                     \
+        movwx_st(W(RD), W(MT), DT((nx)*0x10+RT_TMR_BEG))
+
+/* tmr (region end, D is scratch)
+ * set-flags: undefined */
+
+#define tmrwx_nd(RD, MT, DT, nx)   /* DT(nx) is a displacement macro */     \
+        tscwx_rx(W(RD))                                                     \
+        subwx_ld(W(RD), W(MT), DT((nx)*0x10+RT_TMR_BEG))                    \
+        addwx_st(W(RD), W(MT), DT((nx)*0x10+RT_TMR_ACC))                    \
+        addwx_mi(W(MT), DT((nx)*0x10+RT_TMR_CNT), IB(1))
+
+/******************************************************************************/
+/******************** mask-jump site profiling (optional) *********************/
+/******************************************************************************/
+
+/*
+ * Instrumented form of mkjpx_rx for SPMD divergence analysis, which counts
+ * NONE/FULL/mixed masks and active lanes of XS at site nx in the profile
+ * table of rt_SIMD_REGS before jumping. Sites are numbered by the caller
+ * from 0 to RT_SIMD_PROFILE-1, internal labels are derived from lb,
+ * therefore each instrumented site needs its own label. Registers Recx
+ * (on stack) and Xmm7 (in the site's profile) are saved and restored.
+ * Without RT_SIMD_PROFILE the site is a plain mkjpx_rx jump.
+ */
+
+#if RT_SIMD_PROFILE
+
+/* mkp (profile site nx, jump to lb) if (S satisfies mask condition) */
+
+#define mkppx_rx(XS, mask, lb, nx) /* destroys Reax, profiles site nx */    \
+        stack_st(Recx)                                                      \
+        movxx_ld(Recx, Mebp, inf_REGS)                                      \
+        movpx_st(Xmm7, Mecx, reg_MKP((nx)*RT_MKP_SIZE+RT_MKP_SAVE))         \
+        movpx_rr(Xmm7, W(XS))                                               \
+        shrpx_ri(Xmm7, IB(RT_ELEMENT-1))                                    \
+        addpx_ld(Xmm7, Mecx, reg_MKP((nx)*RT_MKP_SIZE+RT_MKP_LANE))         \
+        movpx_st(Xmm7, Mecx, reg_MKP((nx)*RT_MKP_SIZE+RT_MKP_LANE))         \
+        movpx_ld(Xmm7, Mecx, reg_MKP((nx)*RT_MKP_SIZE+RT_MKP_SAVE))         \
+        mkjpx_rx(W(XS), NONE, lb##_pn)                                      \
+        mkjpx_rx(W(XS), FULL, lb##_pf)                                      \
+        addwx_mi(Mecx, reg_MKP((nx)*RT_MKP_SIZE+RT_MKP_MIXD), IB(1))        \
+        jmpxx_lb(lb##_pd)                                                   \
+    LBL(lb##_pn)                                                            \
+        addwx_mi(Mecx, reg_MKP((nx)*RT_MKP_SIZE+RT_MKP_NONE), IB(1))        \
+        jmpxx_lb(lb##_pd)                                                   \
+    LBL(lb##_pf)                                                            \
+        addwx_mi(Mecx, reg_MKP((nx)*RT_MKP_SIZE+RT_MKP_FULL), IB(1))        \
+    LBL(lb##_pd)                                                            \
+        stack_ld(Recx)                                                      \
+        mkjpx_rx(W(XS), mask, lb)
+
+#else  /* RT_SIMD_PROFILE */
+
+/* mkp (jump to lb) if (S satisfies mask condition) */
+
+#define mkppx_rx(XS, mask, lb, nx)  /* destroys Reax, if S == mask jump */  \
+        mkjpx_rx(W(XS), mask, lb)
+
+#endif /* RT_SIMD_PROFILE */
+
+/******************************************************************************/
+/******************** fp status flags capture (optional) **********************/
+/******************************************************************************/
+
+/*
+ * Sticky fp status flags of the target (MXCSR, FPSR, FPSCR, MSACSR) are
+ * cleared upon ASM_ENTER and stored to reg_FPST (fpst[0] in rt_SIMD_REGS)
+ * before the control register is restored in ASM_LEAVE, thus the host can
+ * tell which ASM sections raise denormal, overflow and other fp exceptions
+ * and enable ASM_ENTER_F selectively. Flags are target-specific, use RT_FPS_*
+ * masks below to decode them. Note that FCTRL blocks and ROUND*, cvr* ops
+ * reload the whole control register on x86, ARMv7 and MIPS, therefore flags
+ * raised before them within the same ASM section are lost on these targets.
+ */
+
+#if RT_SIMD_FPSTAT
+
+#define fpsts_sa() /* destroys Reax, clears fp status flags */              \
+        fpswx_rx(Reax)
+
+#define fpsts_la() /* destroys Reax, Recx, stores fp status flags */        \
+        movxx_ld(Recx, Mebp, inf_REGS)                                      \
+        fpswx_rx(Reax)                                                      \
+        movwx_st(Reax, Mecx, reg_FPST)
+
+#else  /* RT_SIMD_FPSTAT */
+
+#define fpsts_sa()
+
+#define fpsts_la()
+
+#endif /* RT_SIMD_FPSTAT */
+
+#if   (defined RT_X86) || (defined RT_X32) || (defined RT_X64)
+
+#define RT_FPS_INV          0x01    /* invalid operation */
+#define RT_FPS_DEN          0x02    /* denormal operand */
+#define RT_FPS_DVZ          0x04    /* divide by zero */
+#define RT_FPS_OVF          0x08    /* overflow */
+#define RT_FPS_UNF          0x10    /* underflow (denormal result) */
+#define RT_FPS_INX          0x20    /* inexact */
+
+#elif (defined RT_A32) || (defined RT_A64) || (defined RT_ARM)
+
+#define RT_FPS_INV          0x01    /* invalid operation */
+#define RT_FPS_DEN          0x80    /* denormal operand (flushed, FZ only) */
+#define RT_FPS_DVZ          0x02    /* divide by zero */
+#define RT_FPS_OVF          0x04    /* overflow */
+#define RT_FPS_UNF          0x08    /* underflow (denormal result) */
+#define RT_FPS_INX          0x10    /* inexact */
+
+#elif (defined RT_M32) || (defined RT_M64)
+
+#define RT_FPS_INV          0x40    /* invalid operation */
+#define RT_FPS_DEN          0x00    /* denormal operand (not reported) */
+#define RT_FPS_DVZ          0x20    /* divide by zero */
+#define RT_FPS_OVF          0x10    /* overflow */
+#define RT_FPS_UNF          0x08    /* underflow (denormal result) */
+#define RT_FPS_INX          0x04    /* inexact */
+
+#elif (defined RT_P32) || (defined RT_P64)
+
+#define RT_FPS_INV          0x21    /* invalid operation (VX, VXSNAN) */
+#define RT_FPS_DEN          0x00    /* denormal operand (not reported) */
+#define RT_FPS_DVZ          0x04    /* divide by zero */
+#define RT_FPS_OVF          0x10    /* overflow */
+#define RT_FPS_UNF          0x08    /* underflow (denormal result) */
+#define RT_FPS_INX          0x02    /* inexact */
+
+#endif /* target-specific fp status flags */
+
 /******************************************************************************/
 /*********************************   CONFIG   *********************************/
 /******************************************************************************/
@@ -6426,6 +7412,43 @@ rt_si32 from_mask(rt_si32 mask)
 #include "rtarch.h"
 #include "rtconf.h"
 
+/*
+ * Check hand-written displacements against SIMD backend structures,
+ * placed after rtarch.h as displacement triplets are defined per target.
+ * Reordering or resizing fields without updating offsets fails the build.
+ */
+RT_CHECK_DISP(rt_SIMD_INFO, regs,       C, inf_REGS);
+RT_CHECK_DISP(rt_SIMD_INFO, ver,        0, inf_VER);
+RT_CHECK_DISP(rt_SIMD_INFO, fctrl,      0, inf_FCTRL(0));
+RT_CHECK_DISP(rt_SIMD_INFO, gpc01_32,   0, inf_GPC01_32);
+RT_CHECK_DISP(rt_SIMD_INFO, gpc02_32,   0, inf_GPC02_32);
+RT_CHECK_DISP(rt_SIMD_INFO, gpc03_32,   0, inf_GPC03_32);
+RT_CHECK_DISP(rt_SIMD_INFO, gpc04_32,   0, inf_GPC04_32);
+RT_CHECK_DISP(rt_SIMD_INFO, gpc05_32,   0, inf_GPC05_32);
+RT_CHECK_DISP(rt_SIMD_INFO, gpc06_32,   0, inf_GPC06_32);
+RT_CHECK_DISP(rt_SIMD_INFO, scr01,      0, inf_SCR01(0));
+RT_CHECK_DISP(rt_SIMD_INFO, scr02,      0, inf_SCR02(0));
+RT_CHECK_DISP(rt_SIMD_INFO, gpc07,      0, inf_GPC07);
+RT_CHECK_DISP(rt_SIMD_INFO, gpc01_64,   0, inf_GPC01_64);
+RT_CHECK_DISP(rt_SIMD_INFO, gpc02_64,   0, inf_GPC02_64);
+RT_CHECK_DISP(rt_SIMD_INFO, gpc03_64,   0, inf_GPC03_64);
+RT_CHECK_DISP(rt_SIMD_INFO, gpc04_64,   0, inf_GPC04_64);
+RT_CHECK_DISP(rt_SIMD_INFO, gpc05_64,   0, inf_GPC05_64);
+RT_CHECK_DISP(rt_SIMD_INFO, gpc06_64,   0, inf_GPC06_64);
+
+RT_CHECK_DISP(rt_SIMD_REGS, file,       0, reg_FILE);
+RT_CHECK_DISP(rt_SIMD_REGS, fpst,       0, reg_FPST);
+RT_CHECK_DISP(rt_SIMD_REGS, fcst,       0, reg_FCST);
+
+RT_CHECK(RT_DISP(reg_SPILL(28)) <= offsetof(rt_SIMD_REGS, fpst),
+         spill_slots_overflow);
+
+#if RT_SIMD_PROFILE
+
+RT_CHECK_DISP(rt_SIMD_REGS, mkp,        0, reg_MKP(0));
+
+#endif /* RT_SIMD_PROFILE */
+
 #endif /* RT_RTBASE_H */
 
 /******************************************************************************/
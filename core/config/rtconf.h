@@ -910,7 +910,7 @@
 /**** var-len **** SIMD instructions with fixed-16-bit element **** 256-bit ***/
 /******************************************************************************/
 
-#if   (RT_SIMD == 256) && !(defined RT_SVEX1)
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && !(defined RT_EMUX1)
 
 /* elm (D = S), store first SIMD element with natural alignment
  * allows to decouple scalar subset from SIMD where appropriate */
@@ -2180,7 +2180,7 @@
 /**** var-len **** SIMD instructions with fixed-32-bit element **** 256-bit ***/
 /******************************************************************************/
 
-#if   (RT_SIMD == 256) && !(defined RT_SVEX1)
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && !(defined RT_EMUX1)
 
 /* elm (D = S), store first SIMD element with natural alignment
  * allows to decouple scalar subset from SIMD where appropriate */
@@ -2775,6 +2775,30 @@
 #define mulox3ld(XD, XS, MT, DT)                                            \
         mulcx3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed */
+
+#define dphon_rr(XG, XS, XT)                                                \
+        dphcn_rr(W(XG), W(XS), W(XT))
+
+#define dphon_ld(XG, XS, MT, DT)                                            \
+        dphcn_ld(W(XG), W(XS), W(MT), W(DT))
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, signed */
+
+#define dpbon_rr(XG, XS, XT)                                                \
+        dpbcn_rr(W(XG), W(XS), W(XT))
+
+#define dpbon_ld(XG, XS, MT, DT)                                            \
+        dpbcn_ld(W(XG), W(XS), W(MT), W(DT))
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, unsigned */
+
+#define dpbox_rr(XG, XS, XT)                                                \
+        dpbcx_rr(W(XG), W(XS), W(XT))
+
+#define dpbox_ld(XG, XS, MT, DT)                                            \
+        dpbcx_ld(W(XG), W(XS), W(MT), W(DT))
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -3464,6 +3488,30 @@
 #define mulox3ld(XD, XS, MT, DT)                                            \
         mulix3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* dph (G = G + S * T) if (#G != #S && #G != #T) - half-pairs, signed */
+
+#define dphon_rr(XG, XS, XT)                                                \
+        dphin_rr(W(XG), W(XS), W(XT))
+
+#define dphon_ld(XG, XS, MT, DT)                                            \
+        dphin_ld(W(XG), W(XS), W(MT), W(DT))
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, signed */
+
+#define dpbon_rr(XG, XS, XT)                                                \
+        dpbin_rr(W(XG), W(XS), W(XT))
+
+#define dpbon_ld(XG, XS, MT, DT)                                            \
+        dpbin_ld(W(XG), W(XS), W(MT), W(DT))
+
+/* dpb (G = G + S * T) if (#G != #S && #G != #T) - byte-quads, unsigned */
+
+#define dpbox_rr(XG, XS, XT)                                                \
+        dpbix_rr(W(XG), W(XS), W(XT))
+
+#define dpbox_ld(XG, XS, MT, DT)                                            \
+        dpbix_ld(W(XG), W(XS), W(MT), W(DT))
+
 /* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -3560,7 +3608,7 @@
 /**** var-len **** SIMD instructions with fixed-64-bit element **** 256-bit ***/
 /******************************************************************************/
 
-#if   (RT_SIMD == 256) && !(defined RT_SVEX1)
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && !(defined RT_EMUX1)
 
 /* elm (D = S), store first SIMD element with natural alignment
  * allows to decouple scalar subset from SIMD where appropriate */
@@ -5075,6 +5123,9 @@
 #define addps3ld(XD, XS, MT, DT)                                            \
         addos3ld(W(XD), W(XS), W(MT), W(DT))
 
+#define addpsRrr(XD, XS, XT, mode)                                          \
+        addosRrr(W(XD), W(XS), W(XT), mode)
+
 #define adpps_rr(XG, XS) /* horizontal pairwise add, first 15-regs only */  \
         adpos_rr(W(XG), W(XS))
 
@@ -5107,6 +5158,9 @@
 #define subps3ld(XD, XS, MT, DT)                                            \
         subos3ld(W(XD), W(XS), W(MT), W(DT))
 
+#define subpsRrr(XD, XS, XT, mode)                                          \
+        subosRrr(W(XD), W(XS), W(XT), mode)
+
 /* mul (G = G * S), (D = S * T) if (#D != #S) */
 
 #define mulps_rr(XG, XS)                                                    \
@@ -5121,6 +5175,9 @@
 #define mulps3ld(XD, XS, MT, DT)                                            \
         mulos3ld(W(XD), W(XS), W(MT), W(DT))
 
+#define mulpsRrr(XD, XS, XT, mode)                                          \
+        mulosRrr(W(XD), W(XS), W(XT), mode)
+
 #define mlpps_rr(XG, XS) /* horizontal pairwise mul */                      \
         mlpos_rr(W(XG), W(XS))
 
@@ -5153,6 +5210,9 @@
 #define divps3ld(XD, XS, MT, DT)                                            \
         divos3ld(W(XD), W(XS), W(MT), W(DT))
 
+#define divpsRrr(XD, XS, XT, mode)                                          \
+        divosRrr(W(XD), W(XS), W(XT), mode)
+
 /* sqr (D = sqrt S) */
 
 #define sqrps_rr(XD, XS)                                                    \
@@ -5161,6 +5221,9 @@
 #define sqrps_ld(XD, MS, DS)                                                \
         sqros_ld(W(XD), W(MS), W(DS))
 
+#define sqrpsRrr(XD, XS, mode)                                              \
+        sqrosRrr(W(XD), W(XS), mode)
+
 /* cbr (D = cbrt S) */
 
 #define cbrps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
@@ -5491,6 +5554,12 @@
 #define cvrps_rr(XD, XS, mode)                                              \
         cvros_rr(W(XD), W(XS), mode)
 
+/* cvr (D = signed-int-to-fp S) with given rounding mode
+ * fp control register is reset to ROUNDN (cannot be used in FCTRL blocks) */
+
+#define cvrpn_rr(XD, XS, mode)                                              \
+        cvron_rr(W(XD), W(XS), mode)
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -7377,6 +7446,9 @@
 #define addps3ld(XD, XS, MT, DT)                                            \
         addqs3ld(W(XD), W(XS), W(MT), W(DT))
 
+#define addpsRrr(XD, XS, XT, mode)                                          \
+        addqsRrr(W(XD), W(XS), W(XT), mode)
+
 #define adpps_rr(XG, XS) /* horizontal pairwise add, first 15-regs only */  \
         adpqs_rr(W(XG), W(XS))
 
@@ -7409,6 +7481,9 @@
 #define subps3ld(XD, XS, MT, DT)                                            \
         subqs3ld(W(XD), W(XS), W(MT), W(DT))
 
+#define subpsRrr(XD, XS, XT, mode)                                          \
+        subqsRrr(W(XD), W(XS), W(XT), mode)
+
 /* mul (G = G * S), (D = S * T) if (#D != #S) */
 
 #define mulps_rr(XG, XS)                                                    \
@@ -7423,6 +7498,9 @@
 #define mulps3ld(XD, XS, MT, DT)                                            \
         mulqs3ld(W(XD), W(XS), W(MT), W(DT))
 
+#define mulpsRrr(XD, XS, XT, mode)                                          \
+        mulqsRrr(W(XD), W(XS), W(XT), mode)
+
 #define mlpps_rr(XG, XS) /* horizontal pairwise mul */                      \
         mlpqs_rr(W(XG), W(XS))
 
@@ -7455,6 +7533,9 @@
 #define divps3ld(XD, XS, MT, DT)                                            \
         divqs3ld(W(XD), W(XS), W(MT), W(DT))
 
+#define divpsRrr(XD, XS, XT, mode)                                          \
+        divqsRrr(W(XD), W(XS), W(XT), mode)
+
 /* sqr (D = sqrt S) */
 
 #define sqrps_rr(XD, XS)                                                    \
@@ -7463,6 +7544,9 @@
 #define sqrps_ld(XD, MS, DS)                                                \
         sqrqs_ld(W(XD), W(MS), W(DS))
 
+#define sqrpsRrr(XD, XS, mode)                                              \
+        sqrqsRrr(W(XD), W(XS), mode)
+
 /* cbr (D = cbrt S) */
 
 #define cbrps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
@@ -7793,6 +7877,12 @@
 #define cvrps_rr(XD, XS, mode)                                              \
         cvrqs_rr(W(XD), W(XS), mode)
 
+/* cvr (D = signed-int-to-fp S) with given rounding mode
+ * fp control register is reset to ROUNDN (cannot be used in FCTRL blocks) */
+
+#define cvrpn_rr(XD, XS, mode)                                              \
+        cvrqn_rr(W(XD), W(XS), mode)
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -0,0 +1,611 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTPOOL_H
+#define RT_RTPOOL_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtpool.h: SPMD parallel-for dispatcher over SIMD-aligned chunks
+ * (optional header for apps to include after rtbase.h).
+ *
+ * rt_ThreadPool owns per-worker rt_SIMD_INFO (or its app-specific extension),
+ * rt_SIMD_REGS and worker state in a single SIMD-aligned block, runs ASM_INIT
+ * for every worker once and then partitions index ranges [0, num) passed to
+ * run into chunks of (grain) elements rounded up to a multiple of S, so that
+ * every chunk except the last starts at a vector boundary and holds
+ * full vectors only (the last chunk takes the remainder as its tail).
+ * Chunks are spread over workers in contiguous ranges of nearly equal size,
+ * the kernel function is called once per chunk with worker's own info.
+ *
+ * For irregular workloads (render tiles, BVH packets) run_steal starts from
+ * the same static split, but treats each worker's range of chunks as a deque:
+ * the owner takes up to (batch) chunks at a time from its front and passes
+ * them to the kernel in a single call (amortizing ASM_ENTER/ASM_LEAVE),
+ * once empty it steals the back half of another worker's remaining range.
+ * Deques are guarded by per-worker spin-locks (never held two at a time).
+ * Both run and run_steal are served by the same parked workers,
+ * each with its own info and regs kept in place across runs.
+ *
+ * Threads are not created by the pool itself to keep headers
+ * platform-neutral, instead the app provides thread init/term callbacks
+ * along with memory alloc/free (sys_alloc/sys_free are not thread-safe).
+ * Worker 0 always runs on the calling thread, other workers are created
+ * once in the constructor via (f_init) and joined in the destructor via
+ * (f_term). Between runs they are parked on a condition variable, run bumps
+ * the start generation to wake them and waits for the done counter to reach
+ * the number of parked workers, so workers' info and regs stay in place.
+ * If (f_init) or (f_term) are RT_NULL all chunks run on the calling thread.
+ */
+
+/******************************************************************************/
+/********************************   TYPEDEFS   ********************************/
+/******************************************************************************/
+
+class rt_ThreadPool;
+
+/*
+ * Platform-specific callbacks provided by the app.
+ */
+typedef rt_pntr (*rt_FUNC_ALLOC)(rt_size size);
+typedef rt_void (*rt_FUNC_FREE)(rt_pntr ptr, rt_size size);
+typedef rt_void (*rt_FUNC_ENTRY)(rt_pntr arg);
+typedef rt_pntr (*rt_FUNC_INIT)(rt_si32 core, rt_FUNC_ENTRY func, rt_pntr arg);
+typedef rt_void (*rt_FUNC_TERM)(rt_pntr handle);
+
+/*
+ * SPMD kernel called once per chunk (or batch of adjacent chunks in run_steal)
+ * of (count) elements starting at (index),
+ * (info) is worker's own (with regs attached), (data) is passed through.
+ */
+typedef rt_void (*rt_FUNC_KERNEL)(rt_SIMD_INFO *info, rt_pntr data,
+                                  rt_size index, rt_size count);
+
+/*
+ * Per-worker state, filled in by run before workers are started,
+ * kept in worker's own block after its regs (away from other workers).
+ */
+struct rt_POOL_THREAD
+{
+    rt_ThreadPool      *pool;       /* owning pool */
+    rt_SIMD_INFO       *info;       /* worker's info (with regs attached) */
+    rt_pntr             hndl;       /* thread handle from f_init */
+
+    rt_si32             index;      /* worker's index in the pool */
+    volatile rt_si32    lock;       /* spin-lock guarding cbeg/cend */
+
+    rt_size             cbeg;       /* first chunk (inclusive) */
+    rt_size             cend;       /* last chunk (exclusive) */
+
+    rt_size             tnum;       /* chunks processed in last run */
+    rt_size             bnum;       /* kernel calls in last run */
+    rt_size             snum;       /* successful steals in last run */
+};
+
+/*
+ * Spin-lock primitives for deque access in run_steal,
+ * waiting threads spin on plain reads with a pause (or yield) in between.
+ */
+#if   (defined RT_WIN32) /* Win32, MSVC -------- for older versions --------- */
+
+#include <intrin.h>
+
+#define RT_POOL_LOCK(lk)                                                    \
+    while (_InterlockedExchange((volatile long *)&(lk), 1) != 0)            \
+        while ((lk) != 0) RT_POOL_PAUSE()
+
+#define RT_POOL_FREE(lk)                                                    \
+    _InterlockedExchange((volatile long *)&(lk), 0)
+
+#else /* --- Win64, GCC --- Linux, GCC -------------------------------------- */
+
+#define RT_POOL_LOCK(lk)                                                    \
+    while (__sync_lock_test_and_set(&(lk), 1) != 0)                        \
+        while ((lk) != 0) RT_POOL_PAUSE()
+
+#define RT_POOL_FREE(lk)                                                    \
+    __sync_lock_release(&(lk))
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/*
+ * Spin-wait hint and primitives for parking workers between runs
+ * (mutex and condition variables guarding start generation/done counter).
+ */
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+#include <windows.h>
+
+#define RT_POOL_PAUSE()     YieldProcessor()
+
+typedef CRITICAL_SECTION    rt_POOL_MUTX;
+typedef CONDITION_VARIABLE  rt_POOL_COND;
+
+#define RT_POOL_MINIT(mx)   InitializeCriticalSection(&(mx))
+#define RT_POOL_MDONE(mx)   DeleteCriticalSection(&(mx))
+#define RT_POOL_ENTER(mx)   EnterCriticalSection(&(mx))
+#define RT_POOL_LEAVE(mx)   LeaveCriticalSection(&(mx))
+
+#define RT_POOL_CINIT(cv)   InitializeConditionVariable(&(cv))
+#define RT_POOL_CDONE(cv)   /* no destruction needed */
+#define RT_POOL_SLEEP(cv, mx)                                               \
+    SleepConditionVariableCS(&(cv), &(mx), INFINITE)
+#define RT_POOL_WAKE(cv)    WakeAllConditionVariable(&(cv))
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#include <pthread.h>
+#include <sched.h>
+
+#if   (defined RT_X32) || (defined RT_X64) || (defined RT_X86)
+#define RT_POOL_PAUSE()     __builtin_ia32_pause()
+#else /* modern RISCs */
+#define RT_POOL_PAUSE()     sched_yield()
+#endif /* RT_X32, RT_X64, RT_X86 */
+
+typedef pthread_mutex_t     rt_POOL_MUTX;
+typedef pthread_cond_t      rt_POOL_COND;
+
+#define RT_POOL_MINIT(mx)   pthread_mutex_init(&(mx), NULL)
+#define RT_POOL_MDONE(mx)   pthread_mutex_destroy(&(mx))
+#define RT_POOL_ENTER(mx)   pthread_mutex_lock(&(mx))
+#define RT_POOL_LEAVE(mx)   pthread_mutex_unlock(&(mx))
+
+#define RT_POOL_CINIT(cv)   pthread_cond_init(&(cv), NULL)
+#define RT_POOL_CDONE(cv)   pthread_cond_destroy(&(cv))
+#define RT_POOL_SLEEP(cv, mx)                                               \
+    pthread_cond_wait(&(cv), &(mx))
+#define RT_POOL_WAKE(cv)    pthread_cond_broadcast(&(cv))
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/******************************************************************************/
+/******************************   THREAD POOL   *******************************/
+/******************************************************************************/
+
+class rt_ThreadPool
+{
+/*  fields */
+
+    private:
+
+    /* platform-specific callbacks */
+    rt_FUNC_ALLOC       f_alloc;
+    rt_FUNC_FREE        f_free;
+    rt_FUNC_INIT        f_init;
+    rt_FUNC_TERM        f_term;
+
+    /* number of workers */
+    rt_si32             thnum;
+
+    /* info size rounded up to SIMD alignment */
+    rt_size             isize;
+    /* regs size rounded up to SIMD alignment */
+    rt_size             rsize;
+    /* per-worker block size (info + regs + state) */
+    rt_size             wsize;
+
+    /* memory block for all workers' info, regs and state */
+    rt_pntr             pmem;
+    rt_size             msize;
+    rt_byte            *pbase;
+
+    /* current run parameters */
+    rt_FUNC_KERNEL      func;
+    rt_pntr             data;
+    rt_size             num;
+    rt_size             grain;
+    rt_size             batch;
+    rt_si32             wnum;
+
+    /* current run worker function (static split or work-stealing) */
+    rt_void (rt_ThreadPool::*fwrk)(rt_POOL_THREAD *);
+
+    /* parked workers (thnum - 1, or 0 without thread callbacks) */
+    rt_si32             pnum;
+
+    /* parking state, guarded by pmutx */
+    rt_POOL_MUTX        pmutx;
+    rt_POOL_COND        pcbeg;      /* signaled when pgen is bumped */
+    rt_POOL_COND        pcend;      /* signaled when pend reaches pnum */
+    rt_ui32             pgen;       /* start generation of runs */
+    rt_si32             pend;       /* parked workers done in this run */
+    rt_si32             pstop;      /* set by destructor to stop workers */
+
+/*  methods */
+
+    private:
+
+    /*
+     * Return state of worker (k).
+     */
+    rt_POOL_THREAD *thread(rt_si32 k)
+    {
+        return (rt_POOL_THREAD *)(pbase + wsize * k + isize + rsize);
+    }
+
+    /*
+     * Call kernel over chunks [cbeg, cend) as a single range of elements.
+     */
+    rt_void call(rt_POOL_THREAD *th, rt_size cbeg, rt_size cend)
+    {
+        rt_size index = cbeg * grain;
+        rt_size count = RT_MIN(num, cend * grain) - index;
+
+        func(th->info, data, index, count);
+
+        th->tnum += cend - cbeg;
+        th->bnum += 1;
+    }
+
+    /*
+     * Process worker's range of chunks one by one (static split).
+     */
+    rt_void work(rt_POOL_THREAD *th)
+    {
+        rt_size c;
+
+        for (c = th->cbeg; c < th->cend; c++)
+        {
+            call(th, c, c + 1);
+        }
+    }
+
+    /*
+     * Process worker's deque in batches from the front, then steal
+     * the back half of other workers' deques until all are empty.
+     */
+    rt_void work_steal(rt_POOL_THREAD *th)
+    {
+        rt_POOL_THREAD *vt;
+        rt_size cbeg, cend;
+        rt_si32 k;
+
+        while (1)
+        {
+            RT_POOL_LOCK(th->lock);
+            cbeg = th->cbeg;
+            cend = RT_MIN(th->cend, cbeg + batch);
+            th->cbeg = cend;
+            RT_POOL_FREE(th->lock);
+
+            if (cbeg < cend)
+            {
+                call(th, cbeg, cend);
+                continue;
+            }
+
+            cbeg = cend = 0;
+
+            for (k = 1; k < wnum && cbeg == cend; k++)
+            {
+                vt = thread((th->index + k) % wnum);
+
+                RT_POOL_LOCK(vt->lock);
+                cend = vt->cend;
+                cbeg = cend - (cend - vt->cbeg + 1) / 2;
+                vt->cend = cbeg;
+                RT_POOL_FREE(vt->lock);
+            }
+
+            if (cbeg == cend)
+            {
+                break;
+            }
+
+            th->snum += 1;
+
+            RT_POOL_LOCK(th->lock);
+            th->cbeg = cbeg;
+            th->cend = cend;
+            RT_POOL_FREE(th->lock);
+        }
+    }
+
+    /*
+     * Park worker until next run (or stop) is signaled, run its part
+     * of the current run, report done and park again.
+     */
+    rt_void park(rt_POOL_THREAD *th)
+    {
+        rt_ui32 gen = 0;
+        rt_si32 stop = 0;
+
+        while (1)
+        {
+            RT_POOL_ENTER(pmutx);
+            while (pgen == gen && pstop == 0)
+            {
+                RT_POOL_SLEEP(pcbeg, pmutx);
+            }
+            gen  = pgen;
+            stop = pstop;
+            RT_POOL_LEAVE(pmutx);
+
+            if (stop != 0)
+            {
+                break;
+            }
+
+            if (th->index < wnum)
+            {
+                (this->*fwrk)(th);
+            }
+
+            RT_POOL_ENTER(pmutx);
+            pend += 1;
+            if (pend == pnum)
+            {
+                RT_POOL_WAKE(pcend);
+            }
+            RT_POOL_LEAVE(pmutx);
+        }
+    }
+
+    /*
+     * Thread entry point passed to f_init, runs until the pool is destroyed.
+     */
+    static
+    rt_void entry(rt_pntr arg)
+    {
+        rt_POOL_THREAD *th = (rt_POOL_THREAD *)arg;
+
+        th->pool->park(th);
+    }
+
+    /*
+     * Set run parameters, split chunks statically over workers,
+     * wake parked workers to run (fwrk) on theirs, run worker 0
+     * on the calling thread and wait for parked workers to finish.
+     */
+    rt_void dispatch(rt_FUNC_KERNEL func, rt_pntr data, rt_size num,
+                     rt_size grain, rt_size batch,
+                     rt_void (rt_ThreadPool::*fwrk)(rt_POOL_THREAD *))
+    {
+        rt_POOL_THREAD *th;
+        rt_si32 k;
+        rt_size nch;
+
+        for (k = 0; k < thnum; k++)
+        {
+            th = thread(k);
+            th->cbeg = th->cend = 0;
+            th->tnum = th->bnum = th->snum = 0;
+        }
+
+        if (num <= 0)
+        {
+            return;
+        }
+
+        if (grain <= 0)
+        {
+            grain = (num + thnum - 1) / thnum;
+        }
+
+        this->func  = func;
+        this->data  = data;
+        this->num   = num;
+        this->grain = (grain + S - 1) / S * S;
+        this->batch = RT_MAX(batch, 1);
+        this->fwrk  = fwrk;
+
+        nch = (num + this->grain - 1) / this->grain;
+        wnum = (rt_si32)RT_MIN(nch, pnum + 1);
+
+        for (k = 0; k < wnum; k++)
+        {
+            th = thread(k);
+            th->cbeg = nch * k / wnum;
+            th->cend = nch * (k + 1) / wnum;
+        }
+
+        if (wnum > 1)
+        {
+            RT_POOL_ENTER(pmutx);
+            pend  = 0;
+            pgen += 1;
+            RT_POOL_WAKE(pcbeg);
+            RT_POOL_LEAVE(pmutx);
+        }
+
+        (this->*fwrk)(thread(0));
+
+        if (wnum > 1)
+        {
+            RT_POOL_ENTER(pmutx);
+            while (pend < pnum)
+            {
+                RT_POOL_SLEEP(pcend, pmutx);
+            }
+            RT_POOL_LEAVE(pmutx);
+        }
+    }
+
+    public:
+
+    /*
+     * Allocate and initialize (thnum) workers, each with its own
+     * SIMD-aligned info block of (isize) bytes (0 for sizeof(rt_SIMD_INFO),
+     * larger to accommodate app-specific info extensions) and regs block,
+     * start workers 1..n-1 via (f_init) and park them until the first run.
+     */
+    rt_ThreadPool(rt_si32 thnum, rt_size isize,
+                  rt_FUNC_ALLOC f_alloc, rt_FUNC_FREE f_free,
+                  rt_FUNC_INIT f_init, rt_FUNC_TERM f_term)
+    {
+        rt_si32 k;
+
+        this->f_alloc = f_alloc;
+        this->f_free  = f_free;
+        this->f_init  = f_init;
+        this->f_term  = f_term;
+
+        this->thnum = RT_MAX(thnum, 1);
+
+        isize = RT_MAX(isize, (rt_size)sizeof(rt_SIMD_INFO));
+
+        this->isize = (isize + RT_SIMD_ALIGN - 1) & ~(RT_SIMD_ALIGN - 1);
+        this->rsize = (sizeof(rt_SIMD_REGS) + RT_SIMD_ALIGN - 1)
+                                                    & ~(RT_SIMD_ALIGN - 1);
+        this->wsize = this->isize + this->rsize +
+                     ((sizeof(rt_POOL_THREAD) + RT_SIMD_ALIGN - 1)
+                                                    & ~(RT_SIMD_ALIGN - 1));
+
+        msize = this->thnum * wsize + RT_SIMD_ALIGN - 1;
+        pmem  = f_alloc(msize);
+        memset(pmem, 0, msize);
+
+        pbase = (rt_byte *)(((rt_word)pmem + RT_SIMD_ALIGN - 1)
+                                                    & ~(RT_SIMD_ALIGN - 1));
+
+        for (k = 0; k < this->thnum; k++)
+        {
+            rt_SIMD_INFO *info = (rt_SIMD_INFO *)(pbase + wsize * k);
+            rt_SIMD_REGS *regs = (rt_SIMD_REGS *)(pbase + wsize * k
+                                                        + this->isize);
+            ASM_INIT(info, regs)
+
+            rt_POOL_THREAD *th = thread(k);
+
+            th->pool  = this;
+            th->info  = info;
+            th->hndl  = RT_NULL;
+            th->index = k;
+            th->lock  = 0;
+        }
+
+        func  = RT_NULL;
+        data  = RT_NULL;
+        num   = 0;
+        grain = 0;
+        batch = 0;
+        wnum  = 0;
+        fwrk  = RT_NULL;
+
+        pnum  = f_init == RT_NULL || f_term == RT_NULL ? 0 : this->thnum - 1;
+        pgen  = 0;
+        pend  = 0;
+        pstop = 0;
+
+        RT_POOL_MINIT(pmutx);
+        RT_POOL_CINIT(pcbeg);
+        RT_POOL_CINIT(pcend);
+
+        for (k = 1; k <= pnum; k++)
+        {
+            rt_POOL_THREAD *th = thread(k);
+
+            th->hndl = f_init(k, entry, th);
+        }
+    }
+
+    /*
+     * Stop and join parked workers, release all workers' resources.
+     */
+   ~rt_ThreadPool()
+    {
+        rt_si32 k;
+
+        RT_POOL_ENTER(pmutx);
+        pstop = 1;
+        RT_POOL_WAKE(pcbeg);
+        RT_POOL_LEAVE(pmutx);
+
+        for (k = 1; k <= pnum; k++)
+        {
+            rt_POOL_THREAD *th = thread(k);
+
+            f_term(th->hndl);
+            th->hndl = RT_NULL;
+        }
+
+        RT_POOL_CDONE(pcend);
+        RT_POOL_CDONE(pcbeg);
+        RT_POOL_MDONE(pmutx);
+
+        for (k = 0; k < thnum; k++)
+        {
+            ASM_DONE(thread(k)->info)
+        }
+
+        f_free(pmem, msize);
+    }
+
+    /*
+     * Return number of workers.
+     */
+    rt_si32 get_thnum()
+    {
+        return thnum;
+    }
+
+    /*
+     * Return info of worker (k) for the app to fill in
+     * its own fields before run (common for all chunks of that worker),
+     * filled in fields stay in place across runs of either kind.
+     */
+    rt_SIMD_INFO *get_info(rt_si32 k)
+    {
+        return thread(k)->info;
+    }
+
+    /*
+     * Return number of chunks processed by worker (k) in the last run.
+     */
+    rt_size get_tiles(rt_si32 k)
+    {
+        return thread(k)->tnum;
+    }
+
+    /*
+     * Return number of kernel calls made by worker (k) in the last run.
+     */
+    rt_size get_calls(rt_si32 k)
+    {
+        return thread(k)->bnum;
+    }
+
+    /*
+     * Return number of steals made by worker (k) in the last run.
+     */
+    rt_size get_steals(rt_si32 k)
+    {
+        return thread(k)->snum;
+    }
+
+    /*
+     * Run kernel (func) with (data) over index range [0, num) split into
+     * chunks of (grain) elements rounded up to a multiple of S
+     * (0 for one chunk per worker), return when all chunks are done.
+     */
+    rt_void run(rt_FUNC_KERNEL func, rt_pntr data, rt_size num, rt_size grain)
+    {
+        dispatch(func, data, num, grain, 1, &rt_ThreadPool::work);
+    }
+
+    /*
+     * Same as run, but with work-stealing between workers' deques,
+     * kernel is called over up to (batch) adjacent chunks at a time
+     * (0 or 1 for a single chunk per call).
+     */
+    rt_void run_steal(rt_FUNC_KERNEL func, rt_pntr data, rt_size num,
+                      rt_size grain, rt_size batch)
+    {
+        dispatch(func, data, num, grain, batch, &rt_ThreadPool::work_steal);
+    }
+};
+
+#endif /* RT_RTPOOL_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
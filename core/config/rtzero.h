@@ -252,6 +252,27 @@
 #undef XmmU /* external name for SIMD register, may be reserved in most cases */
 #undef XmmV /* external name for SIMD register, may be reserved in most cases */
 
+#undef Pm1 /* external name for merging predicate register */
+#undef Pm2 /* external name for merging predicate register */
+#undef Pm3 /* external name for merging predicate register */
+#undef Pm4 /* external name for merging predicate register */
+#undef Pm5 /* external name for merging predicate register */
+#undef Pm6 /* external name for merging predicate register */
+
+#undef Pz1 /* external name for zeroing predicate register */
+#undef Pz2 /* external name for zeroing predicate register */
+#undef Pz3 /* external name for zeroing predicate register */
+#undef Pz4 /* external name for zeroing predicate register */
+#undef Pz5 /* external name for zeroing predicate register */
+#undef Pz6 /* external name for zeroing predicate register */
+
+#undef Px1 /* external name for plain predicate register */
+#undef Px2 /* external name for plain predicate register */
+#undef Px3 /* external name for plain predicate register */
+#undef Px4 /* external name for plain predicate register */
+#undef Px5 /* external name for plain predicate register */
+#undef Px6 /* external name for plain predicate register */
+
 /******************************************************************************/
 /*****************   SIMD FLAGS EXTENDED COMPATIBILITY LAYER   ****************/
 /******************************************************************************/
@@ -442,6 +463,9 @@
 #if   !(defined RT_256X1) && (RT_256)
 #define         RT_256X1     (RT_256)
 #endif
+#if   !(defined RT_EMUX1) && (RT_256) & 0x4
+#define         RT_EMUX1     (RT_256)
+#endif
 #if   !(defined RT_128X2) && (RT_256_R8)
 #define         RT_128X2     (RT_256_R8)
 #endif
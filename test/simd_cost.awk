@@ -0,0 +1,153 @@
+#
+# Static cost model for an RT_SIZE_TEST build (in two passes via llvm-mca),
+# 1st pass (default) turns "objdump -d -t -C --no-show-raw-insn" output into
+# llvm-mca input with a code region per instruction macro (sz_ labels)
+# and per kernel (s_test, l_ and t_ functions, first clone only),
+# 2nd pass (-v mode=csv) turns llvm-mca output into CSV rows
+# (kind,name,insns,uops,lat,rthru,cycles,ports) per code region, where
+# uops and cycles are per iteration, lat is the sum of instruction latencies,
+# rthru is the block reciprocal throughput and ports are the resources used.
+# Kernel regions are straight-line sums over their code, loops are not
+# unrolled, branches are kept only as instructions (targets are dropped).
+#
+
+# symbol table entries, macros which emit no code share their address
+# with the next label, disassembly shows only one label per address,
+# the last one defined at that address owns the code which follows
+mode != "csv" && /^[0-9a-f]+ .*[ \t]sz_[a-z0-9_]+$/ {
+    owner[$1] = $NF
+    next
+}
+
+mode != "csv" && /^[0-9a-f]+ <.*>:$/ {
+    name = $0
+    sub(/^[0-9a-f]+ </, "", name)
+    sub(/>:$/, "", name)
+
+    flush()
+
+    if (index(name, "(") > 0)
+    {
+        sub(/\(.*/, "", name)
+        rgn = name ~ /^(s_test[0-9]+|[lt]_[a-z0-9]+)$/ ? "kernel:" name : ""
+    }
+    else
+    if (name ~ /^sz_/)
+    {
+        name = owner[$1] != "" ? owner[$1] : name
+        rgn = name != "sz_end" ? "macro:" substr(name, 4) : ""
+    }
+    next
+}
+
+# instructions, objdump-only prefixes and comments are removed,
+# branch targets are replaced with 0 as llvm-mca ignores them anyway
+mode != "csv" && /^ *[0-9a-f]+:\t/ {
+    if (rgn == "")
+    {
+        next
+    }
+    n = split($0, f, "\t")
+    ins = f[n]
+    sub(/[ \t]*#.*$/, "", ins)
+    while (ins ~ /^(rex(\.[WRXB]+)?|addr32|data16|ds|cs|notrack) /)
+    {
+        sub(/^[^ ]+ +/, "", ins)
+    }
+    sub(/[0-9a-f]+ <[^>]*>$/, "0", ins)
+
+    if (ins != "" && ins !~ /^\(bad\)/)
+    {
+        code[++nc] = ins
+    }
+}
+
+function flush(  k)
+{
+    if (rgn != "" && nc > 0 && !(rgn in done))
+    {
+        done[rgn] = 1
+        print "# LLVM-MCA-BEGIN " rgn
+        for (k = 1; k <= nc; k++)
+        {
+            print "\t" code[k]
+        }
+        print "# LLVM-MCA-END"
+    }
+    nc = 0
+}
+
+# llvm-mca region summary
+mode == "csv" && /^\[[0-9]+\] Code Region - / {
+    out()
+    name = $0
+    sub(/^.* Code Region - /, "", name)
+    split(name, r, ":")
+    kind = r[1]; name = r[2]
+    lat = 0; part = ""; nres = 0
+    next
+}
+
+mode == "csv" && /^Iterations: /        { its = $2;  next }
+mode == "csv" && /^Instructions: /      { ins = $2;  next }
+mode == "csv" && /^Total Cycles: /      { cyc = $3;  next }
+mode == "csv" && /^Total uOps: /        { uop = $3;  next }
+mode == "csv" && /^Block RThroughput: / { thr = $3;  next }
+
+mode == "csv" && /^\[1\] +\[2\] +\[3\]/ { part = "info"; next }
+mode == "csv" && /^Resources:$/         { part = "res";  next }
+mode == "csv" && /^Resource pressure per iteration:$/ { part = "prs"; next }
+
+mode == "csv" && /^$/ {
+    part = ""
+    next
+}
+
+mode == "csv" && part == "info" && /^ *[0-9]+ +[0-9]+ / {
+    lat += $2
+    next
+}
+
+mode == "csv" && part == "res" && /^\[[0-9.]+\] +- / {
+    res[$1] = $3
+    next
+}
+
+mode == "csv" && part == "prs" && /^\[/ {
+    nres = split($0, hdr, " ")
+    next
+}
+
+mode == "csv" && part == "prs" && nres > 0 {
+    split($0, val, " ")
+    for (k = 1; k <= nres; k++)
+    {
+        if (val[k] != "-")
+        {
+            ports = ports (ports != "" ? "+" : "") res[hdr[k]]
+        }
+    }
+    part = ""
+    next
+}
+
+function out()
+{
+    if (name != "" && its > 0)
+    {
+        printf "%s,%s,%.2f,%.2f,%d,%.2f,%.2f,%s\n", kind, name,
+                ins / its, uop / its, lat, thr, cyc / its, ports
+    }
+    name = ""; ports = ""
+}
+
+END {
+    if (mode == "csv")
+    {
+        out()
+    }
+    else
+    {
+        flush()
+    }
+}
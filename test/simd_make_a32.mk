@@ -8,7 +8,12 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
+
+SIZE_LIST =
+
+MCA_CPU = cortex-a57
 
 
 build: simd_test_a32
@@ -19,6 +24,35 @@ strip:
 clean:
 	rm simd_test.a32*
 
+size:
+	aarch64-linux-gnu-g++ -O3 -c -mabi=ilp32 \
+        -DRT_LINUX -DRT_A32 -DRT_128=1 -DRT_DEBUG=0 -DRT_SIZE_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${SIZE_LIST} ${INC_PATH} ${SRC_LIST} -o simd_size.a32.o
+	aarch64-linux-gnu-objdump -d -t -C simd_size.a32.o | \
+        awk -f simd_size.awk | sort -t, -k3,3nr > simd_size.a32.csv
+
+cost: size
+	aarch64-linux-gnu-objdump -d -t -C --no-show-raw-insn simd_size.a32.o | \
+        awk -f simd_cost.awk > simd_cost.a32.s
+	llvm-mca -mtriple=aarch64 -mcpu=${MCA_CPU} simd_cost.a32.s | \
+        awk -v mode=csv -f simd_cost.awk | sort -t, -k6,6nr > simd_cost.a32.csv
+
+vreg:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	aarch64-linux-gnu-g++ -O3 -g -static -mabi=ilp32 \
+        -DRT_LINUX -DRT_A32 -DRT_128=1 -DRT_DEBUG=0 -DRT_VREG_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_vreg.a32
+
+spmd:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	awk -f simd_spmd.awk simd_test.spmd | awk -f simd_vreg.awk > simd_spmd.h
+	aarch64-linux-gnu-g++ -O3 -g -static -mabi=ilp32 \
+        -DRT_LINUX -DRT_A32 -DRT_128=1 -DRT_DEBUG=0 -DRT_SPMD_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_spmd.a32
+
 
 simd_test_a32:
 	aarch64-linux-gnu-g++ -O3 -g -static -mabi=ilp32 \
@@ -8,7 +8,12 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
+
+SIZE_LIST =
+
+MCA_CPU = cortex-a57
 
 
 build: build_a64 build_a64sve
@@ -19,6 +24,35 @@ strip:
 clean:
 	rm simd_test.a64*
 
+size:
+	aarch64-linux-gnu-g++ -O3 -c \
+        -DRT_LINUX -DRT_A64 -DRT_128=1 -DRT_DEBUG=0 -DRT_SIZE_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${SIZE_LIST} ${INC_PATH} ${SRC_LIST} -o simd_size.a64.o
+	aarch64-linux-gnu-objdump -d -t -C simd_size.a64.o | \
+        awk -f simd_size.awk | sort -t, -k3,3nr > simd_size.a64.csv
+
+cost: size
+	aarch64-linux-gnu-objdump -d -t -C --no-show-raw-insn simd_size.a64.o | \
+        awk -f simd_cost.awk > simd_cost.a64.s
+	llvm-mca -mtriple=aarch64 -mcpu=${MCA_CPU} simd_cost.a64.s | \
+        awk -v mode=csv -f simd_cost.awk | sort -t, -k6,6nr > simd_cost.a64.csv
+
+vreg:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	aarch64-linux-gnu-g++ -O3 -g -static \
+        -DRT_LINUX -DRT_A64 -DRT_128=1 -DRT_DEBUG=0 -DRT_VREG_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_vreg.a64_32
+
+spmd:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	awk -f simd_spmd.awk simd_test.spmd | awk -f simd_vreg.awk > simd_spmd.h
+	aarch64-linux-gnu-g++ -O3 -g -static \
+        -DRT_LINUX -DRT_A64 -DRT_128=1 -DRT_DEBUG=0 -DRT_SPMD_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_spmd.a64_32
+
 
 build_a64: simd_test_a64_32 simd_test_a64_64 simd_test_a64f32 simd_test_a64f64
 
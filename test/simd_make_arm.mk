@@ -8,7 +8,10 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
+
+SIZE_LIST =
 
 
 build: simd_test_arm_v1 simd_test_arm_v2
@@ -19,6 +22,29 @@ strip:
 clean:
 	rm simd_test.arm_v*
 
+size:
+	arm-linux-gnueabi-g++ -O3 -c -march=armv7-a -marm \
+        -DRT_LINUX -DRT_ARM -DRT_128=1 -DRT_DEBUG=0 -DRT_SIZE_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${SIZE_LIST} ${INC_PATH} ${SRC_LIST} -o simd_size.arm.o
+	arm-linux-gnueabi-objdump -d -t -C simd_size.arm.o | \
+        awk -f simd_size.awk | sort -t, -k3,3nr > simd_size.arm.csv
+
+vreg:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	arm-linux-gnueabi-g++ -O3 -g -static -march=armv7-a -marm \
+        -DRT_LINUX -DRT_ARM -DRT_128=1 -DRT_DEBUG=0 -DRT_VREG_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_vreg.arm_v1
+
+spmd:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	awk -f simd_spmd.awk simd_test.spmd | awk -f simd_vreg.awk > simd_spmd.h
+	arm-linux-gnueabi-g++ -O3 -g -static -march=armv7-a -marm \
+        -DRT_LINUX -DRT_ARM -DRT_128=1 -DRT_DEBUG=0 -DRT_SPMD_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_spmd.arm_v1
+
 
 simd_test_arm_v1:
 	arm-linux-gnueabi-g++ -O3 -g -static -march=armv7-a -marm \
@@ -8,7 +8,10 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
+
+SIZE_LIST =
 
 
 build: simd_test_m32Lr5 simd_test_m32Br5
@@ -19,6 +22,29 @@ strip:
 clean:
 	rm simd_test.m32*
 
+size:
+	mips-mti-linux-gnu-g++ -O3 -c -EL -mips32r5 -mmsa -mnan=2008 \
+        -DRT_LINUX -DRT_M32 -DRT_128=1 -DRT_DEBUG=0 -DRT_SIZE_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${SIZE_LIST} ${INC_PATH} ${SRC_LIST} -o simd_size.m32.o
+	mips-mti-linux-gnu-objdump -d -t -C simd_size.m32.o | \
+        awk -f simd_size.awk | sort -t, -k3,3nr > simd_size.m32.csv
+
+vreg:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	mips-mti-linux-gnu-g++ -O3 -g -static -EL -mips32r5 -mmsa -mnan=2008 \
+        -DRT_LINUX -DRT_M32 -DRT_128=1 -DRT_DEBUG=0 -DRT_VREG_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_vreg.m32Lr5
+
+spmd:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	awk -f simd_spmd.awk simd_test.spmd | awk -f simd_vreg.awk > simd_spmd.h
+	mips-mti-linux-gnu-g++ -O3 -g -static -EL -mips32r5 -mmsa -mnan=2008 \
+        -DRT_LINUX -DRT_M32 -DRT_128=1 -DRT_DEBUG=0 -DRT_SPMD_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_spmd.m32Lr5
+
 
 simd_test_m32Lr5:
 	mips-mti-linux-gnu-g++ -O3 -g -static -EL -mips32r5 -mmsa -mnan=2008 \
@@ -8,7 +8,10 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
+
+SIZE_LIST =
 
 
 build: build_le build_be
@@ -19,6 +22,29 @@ strip:
 clean:
 	rm simd_test.m64*
 
+size:
+	mips-img-linux-gnu-g++ -O3 -c -EL -mabi=64 -mmsa \
+        -DRT_LINUX -DRT_M64=6 -DRT_128=1 -DRT_DEBUG=0 -DRT_SIZE_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${SIZE_LIST} ${INC_PATH} ${SRC_LIST} -o simd_size.m64.o
+	mips-img-linux-gnu-objdump -d -t -C simd_size.m64.o | \
+        awk -f simd_size.awk | sort -t, -k3,3nr > simd_size.m64.csv
+
+vreg:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	mips-img-linux-gnu-g++ -O3 -g -static -EL -mabi=64 -mmsa \
+        -DRT_LINUX -DRT_M64=6 -DRT_128=1 -DRT_DEBUG=0 -DRT_VREG_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_vreg.m64_32Lr6
+
+spmd:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	awk -f simd_spmd.awk simd_test.spmd | awk -f simd_vreg.awk > simd_spmd.h
+	mips-img-linux-gnu-g++ -O3 -g -static -EL -mabi=64 -mmsa \
+        -DRT_LINUX -DRT_M64=6 -DRT_128=1 -DRT_DEBUG=0 -DRT_SPMD_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_spmd.m64_32Lr6
+
 
 build_le: simd_test_m64_32Lr6 simd_test_m64_64Lr6 \
           simd_test_m64f32Lr6 simd_test_m64f64Lr6
@@ -8,7 +8,10 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
+
+SIZE_LIST =
 
 
 build: simd_test_p32Bg4 simd_test_p32Bp7 simd_test_p32Bp8 simd_test_p32Bp9
@@ -19,6 +22,29 @@ strip:
 clean:
 	rm simd_test.p32*
 
+size:
+	powerpc-linux-gnu-g++ -O3 -c -DRT_SIMD_COMPAT_VSX=0 \
+        -DRT_LINUX -DRT_P32 -DRT_128=4 -DRT_DEBUG=0 -DRT_SIZE_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=1 \
+        ${SIZE_LIST} ${INC_PATH} ${SRC_LIST} -o simd_size.p32.o
+	powerpc-linux-gnu-objdump -d -t -C simd_size.p32.o | \
+        awk -f simd_size.awk | sort -t, -k3,3nr > simd_size.p32.csv
+
+vreg:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	powerpc-linux-gnu-g++ -O3 -g -static -DRT_SIMD_COMPAT_VSX=0 \
+        -DRT_LINUX -DRT_P32 -DRT_128=4 -DRT_DEBUG=0 -DRT_VREG_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=1 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_vreg.p32Bg4
+
+spmd:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	awk -f simd_spmd.awk simd_test.spmd | awk -f simd_vreg.awk > simd_spmd.h
+	powerpc-linux-gnu-g++ -O3 -g -static -DRT_SIMD_COMPAT_VSX=0 \
+        -DRT_LINUX -DRT_P32 -DRT_128=4 -DRT_DEBUG=0 -DRT_SPMD_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=1 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_spmd.p32Bg4
+
 
 simd_test_p32Bg4:
 	powerpc-linux-gnu-g++ -O3 -g -static -DRT_SIMD_COMPAT_VSX=0 \
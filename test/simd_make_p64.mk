@@ -8,7 +8,10 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
+
+SIZE_LIST =
 
 
 build: build_p9 build_le build_be
@@ -20,6 +23,29 @@ strip:
 clean:
 	rm simd_test.p64*
 
+size:
+	powerpc64le-linux-gnu-g++ -O2 -c \
+        -DRT_LINUX -DRT_P64 -DRT_128=2 -DRT_DEBUG=0 -DRT_SIZE_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${SIZE_LIST} ${INC_PATH} ${SRC_LIST} -o simd_size.p64.o
+	powerpc64le-linux-gnu-objdump -d -t -C simd_size.p64.o | \
+        awk -f simd_size.awk | sort -t, -k3,3nr > simd_size.p64.csv
+
+vreg:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	powerpc64le-linux-gnu-g++ -O2 -g -static \
+        -DRT_LINUX -DRT_P64 -DRT_128=2 -DRT_DEBUG=0 -DRT_VREG_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_vreg.p64_32Lp9
+
+spmd:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	awk -f simd_spmd.awk simd_test.spmd | awk -f simd_vreg.awk > simd_spmd.h
+	powerpc64le-linux-gnu-g++ -O2 -g -static \
+        -DRT_LINUX -DRT_P64 -DRT_128=2 -DRT_DEBUG=0 -DRT_SPMD_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_spmd.p64_32Lp9
+
 
 build_p9: simd_test_p64_32Lp9 simd_test_p64_64Lp9 \
           simd_test_p64f32Lp9 simd_test_p64f64Lp9
@@ -8,7 +8,12 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
+
+SIZE_LIST =
+
+MCA_CPU = skylake
 
 
 build: simd_test_x32
@@ -19,6 +24,35 @@ strip:
 clean:
 	rm simd_test.x32*
 
+size:
+	g++ -O3 -c -mx32 \
+        -DRT_LINUX -DRT_X32 -DRT_256_R8=4 -DRT_DEBUG=0 -DRT_SIZE_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${SIZE_LIST} ${INC_PATH} ${SRC_LIST} -o simd_size.x32.o
+	objdump -d -t -C simd_size.x32.o | \
+        awk -f simd_size.awk | sort -t, -k3,3nr > simd_size.x32.csv
+
+cost: size
+	objdump -d -t -C --no-show-raw-insn simd_size.x32.o | \
+        awk -f simd_cost.awk > simd_cost.x32.s
+	llvm-mca -mtriple=x86_64 -mcpu=${MCA_CPU} simd_cost.x32.s | \
+        awk -v mode=csv -f simd_cost.awk | sort -t, -k6,6nr > simd_cost.x32.csv
+
+vreg:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	g++ -O3 -g -mx32 \
+        -DRT_LINUX -DRT_X32 -DRT_256_R8=4 -DRT_DEBUG=0 -DRT_VREG_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_vreg.x32
+
+spmd:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	awk -f simd_spmd.awk simd_test.spmd | awk -f simd_vreg.awk > simd_spmd.h
+	g++ -O3 -g -mx32 \
+        -DRT_LINUX -DRT_X32 -DRT_256_R8=4 -DRT_DEBUG=0 -DRT_SPMD_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_spmd.x32
+
 
 simd_test_x32:
 	g++ -O3 -g -mx32 \
@@ -57,7 +91,8 @@ simd_test_x32:
 # For 256-bit SSE4 build use (replace): RT_256_R8=4          (8 SIMD reg-pairs)
 # For 256-bit AVX1 build use (replace): RT_256=1            (15 SIMD registers)
 # For 256-bit AVX2 build use (replace): RT_256=2            (15 SIMD registers)
-# For 256-bit 30-reg build use (replace): RT_256=4   (reserved for AVX1+2/SSEx)
+# For 256-bit 30-reg build use (replace): RT_256=4   (AVX2, 18 regs emulated)
+# For 256-bit 30-reg build use (replace): RT_256=4 RT_SIMD_COMPAT_256=1 (AVX1)
 # For 256-bit 30-reg build use (replace): RT_256=8   (Skylake-X w/ AVX512DQ+VL)
 
 # For 512-bit AVX1 build use (replace): RT_512_R8=1          (8 SIMD reg-pairs)
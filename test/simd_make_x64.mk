@@ -8,7 +8,12 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
+
+SIZE_LIST =
+
+MCA_CPU = skylake
 
 
 build: build_x64 build_x64avx build_x64avx512
@@ -19,6 +24,35 @@ strip:
 clean:
 	rm simd_test.x64*
 
+size:
+	g++ -O3 -c \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 -DRT_SIZE_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${SIZE_LIST} ${INC_PATH} ${SRC_LIST} -o simd_size.x64.o
+	objdump -d -t -C simd_size.x64.o | \
+        awk -f simd_size.awk | sort -t, -k3,3nr > simd_size.x64.csv
+
+cost: size
+	objdump -d -t -C --no-show-raw-insn simd_size.x64.o | \
+        awk -f simd_cost.awk > simd_cost.x64.s
+	llvm-mca -mtriple=x86_64 -mcpu=${MCA_CPU} simd_cost.x64.s | \
+        awk -v mode=csv -f simd_cost.awk | sort -t, -k6,6nr > simd_cost.x64.csv
+
+vreg:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 -DRT_VREG_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_vreg.x64_32
+
+spmd:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	awk -f simd_spmd.awk simd_test.spmd | awk -f simd_vreg.awk > simd_spmd.h
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 -DRT_SPMD_TEST \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_spmd.x64_32
+
 macOS:
 	mv simd_test.x64_32 simd_test.o64_32
 	mv simd_test.x64_64 simd_test.o64_64
@@ -164,7 +198,8 @@ simd_test_x64f64avx512:
 # For 256-bit SSE4 build use (replace): RT_256_R8=4          (8 SIMD reg-pairs)
 # For 256-bit AVX1 build use (replace): RT_256=1            (15 SIMD registers)
 # For 256-bit AVX2 build use (replace): RT_256=2            (15 SIMD registers)
-# For 256-bit 30-reg build use (replace): RT_256=4   (reserved for AVX1+2/SSEx)
+# For 256-bit 30-reg build use (replace): RT_256=4   (AVX2, 18 regs emulated)
+# For 256-bit 30-reg build use (replace): RT_256=4 RT_SIMD_COMPAT_256=1 (AVX1)
 # For 256-bit 30-reg build use (replace): RT_256=8   (Skylake-X w/ AVX512DQ+VL)
 
 # For 512-bit AVX1 build use (replace): RT_512_R8=1          (8 SIMD reg-pairs)
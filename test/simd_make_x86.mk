@@ -8,7 +8,12 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
+
+SIZE_LIST =
+
+MCA_CPU = skylake
 
 
 build: simd_test_x86 simd_test_x86avx simd_test_x86avx512
@@ -19,6 +24,35 @@ strip:
 clean:
 	rm simd_test.x86*
 
+size:
+	g++ -O3 -c -m32 \
+        -DRT_LINUX -DRT_X86 -DRT_128=2 -DRT_DEBUG=0 -DRT_SIZE_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${SIZE_LIST} ${INC_PATH} ${SRC_LIST} -o simd_size.x86.o
+	objdump -d -t -C simd_size.x86.o | \
+        awk -f simd_size.awk | sort -t, -k3,3nr > simd_size.x86.csv
+
+cost: size
+	objdump -d -t -C --no-show-raw-insn simd_size.x86.o | \
+        awk -f simd_cost.awk > simd_cost.x86.s
+	llvm-mca -mtriple=i686 -mcpu=${MCA_CPU} simd_cost.x86.s | \
+        awk -v mode=csv -f simd_cost.awk | sort -t, -k6,6nr > simd_cost.x86.csv
+
+vreg:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	g++ -O3 -g -m32 \
+        -DRT_LINUX -DRT_X86 -DRT_128=2 -DRT_DEBUG=0 -DRT_VREG_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_vreg.x86
+
+spmd:
+	awk -f simd_vreg.awk ${SRC_LIST} > simd_vreg.cpp
+	awk -f simd_spmd.awk simd_test.spmd | awk -f simd_vreg.awk > simd_spmd.h
+	g++ -O3 -g -m32 \
+        -DRT_LINUX -DRT_X86 -DRT_128=2 -DRT_DEBUG=0 -DRT_SPMD_TEST \
+        -DRT_POINTER=32 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} simd_vreg.cpp ${LIB_PATH} ${LIB_LIST} -o simd_spmd.x86
+
 macOS:
 	mv simd_test.x86 simd_test.o86
 	mv simd_test.x86avx simd_test.o86avx
@@ -0,0 +1,65 @@
+#
+# Code-size report from "objdump -d -t -C" output of an RT_SIZE_TEST build,
+# prints CSV rows (kind,name,bytes,insns) per instruction macro (sz_ labels)
+# and per kernel (s_test, l_, t_ and z_test functions, clones merged).
+#
+
+# symbol table entries, macros which emit no code share their address
+# with the next label, disassembly shows only one label per address,
+# the last one defined at that address owns the code which follows
+/^[0-9a-f]+ .*[ \t]sz_[a-z0-9_]+$/ {
+    if ($NF != "sz_end")
+    {
+        mlist[substr($NF, 4)] = 1
+    }
+    owner[$1] = $NF
+    next
+}
+
+/^[0-9a-f]+ <.*>:$/ {
+    name = $0
+    sub(/^[0-9a-f]+ </, "", name)
+    sub(/>:$/, "", name)
+
+    if (index(name, "(") > 0)
+    {
+        sub(/\(.*/, "", name)
+        knm = name ~ /^(s_test[0-9]+|[lt]_[a-z0-9]+|z_test)$/ ? name : ""
+        mnm = ""
+    }
+    else
+    if (name ~ /^sz_/)
+    {
+        name = owner[$1] != "" ? owner[$1] : name
+        mnm = name != "sz_end" ? substr(name, 4) : ""
+    }
+    next
+}
+
+/^ *[0-9a-f]+:\t/ {
+    n = split($0, f, "\t")
+    hex = f[2]
+    gsub(/ /, "", hex)
+    b = length(hex) / 2
+    i = n >= 3 && f[3] != "" ? 1 : 0
+
+    if (knm != "")
+    {
+        kb[knm] += b; ki[knm] += i
+    }
+    if (mnm != "")
+    {
+        mb[mnm] += b; mi[mnm] += i
+    }
+}
+
+END {
+    for (m in mlist)
+    {
+        printf "macro,%s,%d,%d\n", m, mb[m] + 0, mi[m] + 0
+    }
+    for (k in kb)
+    {
+        printf "kernel,%s,%d,%d\n", k, kb[k], ki[k]
+    }
+}
@@ -0,0 +1,855 @@
+#
+# SPMD kernel compiler (ISPC-like subset) producing UniSIMD macro source,
+# kernels written in a small C-like language with uniform and varying values
+# are compiled into ASM sections with virtual SIMD registers (Vmm*),
+# which are then allocated by simd_vreg.awk for a given RT_REGS.
+# Varying values fill SIMD-width chunks of a foreach range (cmdp*_** ops),
+# if/else and while use SPMD control-flow macros (rtbase.h) on an execution
+# mask, both sides of if/else run under a partial mask with results merged
+# (SPMD_MOVE, SPMD_STORE), a side (or loop) whose mask is NONE is skipped.
+# Remaining tail elements are computed by the scalar C version generated
+# from the same source. For each kernel NAME the output contains:
+#   rt_SIMD_SPMD_NAME - struct derived from rt_SIMD_INFO with uniforms,
+#                       literal constants, loop counter and array pointers
+#   c_spmd_NAME       - scalar C version for elements j0 <= j < n
+#   s_spmd_NAME       - ASM section for info->cnt SIMD-width chunks
+#   spmd_NAME         - wrapper which fills the struct and runs both
+#
+# spmd NAME(uniform int n, float a[], float b[], uniform float k)
+# {
+#     foreach (j = 0 ... n)
+#     {
+#         float x = a[j] * k;               varying declaration
+#         x = sqrt(abs(x)) + min(x, 1.0);   also max, unary -, + - * /
+#         if (x > 2.0 && !(x >= 3.0))       also < <= == != ||
+#         {
+#             b[j] = x;                     array store (foreach index only)
+#         }
+#         else { ... }                      else, else if, nesting
+#         while (x > 1.0) { x = x * 0.5; } loop until all lanes fail
+#     }
+# }
+#
+# Up to 4 arrays (in Rebx, Recx, Redx, Resi) and 16 uniforms and literals
+# per kernel, Redi is left for simd_vreg.awk spills, Reax for mkjpx_rx.
+#
+# usage: awk -f simd_spmd.awk kernel.spmd | awk -f simd_vreg.awk > kernel.h
+#
+
+BEGIN {
+    split("Rebx Recx Redx Resi", preg)
+    split("Mebx Mecx Medx Mesi", pmem)
+    cmp["<"] = "clt"; cmp[">"] = "cgt"; cmp["<="] = "cle"
+    cmp[">="] = "cge"; cmp["=="] = "ceq"; cmp["!="] = "cne"
+    rev["<"] = ">"; rev[">"] = "<"; rev["<="] = ">="
+    rev[">="] = "<="; rev["=="] = "=="; rev["!="] = "!="
+    src = ""
+    stars = "****************************************" \
+            "****************************************"
+}
+
+{
+    sub(/\r$/, "")
+    src = src $0 "\n"
+}
+
+END {
+    lex(src)
+    print "/* generated by simd_spmd.awk, do not edit */"
+    while (pos <= nt)
+    {
+        kernel()
+    }
+}
+
+function fail(msg)
+{
+    printf "simd_spmd.awk: line %d: %s\n", tln[(pos > nt ? nt : pos)],
+            msg > "/dev/stderr"
+    exit 1
+}
+
+# split source into tokens, comments are dropped
+function lex(s,  n, m, ln)
+{
+    nt = 0; ln = 1
+    while (s != "")
+    {
+        if (match(s, /^[ \t\n]+/))
+        {
+            m = substr(s, 1, RLENGTH)
+            ln += gsub(/\n/, "", m)
+            s = substr(s, RLENGTH + 1)
+            continue
+        }
+        if (substr(s, 1, 2) == "/*")
+        {
+            n = index(substr(s, 3), "*/")
+            if (n == 0)
+            {
+                pos = nt + 1; tln[pos] = ln
+                fail("unterminated comment")
+            }
+            m = substr(s, 1, n + 3)
+            ln += gsub(/\n/, "", m)
+            s = substr(s, n + 4)
+            continue
+        }
+        if (substr(s, 1, 2) == "//")
+        {
+            s = substr(s, index(s, "\n"))
+            continue
+        }
+        if (!match(s, /^[A-Za-z_][A-Za-z_0-9]*/) &&
+            !match(s, /^([0-9]+(\.[0-9]+)?|\.[0-9]+)([eE][-+]?[0-9]+)?/) &&
+            !match(s, /^(\.\.\.|<=|>=|==|!=|&&|\|\|)/))
+        {
+            match(s, /^./)
+        }
+        tok[++nt] = substr(s, 1, RLENGTH); tln[nt] = ln
+        s = substr(s, RLENGTH + 1)
+    }
+    pos = 1
+}
+
+function peek()
+{
+    return pos <= nt ? tok[pos] : ""
+}
+
+function next_()
+{
+    return tok[pos++]
+}
+
+function expect(t)
+{
+    if (peek() != t)
+    {
+        fail("expected '" t "' instead of '" peek() "'")
+    }
+    pos++
+}
+
+function ident(  t)
+{
+    t = peek()
+    if (t !~ /^[A-Za-z_][A-Za-z_0-9]*$/)
+    {
+        fail("expected identifier instead of '" t "'")
+    }
+    pos++
+    return t
+}
+
+function number(t)
+{
+    return t ~ /^([0-9]+(\.[0-9]+)?|\.[0-9]+)([eE][-+]?[0-9]+)?$/
+}
+
+# kernel state is reset per kernel
+function kernel(  t, u)
+{
+    expect("spmd")
+    name = ident()
+    split("", kind); split("", preg_); split("", vreg); split("", vlev)
+    split("", kreg); split("", klit); split("", kfld)
+    split("", scope)
+    np = 0; na = 0; nk = 0; nlt = 0; nvm = 0; nlb = 0; nsc = 0
+    nasm = 0; ncc = 0; depth = 0; cm = ""; xm = ""; cind = "    "
+
+    expect("(")
+    while (peek() != ")")
+    {
+        par[++np] = ""
+        if (peek() == "uniform")
+        {
+            next_()
+            t = next_()
+            u = ident()
+            if (t != "int" && t != "float")
+            {
+                fail("unknown type '" t "'")
+            }
+            kind[u] = t == "int" ? "count" : "uniform"
+            ptyp[np] = t == "int" ? "rt_si32 " : "rt_real "
+        }
+        else
+        {
+            expect("float")
+            u = ident()
+            expect("["); expect("]")
+            if (++na > 4)
+            {
+                fail("too many arrays (4 max)")
+            }
+            kind[u] = "array"; preg_[u] = na; arr[na] = u
+            ptyp[np] = "rt_real *"
+        }
+        if (u ~ /^lit[0-9][0-9]$/ || u == "cnt" || u == "info")
+        {
+            fail("reserved name '" u "'")
+        }
+        par[np] = u
+        if (peek() != ")")
+        {
+            expect(",")
+        }
+    }
+    expect(")")
+    expect("{")
+    expect("foreach")
+    expect("(")
+    jv = ident()
+    expect("=")
+    expect("0")
+    expect("...")
+    cnt = ident()
+    if (kind[cnt] != "count")
+    {
+        fail("foreach bound must be uniform int")
+    }
+    expect(")")
+    block()
+    expect("}")
+
+    emit_struct()
+    emit_c()
+    emit_s()
+    emit_w()
+}
+
+function aem(s)
+{
+    asm[++nasm] = "        " s
+}
+
+function cem(s)
+{
+    cc[++ncc] = cind s
+}
+
+function newv()
+{
+    return "Vmm" nvm++
+}
+
+# statements block, variables declared inside go out of scope at its end
+function block(  mk, k)
+{
+    expect("{")
+    mk = nsc
+    cem("{")
+    cind = cind "    "
+    while (peek() != "}")
+    {
+        if (peek() == "")
+        {
+            fail("unexpected end of file")
+        }
+        stmt()
+    }
+    expect("}")
+    cind = substr(cind, 5)
+    cem("}")
+    for (k = nsc; k > mk; k--)
+    {
+        delete vreg[scope[k]]; delete vlev[scope[k]]; delete kind[scope[k]]
+    }
+    nsc = mk
+}
+
+function stmt(  t, v, r, c, p, m, x)
+{
+    t = peek()
+    if (nasm > 0)
+    {
+        asm[++nasm] = ""
+    }
+    if (t == "if")
+    {
+        ifstmt()
+        return
+    }
+    if (t == "while")
+    {
+        whilestmt()
+        return
+    }
+    if (t == "float")
+    {
+        next_()
+        v = ident()
+        if (v in kind)
+        {
+            fail("'" v "' is already declared")
+        }
+        expect("=")
+        r = expr(); c = xc
+        expect(";")
+        if (!xt)
+        {
+            x = newv()
+            aem("movpx_rr(" x ", " r ")")
+            r = x
+        }
+        kind[v] = "varying"; vreg[v] = r; vlev[v] = depth
+        scope[++nsc] = v
+        cem("rt_real " v " = " c ";")
+        return
+    }
+    v = ident()
+    if (kind[v] == "array")
+    {
+        expect("[")
+        if (next_() != jv)
+        {
+            fail("arrays can only be indexed by '" jv "'")
+        }
+        expect("]")
+        expect("=")
+        r = expr(); c = xc
+        expect(";")
+        m = pmem[preg_[v]]
+        if (cm == "")
+        {
+            aem("movpx_st(" r ", " m ", DP(0x000))")
+        }
+        else
+        {
+            aem("SPMD_STORE(" r ", " cm ", " newv() ", " m ", DP(0x000))")
+        }
+        cem(v "[" jv "] = " c ";")
+        return
+    }
+    if (kind[v] != "varying")
+    {
+        fail("'" v "' is not a varying variable")
+    }
+    expect("=")
+    r = expr(); c = xc
+    expect(";")
+    if (vlev[v] == depth)
+    {
+        vreg[v] = own(r, xt)
+    }
+    else
+    if (r != vreg[v])
+    {
+        aem("SPMD_MOVE(" vreg[v] ", " own(r, xt) ", " cm ")")
+    }
+    cem(v " = " c ";")
+}
+
+# if/else under execution mask (xm), parent mask is kept in xp
+function ifstmt(  c, mt, xp, le, lx, sv)
+{
+    expect("if")
+    expect("(")
+    mt = cond(); c = xc
+    expect(")")
+    xp = newv()
+    if (has_else())
+    {
+        le = "spm_" name "_" ++nlb
+    }
+    lx = "spm_" name "_" ++nlb
+    aem("SPMD_IF(" mask() ", " mt ", " xp ", " (le != "" ? le : lx) ")")
+    cem("if (" c ")")
+    depth++; sv = cm; cm = xm
+    block()
+    if (le != "")
+    {
+        next_()
+        label(le)
+        aem("SPMD_ELSE(" xm ", " xp ", " lx ")")
+        cem("else")
+        if (peek() == "if")
+        {
+            cem("{")
+            cind = cind "    "
+            ifstmt()
+            cind = substr(cind, 5)
+            cem("}")
+        }
+        else
+        {
+            block()
+        }
+    }
+    depth--; cm = sv
+    label(lx)
+    aem("SPMD_ENDIF(" xm ", " xp ")")
+}
+
+# loop runs until all lanes of execution mask (xm) have left
+function whilestmt(  c, mc, xp, lh, lx, sv)
+{
+    expect("while")
+    xp = newv()
+    lh = "spm_" name "_" ++nlb
+    lx = "spm_" name "_" ++nlb
+    aem("SPMD_DO(" mask() ", " xp ")")
+    label(lh)
+    expect("(")
+    mc = cond(); c = xc
+    expect(")")
+    aem("SPMD_WHILE(" xm ", " mc ", " lx ")")
+    cem("while (" c ")")
+    depth++; sv = cm; cm = xm
+    block()
+    depth--; cm = sv
+    asm[++nasm] = ""
+    aem("jmpxx_lb(" lh ")")
+    label(lx)
+    aem("SPMD_ENDDO(" xm ", " xp ")")
+}
+
+# execution mask register, all-ones outside of if/while
+function mask()
+{
+    if (xm == "")
+    {
+        xm = newv()
+    }
+    return xm
+}
+
+function label(lb)
+{
+    asm[++nasm] = ""
+    asm[++nasm] = "    LBL(" lb ")"
+    asm[++nasm] = ""
+}
+
+# looks past the then-block for else
+function has_else(  p, d)
+{
+    d = 0
+    for (p = pos; p <= nt; p++)
+    {
+        d += (tok[p] == "{") - (tok[p] == "}")
+        if (d == 0)
+        {
+            return tok[p + 1] == "else"
+        }
+    }
+    return 0
+}
+
+# returns a register which can be overwritten (copy of a named one)
+function own(r, t,  x)
+{
+    if (t)
+    {
+        return r
+    }
+    x = newv()
+    aem("movpx_rr(" x ", " r ")")
+    return x
+}
+
+# 2-operand op, commutative ones take a temporary from either side
+function binop(op, a, ta, b, tb, comm,  r)
+{
+    if (!ta && tb && comm)
+    {
+        r = a; a = b; b = r
+        ta = 1
+    }
+    r = own(a, ta)
+    aem(op "_rr(" r ", " b ")")
+    return r
+}
+
+# expressions return a register and set xc (C text) and xt (temporary)
+function expr(  r, c, op, r2, t)
+{
+    r = term(); c = xc; t = xt
+    while ((op = peek()) == "+" || op == "-")
+    {
+        next_()
+        r2 = term()
+        r = binop(op == "+" ? "addps" : "subps", r, t, r2, xt, op == "+")
+        c = c " " op " " xc; t = 1
+    }
+    xc = c; xt = t
+    return r
+}
+
+function term(  r, c, op, r2, t)
+{
+    r = unary(); c = xc; t = xt
+    while ((op = peek()) == "*" || op == "/")
+    {
+        next_()
+        r2 = unary()
+        r = binop(op == "*" ? "mulps" : "divps", r, t, r2, xt, op == "*")
+        c = c " " op " " xc; t = 1
+    }
+    xc = c; xt = t
+    return r
+}
+
+function unary(  r, x)
+{
+    if (peek() != "-")
+    {
+        return prim()
+    }
+    next_()
+    if (number(peek()))
+    {
+        return literal("-" next_())
+    }
+    r = unary()
+    x = newv()
+    aem("negps_rr(" x ", " r ")")
+    xc = "-" xc; xt = 1
+    return x
+}
+
+function prim(  t, r, c, r2, x, rt)
+{
+    t = next_()
+    if (number(t))
+    {
+        return literal(t)
+    }
+    if (t == "(")
+    {
+        r = expr()
+        expect(")")
+        xc = "(" xc ")"
+        return r
+    }
+    if (t == "sqrt" || t == "abs" || t == "min" || t == "max")
+    {
+        expect("(")
+        r = expr(); c = xc; rt = xt
+        if (t == "sqrt")
+        {
+            x = newv()
+            aem("sqrps_rr(" x ", " r ")")
+            xc = "RT_SQRT(" c ")"
+        }
+        if (t == "abs")
+        {
+            x = own(r, rt)
+            aem("andpx_ld(" x ", Mebp, inf_GPC04)")
+            xc = "RT_FABS(" c ")"
+        }
+        if (t == "min" || t == "max")
+        {
+            expect(",")
+            r2 = expr()
+            x = binop(t "ps", r, rt, r2, xt, 1)
+            xc = "RT_" toupper(t) "(" c ", " xc ")"
+        }
+        expect(")")
+        xt = 1
+        return x
+    }
+    if (kind[t] == "array")
+    {
+        expect("[")
+        if (next_() != jv)
+        {
+            fail("arrays can only be indexed by '" jv "'")
+        }
+        expect("]")
+        x = newv()
+        aem("movpx_ld(" x ", " pmem[preg_[t]] ", DP(0x000))")
+        xc = t "[" jv "]"; xt = 1
+        return x
+    }
+    if (kind[t] == "varying")
+    {
+        xc = t; xt = 0
+        return vreg[t]
+    }
+    if (kind[t] == "uniform")
+    {
+        r = konst(t, t)
+        xc = t; xt = 0
+        return r
+    }
+    pos--
+    fail("unexpected '" t "' in expression")
+}
+
+# uniforms and literals are loaded once before the loop
+function konst(key, fld)
+{
+    if (!(key in kreg))
+    {
+        if (nk >= 16)
+        {
+            fail("too many uniforms and literals (16 max)")
+        }
+        kreg[key] = newv()
+        kfld[nk++] = fld
+        kkey[nk - 1] = key
+    }
+    return kreg[key]
+}
+
+function literal(t,  f, r)
+{
+    f = t ~ /[.eE]/ ? t "f" : t ".0f"
+    if (!(f in klit))
+    {
+        klit[f] = sprintf("lit%02d", nlt++)
+    }
+    r = konst(f, klit[f])
+    xc = f; xt = 0
+    return r
+}
+
+# conditions return a mask register (always temporary) and set xc
+function cond(  r, c)
+{
+    r = cand(); c = xc
+    while (peek() == "||")
+    {
+        next_()
+        aem("orrpx_rr(" r ", " cand() ")")
+        c = c " || " xc
+    }
+    xc = c
+    return r
+}
+
+function cand(  r, c)
+{
+    r = cnot(); c = xc
+    while (peek() == "&&")
+    {
+        next_()
+        aem("andpx_rr(" r ", " cnot() ")")
+        c = c " && " xc
+    }
+    xc = c
+    return r
+}
+
+function cnot(  r)
+{
+    if (peek() == "!")
+    {
+        next_()
+        r = cnot()
+        aem("annpx_ld(" r ", Mebp, inf_GPC07)")
+        xc = xc ~ /^!?\(/ && xg ? "!" xc : "!(" xc ")"; xg = 1
+        return r
+    }
+    if (peek() == "(" && group())
+    {
+        next_()
+        r = cond()
+        expect(")")
+        xc = "(" xc ")"; xg = 1
+        return r
+    }
+    return relation()
+}
+
+# parenthesized condition (not expression) starts at pos
+function group(  p, d)
+{
+    d = 0
+    for (p = pos; p <= nt; p++)
+    {
+        d += (tok[p] == "(") - (tok[p] == ")")
+        if (d == 0)
+        {
+            return 0
+        }
+        if (tok[p] in cmp || tok[p] ~ /^(&&|\|\||!)$/)
+        {
+            return 1
+        }
+    }
+    return 0
+}
+
+function relation(  r, c, t, op, r2)
+{
+    r = expr(); c = xc; t = xt
+    op = next_()
+    if (!(op in cmp))
+    {
+        pos--
+        fail("expected comparison instead of '" op "'")
+    }
+    r2 = expr()
+    if (!t && xt)
+    {
+        aem(cmp[rev[op]] "ps_rr(" r2 ", " r ")")
+        r = r2
+    }
+    else
+    {
+        r = own(r, t)
+        aem(cmp[op] "ps_rr(" r ", " r2 ")")
+    }
+    xc = c " " op " " xc; xt = 1; xg = 0
+    return r
+}
+
+function banner(s,  n, l)
+{
+    s = "   " s "   "
+    n = 76 - length(s)
+    l = substr(stars, 1, int(n / 2))
+    print ""
+    print "/" substr(stars, 1, 78) "/"
+    print "/*" l s substr(stars, 1, n - length(l)) "*/"
+    print "/" substr(stars, 1, 78) "/"
+    print ""
+}
+
+# parameter list wrapped at 80 columns and aligned to its opening bracket
+function plist(head, first,  k, s, ln, p, ind)
+{
+    ind = sprintf("%" length(head) + 1 "s", "")
+    s = head "("; ln = first
+    for (k = 1; k <= np; k++)
+    {
+        p = ptyp[k] par[k]
+        if (length(s ln ", " p ")") > 79)
+        {
+            print s ln ","
+            s = ind; ln = p
+        }
+        else
+        {
+            ln = ln ", " p
+        }
+    }
+    print s ln ")"
+}
+
+function emit_struct(  k, u, off)
+{
+    banner("SPMD KERNEL " name)
+    print "struct rt_SIMD_SPMD_" name " : public rt_SIMD_INFO"
+    print "{"
+    print "    /* uniforms and literals */"
+    for (k = 0; k < nk; k++)
+    {
+        print ""
+        print "    rt_real " kfld[k] "[S];"
+        printf "#define %-19s DP(Q*0x%03X)\n",
+                "spm_" name "_" toupper(kfld[k]), 256 + 16 * k
+    }
+    off = sprintf("Q*0x%03X", 256 + 16 * nk)
+    print ""
+    print "    /* loop counter */"
+    print ""
+    print "    rt_si32 cnt;"
+    printf "#define %-19s DP(%s+0x000)\n", "spm_" name "_CNT", off
+    print ""
+    print "    rt_si32 pad[3];"
+    print ""
+    print "    /* varying arrays */"
+    for (k = 1; k <= na; k++)
+    {
+        print ""
+        print "    rt_real*" arr[k] ";"
+        printf "#define %-19s DP(%s+0x010+0x%03X*P+E)\n",
+                "spm_" name "_" toupper(arr[k]), off, 4 * (k - 1)
+    }
+    print "};"
+}
+
+function emit_c(  k)
+{
+    print ""
+    plist("rt_void c_spmd_" name, "rt_si32 j0")
+    print "{"
+    print "    rt_si32 " jv ";"
+    print ""
+    print "    for (" jv " = j0; " jv " < " cnt "; " jv "++)"
+    for (k = 1; k <= ncc; k++)
+    {
+        print cc[k]
+    }
+    print "}"
+}
+
+function emit_s(  k, u)
+{
+    print ""
+    print "rt_void s_spmd_" name "(rt_SIMD_SPMD_" name " *info)"
+    print "{"
+    print "    ASM_ENTER(info)"
+    print ""
+    for (k = 1; k <= na; k++)
+    {
+        print "        movxx_ld(" preg[k] ", Mebp, spm_" name "_" toupper(arr[k]) ")"
+    }
+    print ""
+    for (k = 0; k < nk; k++)
+    {
+        print "        movpx_ld(" kreg[kkey[k]] ", Mebp, spm_" name "_" \
+                                                    toupper(kfld[k]) ")"
+    }
+    if (xm != "")
+    {
+        print "        movpx_ld(" xm ", Mebp, inf_GPC07)"
+    }
+    print ""
+    print "    LBL(spm_" name "_loop)"
+    print ""
+    for (k = 1; k <= nasm; k++)
+    {
+        print asm[k]
+    }
+    print ""
+    for (k = 1; k <= na; k++)
+    {
+        print "        addxx_ri(" preg[k] ", IM(Q*16))"
+    }
+    print ""
+    print "        arjwx_mi(Mebp, spm_" name "_CNT, IB(1),"
+    print "        sub_x,   NZ_x, spm_" name "_loop)"
+    print ""
+    print "    ASM_LEAVE(info)"
+    print "}"
+}
+
+function emit_w(  k, s)
+{
+    print ""
+    plist("rt_void spmd_" name, "rt_SIMD_SPMD_" name " *info")
+    print "{"
+    print "    rt_si32 i, j0 = " cnt " - " cnt " % S;"
+    print ""
+    print "    for (i = 0; i < S; i++)"
+    print "    {"
+    for (k = 0; k < nk; k++)
+    {
+        print "        info->" kfld[k] "[i] = " kkey[k] ";"
+    }
+    print "    }"
+    print ""
+    for (k = 1; k <= na; k++)
+    {
+        print "    info->" arr[k] " = " arr[k] ";"
+    }
+    print "    info->cnt = j0 / S;"
+    print ""
+    print "    if (info->cnt > 0)"
+    print "    {"
+    print "        s_spmd_" name "(info);"
+    print "    }"
+    print ""
+    s = ""
+    for (k = 1; k <= np; k++)
+    {
+        s = s ", " par[k]
+    }
+    print "    c_spmd_" name "(j0" s ");"
+    print "}"
+}
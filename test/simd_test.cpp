@@ -24,15 +24,29 @@
 #define RT_DATA 8
 
 #include "rtbase.h"
+#include "rtpool.h"
+
+#if (defined RT_SPMD_TEST)
+#include "simd_spmd.h" /* generated by "spmd" target via simd_spmd.awk */
+#endif /* RT_SPMD_TEST */
 
 /******************************************************************************/
 /*******************************   DEFINITIONS   ******************************/
 /******************************************************************************/
 
-#define RUN_LEVEL           37
+#if   (defined RT_SPMD_TEST)
+#define RUN_LEVEL           52 /* built by "spmd" target via simd_spmd.awk */
+#elif (defined RT_VREG_TEST)
+#define RUN_LEVEL           49 /* built by "vreg" target via simd_vreg.awk */
+#else  /* RT_VREG_TEST */
+#define RUN_LEVEL           48
+#endif /* RT_VREG_TEST */
 #define CYC_SIZE            1000000
+#define RT_PERF_MAX         8 /* max number of perf-event counters (-p) */
 
 #define ARR_SIZE            S*3 /* hardcoded in ASM sections, S = SIMD elems */
+#define GM_M                3   /* int8 GEMM rows (one SIMD register each) */
+#define GM_K                16  /* int8 GEMM depth in byte-quads (K = 64) */
 #define MASK                (RT_SIMD_ALIGN - 1) /* SIMD alignment mask */
 
 /* NOTE: floating point values are not tested for equality precisely due to
@@ -61,12 +75,24 @@ rt_si32     n_done      = RUN_LEVEL-1;  /* subtest-done (from command-line) */
 rt_si32     t_diff      = 2;          /* diff-threshold (from command-line) */
 rt_si32     r_test      = CYC_SIZE;   /* test-redundant (from command-line) */
 rt_bool     v_mode      = RT_FALSE;     /* verbose mode (from command-line) */
+rt_si32     b_test      = 0;          /* bench-repeats (from command-line) */
+rt_si32     f_core      = 0;       /* core clock, MHz (from command-line) */
+rt_char    *o_file      = RT_NULL;     /* bench-output (from command-line) */
+rt_si32     w_size      = 0;          /* sweep-max, KB (from command-line) */
+rt_si32     m_thrd      = 0;        /* scale-threads (from command-line) */
+rt_char    *p_list      = RT_NULL;      /* perf-events (from command-line) */
+rt_si32     u_iter      = 0;       /* micro-iterations (from command-line) */
 
 /*
  * Get system time in milliseconds.
  */
 rt_time get_time();
 
+/*
+ * Get system time in microseconds.
+ */
+rt_time get_usec();
+
 /*
  * Allocate memory from system heap.
  */
@@ -77,6 +103,90 @@ rt_pntr sys_alloc(rt_size size);
  */
 rt_void sys_free(rt_pntr ptr, rt_size size);
 
+/*
+ * Get number of online cores in the system.
+ */
+rt_si32 sys_cores();
+
+/*
+ * Run (func) with (arg) on a new thread pinned to (core) where supported.
+ * Returns thread handle to be passed to thread_join.
+ */
+rt_pntr thread_init(rt_si32 core, rt_void (*func)(rt_pntr), rt_pntr arg);
+
+/*
+ * Wait for thread (handle) to finish and release its resources.
+ */
+rt_void thread_join(rt_pntr handle);
+
+/*
+ * Open hardware performance counters for comma-separated events in (list).
+ * Returns number of counters opened (0 if not supported on this system).
+ */
+rt_si32 perf_init(rt_char *list);
+
+/*
+ * Get name of performance counter (k) as given in the event list.
+ */
+const rt_char *perf_name(rt_si32 k);
+
+/*
+ * Reset and start all opened performance counters.
+ */
+rt_void perf_start();
+
+/*
+ * Stop all opened performance counters and read their values into (val).
+ */
+rt_void perf_stop(rt_ui64 *val);
+
+/*
+ * Close all opened performance counters.
+ */
+rt_void perf_done();
+
+#if (defined RT_SPMD_TEST)
+
+/*
+ * SIMD info structure for hand-written shading kernel (subtest 52),
+ * holds its constants and array pointers as generated SPMD structs do.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ */
+struct rt_SIMD_SHADE : public rt_SIMD_INFO
+{
+    /* uniforms and constants */
+
+    rt_real k[S];           /* threshold */
+#define shd_K               DP(Q*0x100)
+
+    rt_real c01[S];         /* 0.001 */
+#define shd_C01             DP(Q*0x110)
+
+    rt_real c10[S];         /* 10.0 */
+#define shd_C10             DP(Q*0x120)
+
+    /* loop counter */
+
+    rt_si32 cnt;
+#define shd_CNT             DP(Q*0x130+0x000)
+
+    rt_si32 pad[3];
+
+    /* varying arrays */
+
+    rt_real*far0;
+#define shd_FAR0            DP(Q*0x130+0x010+0x000*P+E)
+
+    rt_real*fso1;
+#define shd_FSO1            DP(Q*0x130+0x010+0x004*P+E)
+
+    rt_real*fso2;
+#define shd_FSO2            DP(Q*0x130+0x010+0x008*P+E)
+
+};
+
+#endif /* RT_SPMD_TEST */
+
 /*
  * Extended SIMD info structure for ASM_ENTER/ASM_LEAVE
  * serves as a container for test arrays and internal variables.
@@ -99,65 +209,178 @@ struct rt_SIMD_INFOX : public rt_SIMD_INFO
     rt_si32 simd;
 #define inf_SIMD            DP(Q*0x100+0x00C)
 
+    rt_si32 tile;
+#define inf_TILE            DP(Q*0x100+0x010)
+
+    rt_si32 tloc;
+#define inf_TLOC            DP(Q*0x100+0x014)
+
     rt_pntr label;
-#define inf_LABEL           DP(Q*0x100+0x010+0x000*P)
+#define inf_LABEL           DP(Q*0x100+0x018+0x000*P)
 
     rt_pntr tail;
-#define inf_TAIL            DP(Q*0x100+0x010+0x004*P)
+#define inf_TAIL            DP(Q*0x100+0x018+0x004*P)
 
     /* floating point arrays */
 
     rt_real*far0;
-#define inf_FAR0            DP(Q*0x100+0x010+0x008*P+E)
+#define inf_FAR0            DP(Q*0x100+0x018+0x008*P+E)
 
     rt_real*fco1;
-#define inf_FCO1            DP(Q*0x100+0x010+0x00C*P+E)
+#define inf_FCO1            DP(Q*0x100+0x018+0x00C*P+E)
 
     rt_real*fco2;
-#define inf_FCO2            DP(Q*0x100+0x010+0x010*P+E)
+#define inf_FCO2            DP(Q*0x100+0x018+0x010*P+E)
 
     rt_real*fso1;
-#define inf_FSO1            DP(Q*0x100+0x010+0x014*P+E)
+#define inf_FSO1            DP(Q*0x100+0x018+0x014*P+E)
 
     rt_real*fso2;
-#define inf_FSO2            DP(Q*0x100+0x010+0x018*P+E)
+#define inf_FSO2            DP(Q*0x100+0x018+0x018*P+E)
 
     /* integer arrays */
 
     rt_elem*iar0;
-#define inf_IAR0            DP(Q*0x100+0x010+0x01C*P+E)
+#define inf_IAR0            DP(Q*0x100+0x018+0x01C*P+E)
 
     rt_elem*ico1;
-#define inf_ICO1            DP(Q*0x100+0x010+0x020*P+E)
+#define inf_ICO1            DP(Q*0x100+0x018+0x020*P+E)
 
     rt_elem*ico2;
-#define inf_ICO2            DP(Q*0x100+0x010+0x024*P+E)
+#define inf_ICO2            DP(Q*0x100+0x018+0x024*P+E)
 
     rt_elem*iso1;
-#define inf_ISO1            DP(Q*0x100+0x010+0x028*P+E)
+#define inf_ISO1            DP(Q*0x100+0x018+0x028*P+E)
 
     rt_elem*iso2;
-#define inf_ISO2            DP(Q*0x100+0x010+0x02C*P+E)
+#define inf_ISO2            DP(Q*0x100+0x018+0x02C*P+E)
 
     /* half-int arrays */
 
     rt_half*har0;
-#define inf_HAR0            DP(Q*0x100+0x010+0x030*P+E)
+#define inf_HAR0            DP(Q*0x100+0x018+0x030*P+E)
 
     rt_half*hco1;
-#define inf_HCO1            DP(Q*0x100+0x010+0x034*P+E)
+#define inf_HCO1            DP(Q*0x100+0x018+0x034*P+E)
 
     rt_half*hco2;
-#define inf_HCO2            DP(Q*0x100+0x010+0x038*P+E)
+#define inf_HCO2            DP(Q*0x100+0x018+0x038*P+E)
 
     rt_half*hso1;
-#define inf_HSO1            DP(Q*0x100+0x010+0x03C*P+E)
+#define inf_HSO1            DP(Q*0x100+0x018+0x03C*P+E)
 
     rt_half*hso2;
-#define inf_HSO2            DP(Q*0x100+0x010+0x040*P+E)
+#define inf_HSO2            DP(Q*0x100+0x018+0x040*P+E)
+
+    /* int8 GEMM panels (aligned within gemm[] below) */
+
+    rt_pntr gmmp;
+#define inf_GMMP            DP(Q*0x100+0x018+0x044*P)
+
+    /* timestamp regions */
+
+    rt_SIMD_TIMER tmr[2];
+#define inf_TMR(nx)         DP(Q*0x100+0x018+0x048*P + nx)
+
+    rt_ui64 tick[2];        /* 64-bit totals folded from tmr[].acc */
+
+    /* int8 GEMM panels (subtest 48), B and GM_M broadcast A per byte-quad */
+
+    rt_ui08 gemm[GM_K*(GM_M+1)*Q*16 + MASK];
+
+#if (defined RT_SPMD_TEST)
+
+    /* generated and hand-written SPMD kernel structs (subtests 50 - 52),
+     * aligned within */
+
+    rt_ui08 spmd[RT_MAX(RT_MAX(sizeof(rt_SIMD_SPMD_shade),
+                               sizeof(rt_SIMD_SPMD_scale)),
+                               sizeof(rt_SIMD_SHADE)) + MASK];
+
+#endif /* RT_SPMD_TEST */
 
 };
 
+/*
+ * Check displacements of test fields and element types of test arrays,
+ * a field added or resized without updating its offset fails the build.
+ * As rt_SIMD_INFOX derives from rt_SIMD_INFO it is not standard-layout,
+ * offsetof is still exact for single inheritance (no virtual bases).
+ */
+#if (defined __GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif /* __GNUC__ */
+
+RT_CHECK_DISP(rt_SIMD_INFOX, cyc,        0, inf_CYC);
+RT_CHECK_DISP(rt_SIMD_INFOX, loc,        0, inf_LOC);
+RT_CHECK_DISP(rt_SIMD_INFOX, size,       0, inf_SIZE);
+RT_CHECK_DISP(rt_SIMD_INFOX, simd,       0, inf_SIMD);
+RT_CHECK_DISP(rt_SIMD_INFOX, tile,       0, inf_TILE);
+RT_CHECK_DISP(rt_SIMD_INFOX, tloc,       0, inf_TLOC);
+RT_CHECK_DISP(rt_SIMD_INFOX, label,      0, inf_LABEL);
+RT_CHECK_DISP(rt_SIMD_INFOX, tail,       0, inf_TAIL);
+RT_CHECK_DISP(rt_SIMD_INFOX, far0,       E, inf_FAR0);
+RT_CHECK_DISP(rt_SIMD_INFOX, fco1,       E, inf_FCO1);
+RT_CHECK_DISP(rt_SIMD_INFOX, fco2,       E, inf_FCO2);
+RT_CHECK_DISP(rt_SIMD_INFOX, fso1,       E, inf_FSO1);
+RT_CHECK_DISP(rt_SIMD_INFOX, fso2,       E, inf_FSO2);
+RT_CHECK_DISP(rt_SIMD_INFOX, iar0,       E, inf_IAR0);
+RT_CHECK_DISP(rt_SIMD_INFOX, ico1,       E, inf_ICO1);
+RT_CHECK_DISP(rt_SIMD_INFOX, ico2,       E, inf_ICO2);
+RT_CHECK_DISP(rt_SIMD_INFOX, iso1,       E, inf_ISO1);
+RT_CHECK_DISP(rt_SIMD_INFOX, iso2,       E, inf_ISO2);
+RT_CHECK_DISP(rt_SIMD_INFOX, har0,       E, inf_HAR0);
+RT_CHECK_DISP(rt_SIMD_INFOX, hco1,       E, inf_HCO1);
+RT_CHECK_DISP(rt_SIMD_INFOX, hco2,       E, inf_HCO2);
+RT_CHECK_DISP(rt_SIMD_INFOX, hso1,       E, inf_HSO1);
+RT_CHECK_DISP(rt_SIMD_INFOX, hso2,       E, inf_HSO2);
+RT_CHECK_DISP(rt_SIMD_INFOX, gmmp,       0, inf_GMMP);
+RT_CHECK_DISP(rt_SIMD_INFOX, tmr,        0, inf_TMR(0));
+
+#if (defined RT_SPMD_TEST)
+
+RT_CHECK_DISP(rt_SIMD_SHADE, k,          0, shd_K);
+RT_CHECK_DISP(rt_SIMD_SHADE, c01,        0, shd_C01);
+RT_CHECK_DISP(rt_SIMD_SHADE, c10,        0, shd_C10);
+RT_CHECK_DISP(rt_SIMD_SHADE, cnt,        0, shd_CNT);
+RT_CHECK_DISP(rt_SIMD_SHADE, far0,       E, shd_FAR0);
+RT_CHECK_DISP(rt_SIMD_SHADE, fso1,       E, shd_FSO1);
+RT_CHECK_DISP(rt_SIMD_SHADE, fso2,       E, shd_FSO2);
+
+#endif /* RT_SPMD_TEST */
+
+#if (defined __GNUC__)
+#pragma GCC diagnostic pop
+#endif /* __GNUC__ */
+
+RT_CHECK_ELEM(rt_elem);
+RT_CHECK_ELEM(rt_real);
+
+/*
+ * Tile loop around the body of each s_testXX ASM section, the body runs
+ * info->tile times (1 unless in sweep mode), TILE_ADV is listed for every
+ * array the body reads or writes and moves it to the next tile (ARR_SIZE
+ * elements further) between iterations, destroys Reax at TILE_BEG.
+ * Labels are derived from (lb), which is unique for each subtest.
+ */
+#define TILE_BEG(lb)                                                        \
+        movwx_ld(Reax, Mebp, inf_TILE)                                      \
+        movwx_st(Reax, Mebp, inf_TLOC)                                      \
+    LBL(lb##_beg)
+
+#define TILE_CHK(lb)                                                        \
+        subwx_mi(Mebp, inf_TLOC, IB(1))                                     \
+        cmjwx_mz(Mebp, inf_TLOC,                                            \
+        /* if */ EQ_x, lb##_end)
+
+#define TILE_ADV(DA)                                                        \
+        addxx_mi(Mebp, W(DA), IH(ARR_SIZE*4*L))
+
+#define TILE_END(lb)                                                        \
+        jmpxx_lb(lb##_beg)                                                  \
+    LBL(lb##_end)
+
 /*
  * SIMD offsets within array (j-index below).
  */
@@ -210,6 +433,8 @@ rt_void s_test01(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile01)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_FSO1)
         movxx_ld(Rebx, Mebp, inf_FSO2)
@@ -269,6 +494,12 @@ rt_void s_test01(rt_SIMD_INFOX *info)
         movss_st(Xmm3, Mebx, AJ2)
 #endif /* RT_ELEM_TEST */
 
+        TILE_CHK(tile01)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile01)
+
         ASM_LEAVE(info)
     }
 }
@@ -349,6 +580,8 @@ rt_void s_test02(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile02)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_FSO1)
         movxx_ld(Rebx, Mebp, inf_FSO2)
@@ -408,6 +641,12 @@ rt_void s_test02(rt_SIMD_INFOX *info)
         movss_st(Xmm3, Mebx, AJ2)
 #endif /* RT_ELEM_TEST */
 
+        TILE_CHK(tile02)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile02)
+
         ASM_LEAVE(info)
     }
 }
@@ -488,6 +727,8 @@ rt_void s_test03(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile03)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -547,6 +788,12 @@ rt_void s_test03(rt_SIMD_INFOX *info)
         movss_st(Xmm3, Mebx, AJ2)
 #endif /* RT_ELEM_TEST */
 
+        TILE_CHK(tile03)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile03)
+
         ASM_LEAVE(info)
     }
 }
@@ -629,6 +876,8 @@ rt_void s_test04(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile04)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -688,6 +937,12 @@ rt_void s_test04(rt_SIMD_INFOX *info)
         movss_st(Xmm3, Mebx, AJ2)
 #endif /* RT_ELEM_TEST */
 
+        TILE_CHK(tile04)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile04)
+
         ASM_LEAVE(info)
     }
 }
@@ -770,6 +1025,8 @@ rt_void s_test05(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile05)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -829,6 +1086,12 @@ rt_void s_test05(rt_SIMD_INFOX *info)
         movss_st(Xmm3, Mebx, AJ2)
 #endif /* RT_ELEM_TEST */
 
+        TILE_CHK(tile05)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile05)
+
         ASM_LEAVE(info)
     }
 }
@@ -912,6 +1175,8 @@ rt_void s_test06(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile06)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
@@ -936,6 +1201,13 @@ rt_void s_test06(rt_SIMD_INFOX *info)
         movpx_st(Xmm2, Medx, AJ2)
         movpx_st(Xmm3, Mebx, AJ2)
 
+        TILE_CHK(tile06)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO2)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_END(tile06)
+
         ASM_LEAVE(info)
     }
 }
@@ -1017,6 +1289,8 @@ rt_void s_test07(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile07)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_FSO1)
         movxx_ld(Rebx, Mebp, inf_FSO2)
@@ -1060,6 +1334,12 @@ rt_void s_test07(rt_SIMD_INFOX *info)
         movss_st(Xmm3, Mebx, AJ2)
 #endif /* RT_ELEM_TEST */
 
+        TILE_CHK(tile07)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile07)
+
         ASM_LEAVE(info)
     }
 }
@@ -1140,6 +1420,8 @@ rt_void s_test08(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile08)
+
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -1226,6 +1508,12 @@ rt_void s_test08(rt_SIMD_INFOX *info)
         movyx_st(Recx, Mebx, AJ2)
 #endif /* RT_BASE_TEST */
 
+        TILE_CHK(tile08)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile08)
+
         ASM_LEAVE(info)
     }
 }
@@ -1303,6 +1591,8 @@ rt_void s_test09(rt_SIMD_INFOX *info)
 {
     ASM_ENTER(info)
 
+        TILE_BEG(tile09)
+
         movwx_ld(Reax, Mebp, inf_CYC)
         movwx_st(Reax, Mebp, inf_LOC)
 
@@ -1359,6 +1649,12 @@ rt_void s_test09(rt_SIMD_INFOX *info)
 
     LBL(cyc_end)
 
+        TILE_CHK(tile09)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile09)
+
     ASM_LEAVE(info)
 }
 
@@ -1440,6 +1736,8 @@ rt_void s_test10(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile10)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_FSO1)
         movxx_ld(Rebx, Mebp, inf_FSO2)
@@ -1499,6 +1797,12 @@ rt_void s_test10(rt_SIMD_INFOX *info)
         movss_st(Xmm3, Mebx, AJ2)
 #endif /* RT_ELEM_TEST */
 
+        TILE_CHK(tile10)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile10)
+
         ASM_LEAVE(info)
     }
 }
@@ -1579,6 +1883,8 @@ rt_void s_test11(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile11)
+
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -1652,6 +1958,12 @@ rt_void s_test11(rt_SIMD_INFOX *info)
         movyx_st(Recx, Mebx, AJ2)
 #endif /* RT_BASE_TEST */
 
+        TILE_CHK(tile11)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile11)
+
         ASM_LEAVE(info)
     }
 }
@@ -1734,6 +2046,8 @@ rt_void s_test12(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile12)
+
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -1808,6 +2122,12 @@ rt_void s_test12(rt_SIMD_INFOX *info)
         movyx_st(Reax, Mebx, AJ2)
 #endif /* RT_BASE_TEST */
 
+        TILE_CHK(tile12)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile12)
+
         ASM_LEAVE(info)
     }
 }
@@ -1890,6 +2210,8 @@ rt_void s_test13(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile13)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_FSO1)
         movxx_ld(Rebx, Mebp, inf_FSO2)
@@ -1915,6 +2237,12 @@ rt_void s_test13(rt_SIMD_INFOX *info)
         movpx_st(Xmm2, Medx, AJ2)
         movpx_st(Xmm3, Mebx, AJ2)
 
+        TILE_CHK(tile13)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile13)
+
         ASM_LEAVE(info)
     }
 }
@@ -2009,6 +2337,8 @@ rt_void s_test14(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile14)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -2088,6 +2418,12 @@ rt_void s_test14(rt_SIMD_INFOX *info)
 
         movpx_st(Xmm3, Mebx, AJ2)
 
+        TILE_CHK(tile14)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile14)
+
         ASM_LEAVE(info)
     }
 }
@@ -2194,6 +2530,8 @@ rt_void s_test15(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile15)
+
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -2249,6 +2587,12 @@ rt_void s_test15(rt_SIMD_INFOX *info)
         movyx_st(Recx, Mebx, AJ2)
 #endif /* RT_BASE_TEST */
 
+        TILE_CHK(tile15)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile15)
+
         ASM_LEAVE(info)
     }
 }
@@ -2329,6 +2673,8 @@ rt_void s_test16(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile16)
+
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -2399,6 +2745,12 @@ rt_void s_test16(rt_SIMD_INFOX *info)
         movyx_st(Reax, Mebx, AJ2)
 #endif /* RT_BASE_TEST */
 
+        TILE_CHK(tile16)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile16)
+
         ASM_LEAVE(info)
     }
 }
@@ -2481,6 +2833,8 @@ rt_void s_test17(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile17)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_FSO1)
         movxx_ld(Rebx, Mebp, inf_FSO2)
@@ -2502,6 +2856,12 @@ rt_void s_test17(rt_SIMD_INFOX *info)
         movpx_st(Xmm2, Medx, AJ2)
         movpx_st(Xmm3, Mebx, AJ2)
 
+        TILE_CHK(tile17)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile17)
+
         ASM_LEAVE(info)
     }
 }
@@ -2577,6 +2937,8 @@ rt_void s_test18(rt_SIMD_INFOX *info)
 {
     ASM_ENTER(info)
 
+        TILE_BEG(tile18)
+
         movwx_ld(Reax, Mebp, inf_CYC)
         movwx_st(Reax, Mebp, inf_LOC)
 
@@ -2637,6 +2999,12 @@ rt_void s_test18(rt_SIMD_INFOX *info)
 
     LBL(cyc_fin)
 
+        TILE_CHK(tile18)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile18)
+
     ASM_LEAVE(info)
 }
 
@@ -2718,6 +3086,8 @@ rt_void s_test19(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile19)
+
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -2781,6 +3151,12 @@ rt_void s_test19(rt_SIMD_INFOX *info)
         movyx_st(Redi, Mebx, AJ2)
 #endif /* RT_BASE_TEST */
 
+        TILE_CHK(tile19)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile19)
+
         ASM_LEAVE(info)
     }
 }
@@ -2863,6 +3239,8 @@ rt_void s_test20(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile20)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_FSO1)
         movxx_ld(Rebx, Mebp, inf_FSO2)
@@ -2922,6 +3300,12 @@ rt_void s_test20(rt_SIMD_INFOX *info)
         movss_st(Xmm3, Mebx, AJ2)
 #endif /* RT_ELEM_TEST */
 
+        TILE_CHK(tile20)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile20)
+
         ASM_LEAVE(info)
     }
 }
@@ -3007,6 +3391,8 @@ rt_void s_test21(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile21)
+
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -3054,6 +3440,12 @@ rt_void s_test21(rt_SIMD_INFOX *info)
         arjwx_mi(Mebp, inf_SIMD, IB(1),
         sub_x,   NZ_x, div_ini)
 
+        TILE_CHK(tile21)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile21)
+
         ASM_LEAVE(info)
     }
 }
@@ -3136,6 +3528,8 @@ rt_void s_test22(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile22)
+
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -3183,6 +3577,12 @@ rt_void s_test22(rt_SIMD_INFOX *info)
         arjwx_mi(Mebp, inf_SIMD, IB(1),
         sub_x,   NZ_x, rem_ini)
 
+        TILE_CHK(tile22)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile22)
+
         ASM_LEAVE(info)
     }
 }
@@ -3265,6 +3665,8 @@ rt_void s_test23(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile23)
+
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -3306,6 +3708,12 @@ rt_void s_test23(rt_SIMD_INFOX *info)
         arjwx_mi(Mebp, inf_SIMD, IB(1),
         sub_x,   NZ_x, ror_ini)
 
+        TILE_CHK(tile23)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile23)
+
         ASM_LEAVE(info)
     }
 }
@@ -3388,6 +3796,8 @@ rt_void s_test24(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile24)
+
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -3423,6 +3833,12 @@ rt_void s_test24(rt_SIMD_INFOX *info)
         movpx_st(Xmm1, Medx, AJ2)
         movpx_st(Xmm2, Mebx, AJ2)
 
+        TILE_CHK(tile24)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile24)
+
         ASM_LEAVE(info)
     }
 }
@@ -3531,6 +3947,8 @@ rt_void s_test25(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile25)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_FSO1)
         movxx_ld(Rebx, Mebp, inf_FSO2)
@@ -3603,6 +4021,12 @@ rt_void s_test25(rt_SIMD_INFOX *info)
         addxx_ri(Rebx, IB(4*L))
 #endif /* RT_ELEM_TEST */
 
+        TILE_CHK(tile25)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile25)
+
         ASM_LEAVE(info)
     }
 }
@@ -3710,6 +4134,8 @@ rt_void s_test26(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile26)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_FSO1)
         movxx_ld(Rebx, Mebp, inf_FSO2)
@@ -3769,6 +4195,12 @@ rt_void s_test26(rt_SIMD_INFOX *info)
         addxx_ri(Rebx, IB(4*L))
 #endif /* RT_ELEM_TEST */
 
+        TILE_CHK(tile26)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile26)
+
         ASM_LEAVE(info)
     }
 }
@@ -3860,6 +4292,8 @@ rt_void s_test27(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile27)
+
         movxx_ld(Recx, Mebp, inf_FAR0)
         movxx_ld(Redx, Mebp, inf_FSO1)
         movxx_ld(Rebx, Mebp, inf_FSO2)
@@ -3898,6 +4332,12 @@ rt_void s_test27(rt_SIMD_INFOX *info)
         movpx_ld(Xmm1, Mecx, AJ0)
         mmvpx_st(Xmm1, Mebx, AJ2)
 
+        TILE_CHK(tile27)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile27)
+
         ASM_LEAVE(info)
     }
 }
@@ -3982,6 +4422,8 @@ rt_void s_test28(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile28)
+
 #if RT_REGS >= 8
 
         /* BASE regs */
@@ -4185,6 +4627,11 @@ rt_void s_test28(rt_SIMD_INFOX *info)
         movyx_st(Reax, Medx, AJ0)
         movpx_st(Xmm0, Mebx, AJ0)
 
+        TILE_CHK(tile28)
+        TILE_ADV(inf_FSO2)
+        TILE_ADV(inf_ISO1)
+        TILE_END(tile28)
+
         ASM_LEAVE(info)
     }
 }
@@ -4261,6 +4708,8 @@ rt_void s_test29(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile29)
+
         movxx_ld(Resi, Mebp, inf_IAR0)
         movxx_ld(Redx, Mebp, inf_ISO1)
         movxx_ld(Rebx, Mebp, inf_ISO2)
@@ -4315,6 +4764,12 @@ rt_void s_test29(rt_SIMD_INFOX *info)
         movyx_st(Recx, Medx, AJ2)
 #endif /* RT_BASE_TEST */
 
+        TILE_CHK(tile29)
+        TILE_ADV(inf_IAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile29)
+
         ASM_LEAVE(info)
     }
 }
@@ -4397,6 +4852,8 @@ rt_void s_test30(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile30)
+
         movxx_ld(Resi, Mebp, inf_HAR0)
         movxx_ld(Redx, Mebp, inf_HSO1)
         movxx_ld(Rebx, Mebp, inf_HSO2)
@@ -4487,6 +4944,12 @@ rt_void s_test30(rt_SIMD_INFOX *info)
         movhx_st(Recx, Mebx, AJ2)
 #endif /* RT_BASE_TEST */
 
+        TILE_CHK(tile30)
+        TILE_ADV(inf_HAR0)
+        TILE_ADV(inf_HSO1)
+        TILE_ADV(inf_HSO2)
+        TILE_END(tile30)
+
         ASM_LEAVE(info)
     }
 }
@@ -4569,6 +5032,8 @@ rt_void s_test31(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile31)
+
         movxx_ld(Resi, Mebp, inf_HAR0)
         movxx_ld(Redx, Mebp, inf_HSO1)
         movxx_ld(Rebx, Mebp, inf_HSO2)
@@ -4649,6 +5114,12 @@ rt_void s_test31(rt_SIMD_INFOX *info)
         movhx_st(Reax, Mebx, AJ2)
 #endif /* RT_BASE_TEST */
 
+        TILE_CHK(tile31)
+        TILE_ADV(inf_HAR0)
+        TILE_ADV(inf_HSO1)
+        TILE_ADV(inf_HSO2)
+        TILE_END(tile31)
+
         ASM_LEAVE(info)
     }
 }
@@ -4731,6 +5202,8 @@ rt_void s_test32(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile32)
+
         movxx_ld(Resi, Mebp, inf_HAR0)
         movxx_ld(Redx, Mebp, inf_HSO1)
         movxx_ld(Rebx, Mebp, inf_HSO2)
@@ -4766,6 +5239,12 @@ rt_void s_test32(rt_SIMD_INFOX *info)
         movmx_st(Xmm1, Medx, AJ2)
         movmx_st(Xmm2, Mebx, AJ2)
 
+        TILE_CHK(tile32)
+        TILE_ADV(inf_HAR0)
+        TILE_ADV(inf_HSO1)
+        TILE_ADV(inf_HSO2)
+        TILE_END(tile32)
+
         ASM_LEAVE(info)
     }
 }
@@ -4848,6 +5327,8 @@ rt_void s_test33(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile33)
+
         movxx_ld(Resi, Mebp, inf_HAR0)
         movxx_ld(Redx, Mebp, inf_HSO1)
         movxx_ld(Rebx, Mebp, inf_HSO2)
@@ -4885,6 +5366,12 @@ rt_void s_test33(rt_SIMD_INFOX *info)
         xormx_rr(Xmm2, Xmm3)
         movmx_st(Xmm2, Mebx, AJ2)
 
+        TILE_CHK(tile33)
+        TILE_ADV(inf_HAR0)
+        TILE_ADV(inf_HSO1)
+        TILE_ADV(inf_HSO2)
+        TILE_END(tile33)
+
         ASM_LEAVE(info)
     }
 }
@@ -4967,6 +5454,8 @@ rt_void s_test34(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile34)
+
         movxx_ld(Resi, Mebp, inf_HAR0)
         movxx_ld(Redx, Mebp, inf_HSO1)
         movxx_ld(Rebx, Mebp, inf_HSO2)
@@ -4997,6 +5486,12 @@ rt_void s_test34(rt_SIMD_INFOX *info)
         ornmx_rr(Xmm2, Xmm0)
         movmx_st(Xmm2, Mebx, AJ2)
 
+        TILE_CHK(tile34)
+        TILE_ADV(inf_HAR0)
+        TILE_ADV(inf_HSO1)
+        TILE_ADV(inf_HSO2)
+        TILE_END(tile34)
+
         ASM_LEAVE(info)
     }
 }
@@ -5079,6 +5574,8 @@ rt_void s_test35(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile35)
+
         movxx_ld(Resi, Mebp, inf_HAR0)
         movxx_ld(Redx, Mebp, inf_HSO1)
         movxx_ld(Rebx, Mebp, inf_HSO2)
@@ -5109,6 +5606,12 @@ rt_void s_test35(rt_SIMD_INFOX *info)
         annmx_rr(Xmm2, Xmm0)
         movmx_st(Xmm2, Mebx, AJ2)
 
+        TILE_CHK(tile35)
+        TILE_ADV(inf_HAR0)
+        TILE_ADV(inf_HSO1)
+        TILE_ADV(inf_HSO2)
+        TILE_END(tile35)
+
         ASM_LEAVE(info)
     }
 }
@@ -5193,6 +5696,8 @@ rt_void s_test36(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile36)
+
         movxx_ld(Resi, Mebp, inf_HAR0)
         movxx_ld(Redx, Mebp, inf_HSO1)
         movxx_ld(Rebx, Mebp, inf_HSO2)
@@ -5221,6 +5726,12 @@ rt_void s_test36(rt_SIMD_INFOX *info)
         adsmn_rr(Xmm2, Xmm0)
         movmx_st(Xmm2, Mebx, AJ2)
 
+        TILE_CHK(tile36)
+        TILE_ADV(inf_HAR0)
+        TILE_ADV(inf_HSO1)
+        TILE_ADV(inf_HSO2)
+        TILE_END(tile36)
+
         ASM_LEAVE(info)
     }
 }
@@ -5304,6 +5815,8 @@ rt_void s_test37(rt_SIMD_INFOX *info)
     {
         ASM_ENTER(info)
 
+        TILE_BEG(tile37)
+
         movxx_ld(Resi, Mebp, inf_HAR0)
         movxx_ld(Redx, Mebp, inf_HSO1)
         movxx_ld(Rebx, Mebp, inf_HSO2)
@@ -5334,6 +5847,12 @@ rt_void s_test37(rt_SIMD_INFOX *info)
         sbsmn_rr(Xmm2, Xmm0)
         movmx_st(Xmm2, Mebx, AJ2)
 
+        TILE_CHK(tile37)
+        TILE_ADV(inf_HAR0)
+        TILE_ADV(inf_HSO1)
+        TILE_ADV(inf_HSO2)
+        TILE_END(tile37)
+
         ASM_LEAVE(info)
     }
 }
@@ -5372,463 +5891,4462 @@ rt_void p_test37(rt_SIMD_INFOX *info)
 #endif /* RUN_LEVEL 37 */
 
 /******************************************************************************/
-/*********************************   TABLES   *********************************/
+/******************************   RUN LEVEL 38   ******************************/
 /******************************************************************************/
 
-typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+#if RUN_LEVEL >= 38
 
-testXX c_test[RUN_LEVEL] =
+/*
+ * Dot-product kernels below accumulate 32-bit sums of byte-quads/half-pairs,
+ * which is the inner loop of an int8/int16 GEMM (quantized inference).
+ * Results wrap around on overflow, therefore unsigned math is used in C.
+ */
+#define SB(x, k)            ((rt_si32)(signed char)((x) >> (8*(k))))
+#define UB(x, k)            ((rt_si32)(rt_ui08)((x) >> (8*(k))))
+#define SH(x, k)            ((rt_si32)(rt_si16)((x) >> (16*(k))))
+
+rt_void c_test38(rt_SIMD_INFOX *info)
 {
-#if RUN_LEVEL >=  1
-    c_test01,
-#endif /* RUN_LEVEL  1 */
+    rt_si32 i, j, k, n = (info->size * sizeof(rt_elem)) / sizeof(rt_ui32);
 
-#if RUN_LEVEL >=  2
-    c_test02,
-#endif /* RUN_LEVEL  2 */
+    rt_ui32 *war0 = (rt_ui32 *)info->har0;
+    rt_ui32 *wco1 = (rt_ui32 *)info->ico1;
+    rt_ui32 *wco2 = (rt_ui32 *)info->ico2;
+    rt_ui32 *wco3 = (rt_ui32 *)info->hco1;
 
-#if RUN_LEVEL >=  3
-    c_test03,
-#endif /* RUN_LEVEL  3 */
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_ui32 s = war0[j], t = war0[(j + Q*4) % n];
 
-#if RUN_LEVEL >=  4
-    c_test04,
-#endif /* RUN_LEVEL  4 */
+            wco1[j] = s;
+            wco2[j] = s;
+            for (k = 0; k < 4; k++)
+            {
+                wco1[j] += (rt_ui32)(SB(s, k) * SB(t, k));
+                wco2[j] += (rt_ui32)(UB(s, k) * UB(t, k));
+            }
+            wco3[j] = s + (rt_ui32)(SH(s, 0) * SH(t, 0))
+                        + (rt_ui32)(SH(s, 1) * SH(t, 1));
+        }
+    }
+}
 
-#if RUN_LEVEL >=  5
-    c_test05,
-#endif /* RUN_LEVEL  5 */
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test38(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
 
-#if RUN_LEVEL >=  6
-    c_test06,
-#endif /* RUN_LEVEL  6 */
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
 
-#if RUN_LEVEL >=  7
-    c_test07,
-#endif /* RUN_LEVEL  7 */
+        TILE_BEG(tile38)
 
-#if RUN_LEVEL >=  8
-    c_test08,
-#endif /* RUN_LEVEL  8 */
+        movxx_ld(Resi, Mebp, inf_HAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+        movxx_ld(Recx, Mebp, inf_HSO1)
+
+        movox_ld(Xmm0, Mesi, AJ0)
+        movox_ld(Xmm1, Mesi, AJ1)
+        movox_rr(Xmm2, Xmm0)
+        dpbon_rr(Xmm2, Xmm0, Xmm1)
+        movox_st(Xmm2, Medx, AJ0)
+        movox_rr(Xmm2, Xmm0)
+        dpbox_rr(Xmm2, Xmm0, Xmm1)
+        movox_st(Xmm2, Mebx, AJ0)
+        movox_rr(Xmm2, Xmm0)
+        dphon_rr(Xmm2, Xmm0, Xmm1)
+        movox_st(Xmm2, Mecx, AJ0)
+
+        movox_ld(Xmm0, Mesi, AJ1)
+        movox_rr(Xmm2, Xmm0)
+        dpbon_ld(Xmm2, Xmm0, Mesi, AJ2)
+        movox_st(Xmm2, Medx, AJ1)
+        movox_rr(Xmm2, Xmm0)
+        dpbox_ld(Xmm2, Xmm0, Mesi, AJ2)
+        movox_st(Xmm2, Mebx, AJ1)
+        movox_rr(Xmm2, Xmm0)
+        dphon_ld(Xmm2, Xmm0, Mesi, AJ2)
+        movox_st(Xmm2, Mecx, AJ1)
+
+        movox_ld(Xmm0, Mesi, AJ2)
+        movox_ld(Xmm1, Mesi, AJ0)
+        movox_rr(Xmm2, Xmm0)
+        dpbon_rr(Xmm2, Xmm0, Xmm1)
+        movox_st(Xmm2, Medx, AJ2)
+        movox_rr(Xmm2, Xmm0)
+        dpbox_rr(Xmm2, Xmm0, Xmm1)
+        movox_st(Xmm2, Mebx, AJ2)
+        movox_rr(Xmm2, Xmm0)
+        dphon_rr(Xmm2, Xmm0, Xmm1)
+        movox_st(Xmm2, Mecx, AJ2)
+
+        TILE_CHK(tile38)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_ADV(inf_HAR0)
+        TILE_ADV(inf_HSO1)
+        TILE_END(tile38)
 
-#if RUN_LEVEL >=  9
-    c_test09,
-#endif /* RUN_LEVEL  9 */
+        ASM_LEAVE(info)
+    }
+}
 
-#if RUN_LEVEL >= 10
-    c_test10,
-#endif /* RUN_LEVEL 10 */
+rt_void p_test38(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = (info->size * sizeof(rt_elem)) / sizeof(rt_ui32);
 
-#if RUN_LEVEL >= 11
-    c_test11,
-#endif /* RUN_LEVEL 11 */
+    rt_ui32 *war0 = (rt_ui32 *)info->har0;
+    rt_ui32 *wco1 = (rt_ui32 *)info->ico1;
+    rt_ui32 *wco2 = (rt_ui32 *)info->ico2;
+    rt_ui32 *wco3 = (rt_ui32 *)info->hco1;
+    rt_ui32 *wso1 = (rt_ui32 *)info->iso1;
+    rt_ui32 *wso2 = (rt_ui32 *)info->iso2;
+    rt_ui32 *wso3 = (rt_ui32 *)info->hso1;
 
-#if RUN_LEVEL >= 12
-    c_test12,
-#endif /* RUN_LEVEL 12 */
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(wco1[j], wso1[j]) && IEQ(wco2[j], wso2[j])
+        &&  IEQ(wco3[j], wso3[j]) && !v_mode)
+        {
+            continue;
+        }
 
-#if RUN_LEVEL >= 13
-    c_test13,
-#endif /* RUN_LEVEL 13 */
+        RT_LOGI("warr[%d] = %08X, warr[%d] = %08X\n",
+                j, war0[j], (j + Q*4) % n, war0[(j + Q*4) % n]);
 
-#if RUN_LEVEL >= 14
-    c_test14,
-#endif /* RUN_LEVEL 14 */
+        RT_LOGI("C dpbn = %08X, dpbx = %08X, dphn = %08X\n",
+                wco1[j], wco2[j], wco3[j]);
 
-#if RUN_LEVEL >= 15
-    c_test15,
-#endif /* RUN_LEVEL 15 */
+        RT_LOGI("S dpbn = %08X, dpbx = %08X, dphn = %08X\n",
+                wso1[j], wso2[j], wso3[j]);
+    }
+}
 
-#if RUN_LEVEL >= 16
-    c_test16,
-#endif /* RUN_LEVEL 16 */
+#undef SB
+#undef UB
+#undef SH
 
-#if RUN_LEVEL >= 17
-    c_test17,
-#endif /* RUN_LEVEL 17 */
+#endif /* RUN_LEVEL 38 */
 
-#if RUN_LEVEL >= 18
-    c_test18,
-#endif /* RUN_LEVEL 18 */
+/******************************************************************************/
+/******************************   RUN LEVEL 39   ******************************/
+/******************************************************************************/
 
-#if RUN_LEVEL >= 19
-    c_test19,
-#endif /* RUN_LEVEL 19 */
+#if RUN_LEVEL >= 39
 
-#if RUN_LEVEL >= 20
-    c_test20,
-#endif /* RUN_LEVEL 20 */
+/*
+ * Divergent branch (if S > T then R1 = S + T, R2 = S * T else R2 = 0) below
+ * keeps its condition in a predicate on targets with RT_PRED != 0, otherwise
+ * the same result is produced with a mask in SIMD register and blending.
+ */
+rt_void c_test39(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = (info->size * sizeof(rt_elem)) / sizeof(rt_ui32);
+
+    rt_ui32 *war0 = (rt_ui32 *)info->har0;
+    rt_fp32 *fco1 = (rt_fp32 *)info->ico1;
+    rt_fp32 *fco2 = (rt_fp32 *)info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_fp32 s = (rt_fp32)(rt_si32)war0[j];
+            rt_fp32 t = (rt_fp32)(rt_si32)war0[(j + Q*4) % n];
+
+            fco1[j] = s > t ? s + t : s;
+            fco2[j] = s > t ? s * t : 0.0f;
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test39(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        TILE_BEG(tile39)
+
+        movxx_ld(Resi, Mebp, inf_HAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        cvnon_ld(Xmm1, Mesi, AJ0)
+        cvnon_ld(Xmm2, Mesi, AJ1)
+        movox_st(Xmm2, Mebx, AJ0)
+#if (RT_PRED != 0)
+        cgtosPrr(Px1, Xmm1, Xmm2)
+        mulos4rr(Xmm4, Pz1, Xmm1, Xmm2)
+        movox_rr(Xmm3, Xmm1)
+        addosPld(Xmm3, Pm1, Mebx, AJ0)
+#else  /* RT_PRED == 0 */
+        movox_rr(Xmm0, Xmm1)
+        cgtos_rr(Xmm0, Xmm2)
+        mulos3rr(Xmm4, Xmm1, Xmm2)
+        andox_rr(Xmm4, Xmm0)
+        addos3ld(Xmm3, Xmm1, Mebx, AJ0)
+        mmvox_rr(Xmm1, Xmm3)
+        movox_rr(Xmm3, Xmm1)
+#endif /* RT_PRED */
+        movox_st(Xmm3, Medx, AJ0)
+        movox_st(Xmm4, Mebx, AJ0)
+
+        cvnon_ld(Xmm1, Mesi, AJ1)
+        cvnon_ld(Xmm2, Mesi, AJ2)
+        movox_st(Xmm2, Mebx, AJ1)
+#if (RT_PRED != 0)
+        cgtosPrr(Px1, Xmm1, Xmm2)
+        mulos4rr(Xmm4, Pz1, Xmm1, Xmm2)
+        movox_rr(Xmm3, Xmm1)
+        addosPld(Xmm3, Pm1, Mebx, AJ1)
+#else  /* RT_PRED == 0 */
+        movox_rr(Xmm0, Xmm1)
+        cgtos_rr(Xmm0, Xmm2)
+        mulos3rr(Xmm4, Xmm1, Xmm2)
+        andox_rr(Xmm4, Xmm0)
+        addos3ld(Xmm3, Xmm1, Mebx, AJ1)
+        mmvox_rr(Xmm1, Xmm3)
+        movox_rr(Xmm3, Xmm1)
+#endif /* RT_PRED */
+        movox_st(Xmm3, Medx, AJ1)
+        movox_st(Xmm4, Mebx, AJ1)
+
+        cvnon_ld(Xmm1, Mesi, AJ2)
+        cvnon_ld(Xmm2, Mesi, AJ0)
+        movox_st(Xmm2, Mebx, AJ2)
+#if (RT_PRED != 0)
+        cgtosPrr(Px1, Xmm1, Xmm2)
+        mulos4rr(Xmm4, Pz1, Xmm1, Xmm2)
+        movox_rr(Xmm3, Xmm1)
+        addosPld(Xmm3, Pm1, Mebx, AJ2)
+#else  /* RT_PRED == 0 */
+        movox_rr(Xmm0, Xmm1)
+        cgtos_rr(Xmm0, Xmm2)
+        mulos3rr(Xmm4, Xmm1, Xmm2)
+        andox_rr(Xmm4, Xmm0)
+        addos3ld(Xmm3, Xmm1, Mebx, AJ2)
+        mmvox_rr(Xmm1, Xmm3)
+        movox_rr(Xmm3, Xmm1)
+#endif /* RT_PRED */
+        movox_st(Xmm3, Medx, AJ2)
+        movox_st(Xmm4, Mebx, AJ2)
+
+        TILE_CHK(tile39)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_ADV(inf_HAR0)
+        TILE_END(tile39)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test39(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = (info->size * sizeof(rt_elem)) / sizeof(rt_ui32);
+
+    rt_ui32 *war0 = (rt_ui32 *)info->har0;
+    rt_fp32 *fco1 = (rt_fp32 *)info->ico1;
+    rt_fp32 *fco2 = (rt_fp32 *)info->ico2;
+    rt_fp32 *fso1 = (rt_fp32 *)info->iso1;
+    rt_fp32 *fso2 = (rt_fp32 *)info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("warr[%d] = %08X, warr[%d] = %08X\n",
+                j, war0[j], (j + Q*4) % n, war0[(j + Q*4) % n]);
+
+        RT_LOGI("C (S > T ? S + T : S) = %e, (S > T ? S * T : 0) = %e\n",
+                fco1[j], fco2[j]);
+
+        RT_LOGI("S (S > T ? S + T : S) = %e, (S > T ? S * T : 0) = %e\n",
+                fso1[j], fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 39 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 40   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 40
+
+/*
+ * Loop over (N - 1) elements (R1 = S * S + S) below doesn't depend on SIMD
+ * width on targets with RT_PRED != 0, where the tail is processed under
+ * predicate, otherwise full vectors are used and the last element is reset.
+ */
+rt_void c_test40(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = (info->size * sizeof(rt_elem)) / sizeof(rt_ui32);
+
+    rt_ui32 *war0 = (rt_ui32 *)info->har0;
+    rt_fp32 *fco1 = (rt_fp32 *)info->ico1;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        fco1[n-1] = 0.0f;
+
+        j = n-1;
+        while (j-->0)
+        {
+            rt_fp32 s = (rt_fp32)(rt_si32)war0[j];
+
+            fco1[j] = s * s + s;
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test40(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        TILE_BEG(tile40)
+
+        movxx_ld(Resi, Mebp, inf_HAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+        shlwx_ri(Redi, IB(L-1))
+        subwx_ri(Redi, IB(1))
+
+        xorox_rr(Xmm0, Xmm0)
+        movox_st(Xmm0, Medx, AJ0)
+        movox_st(Xmm0, Medx, AJ1)
+        movox_st(Xmm0, Medx, AJ2)
+
+        movwx_ri(Recx, IB(0))
+
+    LBL(vla_beg)
+
+#if (RT_PRED != 0)
+        whloxPrr(Px1, Recx, Redi)
+        mkjoxPrx(Px1, NONE, vla_end)
+        movwx_rr(Reax, Recx)
+        shlwx_ri(Reax, IB(2))
+        movoxPld(Xmm1, Pz1, Iesi, DP(0))
+        cvnon_rr(Xmm1, Xmm1)
+        mulos3rr(Xmm2, Xmm1, Xmm1)
+        addos_rr(Xmm2, Xmm1)
+        movoxPst(Xmm2, Px1, Iedx, DP(0))
+        incox_rx(Recx)
+        jmpxx_lb(vla_beg)
+#else  /* RT_PRED == 0 */
+        cmjwx_rr(Recx, Redi,
+        /* if */ GE_x, vla_end)
+        movwx_rr(Reax, Recx)
+        shlwx_ri(Reax, IB(2))
+        cvnon_ld(Xmm1, Iesi, DP(0))
+        mulos3rr(Xmm2, Xmm1, Xmm1)
+        addos_rr(Xmm2, Xmm1)
+        movox_st(Xmm2, Iedx, DP(0))
+        addwx_ri(Recx, IB(RT_SIMD/32))
+        jmpxx_lb(vla_beg)
+#endif /* RT_PRED */
+
+    LBL(vla_end)
+
+#if (RT_PRED == 0)
+        movwx_rr(Reax, Redi)
+        shlwx_ri(Reax, IB(2))
+        movwx_mi(Iedx, DP(0), IB(0))
+#endif /* RT_PRED */
+
+        TILE_CHK(tile40)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_HAR0)
+        TILE_END(tile40)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test40(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = (info->size * sizeof(rt_elem)) / sizeof(rt_ui32);
+
+    rt_ui32 *war0 = (rt_ui32 *)info->har0;
+    rt_fp32 *fco1 = (rt_fp32 *)info->ico1;
+    rt_fp32 *fso1 = (rt_fp32 *)info->iso1;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("warr[%d] = %08X\n",
+                j, war0[j]);
+
+        RT_LOGI("C (S * S + S) = %e, tail = %d\n",
+                fco1[j], j == n-1);
+
+        RT_LOGI("S (S * S + S) = %e, tail = %d\n",
+                fso1[j], j == n-1);
+    }
+}
+
+#endif /* RUN_LEVEL 40 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 41   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 41
+
+/*
+ * Polynomial of degree 13 in (T = S / (S + 1)) below keeps its coefficients
+ * in 14 extra registers (XmmG - XmmT) on targets with RT_REGS >= 32, which
+ * makes it a register-pressure benchmark for targets with emulated 30-regs.
+ * The 2nd and 3rd vectors keep intermediate results in XmmC - XmmF as well,
+ * exercising emulated destinations in 2-operand, 3-operand and _ld forms.
+ */
+rt_void c_test41(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_real t = far0[j] / (far0[j] + 1.0f);
+            rt_real r = +1.0f;
+
+            r = r * t - 0.5f;
+            r = r * t + 3.0f;
+            r = r * t + 1.0f;
+            r = r * t - 0.5f;
+            r = r * t + 3.0f;
+            r = r * t + 1.0f;
+            r = r * t - 0.5f;
+            r = r * t + 3.0f;
+            r = r * t + 1.0f;
+            r = r * t - 0.5f;
+            r = r * t + 3.0f;
+            r = r * t + 1.0f;
+            r = r * t - 0.5f;
+
+            fco1[j] = r;
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test41(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        TILE_BEG(tile41)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+
+        movpx_ld(Xmm1, Mebp, inf_GPC01)
+#if RT_REGS >= 32
+        movpx_ld(XmmG, Mebp, inf_GPC01)
+        movpx_ld(XmmH, Mebp, inf_GPC02)
+        movpx_ld(XmmI, Mebp, inf_GPC03)
+        movpx_ld(XmmJ, Mebp, inf_GPC01)
+        movpx_ld(XmmK, Mebp, inf_GPC02)
+        movpx_ld(XmmL, Mebp, inf_GPC03)
+        movpx_ld(XmmM, Mebp, inf_GPC01)
+        movpx_ld(XmmN, Mebp, inf_GPC02)
+        movpx_ld(XmmO, Mebp, inf_GPC03)
+        movpx_ld(XmmP, Mebp, inf_GPC01)
+        movpx_ld(XmmQ, Mebp, inf_GPC02)
+        movpx_ld(XmmR, Mebp, inf_GPC03)
+        movpx_ld(XmmS, Mebp, inf_GPC01)
+        movpx_ld(XmmT, Mebp, inf_GPC02)
+#endif /* RT_REGS >= 32 */
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_rr(Xmm2, Xmm0)
+        addps_rr(Xmm2, Xmm1)
+        divps_rr(Xmm0, Xmm2)
+#if RT_REGS >= 32
+        movpx_rr(Xmm3, XmmG)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmH)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmI)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmJ)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmK)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmL)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmM)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmN)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmO)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmP)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmQ)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmR)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmS)
+        mulps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, XmmT)
+#else  /* RT_REGS < 32 */
+        movpx_rr(Xmm3, Xmm1)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+#endif /* RT_REGS */
+        movpx_st(Xmm3, Medx, AJ0)
+
+#if RT_REGS >= 32
+        movpx_ld(XmmC, Mecx, AJ1)
+        movpx_rr(XmmD, XmmC)
+        addps_ld(XmmD, Mebp, inf_GPC01)
+        divps_rr(XmmC, XmmD)
+        movpx_rr(XmmE, XmmG)
+        mulps_rr(XmmE, XmmC)
+        addps_ld(XmmE, Mebp, inf_GPC02)
+        mulps_rr(XmmE, XmmC)
+        addps_rr(XmmE, XmmI)
+        mulps_rr(XmmE, XmmC)
+        addps_ld(XmmE, Mebp, inf_GPC01)
+        mulps_rr(XmmE, XmmC)
+        addps_rr(XmmE, XmmK)
+        mulps_rr(XmmE, XmmC)
+        addps_ld(XmmE, Mebp, inf_GPC03)
+        mulps_rr(XmmE, XmmC)
+        addps_rr(XmmE, XmmM)
+        mulps_rr(XmmE, XmmC)
+        addps_ld(XmmE, Mebp, inf_GPC02)
+        mulps_rr(XmmE, XmmC)
+        addps_rr(XmmE, XmmO)
+        mulps_rr(XmmE, XmmC)
+        addps_ld(XmmE, Mebp, inf_GPC01)
+        mulps_rr(XmmE, XmmC)
+        addps_rr(XmmE, XmmQ)
+        mulps_rr(XmmE, XmmC)
+        addps_ld(XmmE, Mebp, inf_GPC03)
+        mulps_rr(XmmE, XmmC)
+        addps_rr(XmmE, XmmS)
+        mulps_rr(XmmE, XmmC)
+        addps_ld(XmmE, Mebp, inf_GPC02)
+        movpx_st(XmmE, Medx, AJ1)
+#else  /* RT_REGS < 32 */
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_rr(Xmm2, Xmm0)
+        addps_rr(Xmm2, Xmm1)
+        divps_rr(Xmm0, Xmm2)
+        movpx_rr(Xmm3, Xmm1)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        movpx_st(Xmm3, Medx, AJ1)
+#endif /* RT_REGS */
+
+#if RT_REGS >= 32
+        movpx_ld(XmmF, Mecx, AJ2)
+        addps3ld(XmmD, XmmF, Mebp, inf_GPC01)
+        divps3rr(XmmC, XmmF, XmmD)
+        mulps3rr(XmmE, XmmG, XmmC)
+        addps3rr(XmmE, XmmE, XmmH)
+        mulps3rr(XmmF, XmmE, XmmC)
+        addps3ld(XmmF, XmmF, Mebp, inf_GPC03)
+        mulps3rr(XmmE, XmmF, XmmC)
+        addps3rr(XmmE, XmmE, XmmJ)
+        mulps3rr(XmmF, XmmE, XmmC)
+        addps3ld(XmmF, XmmF, Mebp, inf_GPC02)
+        mulps3rr(XmmE, XmmF, XmmC)
+        addps3rr(XmmE, XmmE, XmmL)
+        mulps3rr(XmmF, XmmE, XmmC)
+        addps3ld(XmmF, XmmF, Mebp, inf_GPC01)
+        mulps3rr(XmmE, XmmF, XmmC)
+        addps3rr(XmmE, XmmE, XmmN)
+        mulps3rr(XmmF, XmmE, XmmC)
+        addps3ld(XmmF, XmmF, Mebp, inf_GPC03)
+        mulps3rr(XmmE, XmmF, XmmC)
+        addps3rr(XmmE, XmmE, XmmP)
+        mulps3rr(XmmF, XmmE, XmmC)
+        addps3ld(XmmF, XmmF, Mebp, inf_GPC02)
+        mulps3rr(XmmE, XmmF, XmmC)
+        addps3rr(XmmE, XmmE, XmmR)
+        mulps3rr(XmmF, XmmE, XmmC)
+        addps3ld(XmmF, XmmF, Mebp, inf_GPC01)
+        mulps3rr(XmmE, XmmF, XmmC)
+        addps3rr(XmmE, XmmE, XmmT)
+        movpx_st(XmmE, Medx, AJ2)
+#else  /* RT_REGS < 32 */
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_rr(Xmm2, Xmm0)
+        addps_rr(Xmm2, Xmm1)
+        divps_rr(Xmm0, Xmm2)
+        movpx_rr(Xmm3, Xmm1)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC03)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC01)
+        mulps_rr(Xmm3, Xmm0)
+        addps_ld(Xmm3, Mebp, inf_GPC02)
+        movpx_st(Xmm3, Medx, AJ2)
+#endif /* RT_REGS */
+
+        TILE_CHK(tile41)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_END(tile41)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test41(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fso1 = info->fso1;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C P13(S / (S + 1)) = %e\n",
+                fco1[j]);
+
+        RT_LOGI("S P13(S / (S + 1)) = %e\n",
+                fso1[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 41 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 42   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 42
+
+/*
+ * Interval quotient (R1 = S / T rounded down, R2 = S / T rounded up) below
+ * is checked exactly, its bounds are equal only if the quotient is exact.
+ * Static rounding is used on AVX-512 targets, FCTRL switches elsewhere.
+ */
+rt_void c_test42(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_real s = far0[j];
+            rt_real t = far0[(j + S) % n];
+            rt_real q = s / t;
+            rt_fp64 r = fma(-(rt_fp64)q, (rt_fp64)t, (rt_fp64)s);
+
+            fco1[j] = r < 0.0 ? RT_NEXT(q, -RT_INF) : q;
+            fco2[j] = r > 0.0 ? RT_NEXT(q, +RT_INF) : q;
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test42(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        TILE_BEG(tile42)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        divpsRrr(Xmm2, Xmm0, Xmm1, ROUNDM)
+        divpsRrr(Xmm3, Xmm0, Xmm1, ROUNDP)
+        movpx_st(Xmm2, Medx, AJ0)
+        movpx_st(Xmm3, Mebx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_ld(Xmm1, Mecx, AJ2)
+        divpsRrr(Xmm2, Xmm0, Xmm1, ROUNDM)
+        divpsRrr(Xmm3, Xmm0, Xmm1, ROUNDP)
+        movpx_st(Xmm2, Medx, AJ1)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_ld(Xmm1, Mecx, AJ0)
+        divpsRrr(Xmm2, Xmm0, Xmm1, ROUNDM)
+        divpsRrr(Xmm3, Xmm0, Xmm1, ROUNDP)
+        movpx_st(Xmm2, Medx, AJ2)
+        movpx_st(Xmm3, Mebx, AJ2)
+
+        TILE_CHK(tile42)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile42)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test42(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (fco1[j] == fso1[j] && fco2[j] == fso2[j] && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+
+        RT_LOGI("C farr[%d]/farr[%d] = [%+.25e, %+.25e]\n",
+                j, (j + S) % n, fco1[j], fco2[j]);
+
+        RT_LOGI("S farr[%d]/farr[%d] = [%+.25e, %+.25e]\n",
+                j, (j + S) % n, fso1[j], fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 42 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 43   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 43
+
+rt_void c_test43(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = far0[j] * far0[(j + S) % n];
+            fco2[j] = far0[j] + far0[(j + S) % n];
+        }
+    }
+}
+
+/*
+ * Timestamp regions below are accumulated in 32-bit within each ASM section
+ * and folded into 64-bit totals after ASM_LEAVE, region 1 nests in region 0.
+ */
+rt_void s_test43(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, k;
+
+    for (k = 0; k < 2; k++)
+    {
+        info->tmr[k].acc = 0;
+        info->tmr[k].cnt = 0;
+        info->tick[k] = 0;
+    }
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        TILE_BEG(tile43)
+
+        tmrwx_bg(Reax, Mebp, inf_TMR, 0)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_rr(Xmm2, Xmm0)
+        mulps_rr(Xmm2, Xmm1)
+        movpx_st(Xmm2, Medx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_ld(Xmm1, Mecx, AJ2)
+        movpx_rr(Xmm2, Xmm0)
+        mulps_rr(Xmm2, Xmm1)
+        movpx_st(Xmm2, Medx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_ld(Xmm1, Mecx, AJ0)
+        movpx_rr(Xmm2, Xmm0)
+        mulps_rr(Xmm2, Xmm1)
+        movpx_st(Xmm2, Medx, AJ2)
+
+        tmrwx_bg(Reax, Mebp, inf_TMR, 1)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Mebx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_ld(Xmm1, Mecx, AJ2)
+        movpx_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_ld(Xmm1, Mecx, AJ0)
+        movpx_rr(Xmm3, Xmm0)
+        addps_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Mebx, AJ2)
+
+        tmrwx_nd(Reax, Mebp, inf_TMR, 1)
+
+        tmrwx_nd(Reax, Mebp, inf_TMR, 0)
+
+        TILE_CHK(tile43)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile43)
+
+        ASM_LEAVE(info)
+
+        for (k = 0; k < 2; k++)
+        {
+            info->tick[k] += info->tmr[k].acc;
+            info->tmr[k].acc = 0;
+        }
+    }
+}
+
+rt_void p_test43(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+
+        RT_LOGI("C farr[%d]*farr[%d] = %e, farr[%d]+farr[%d] = %e\n",
+                j, (j + S) % n, fco1[j], j, (j + S) % n, fco2[j]);
+
+        RT_LOGI("S farr[%d]*farr[%d] = %e, farr[%d]+farr[%d] = %e\n",
+                j, (j + S) % n, fso1[j], j, (j + S) % n, fso2[j]);
+    }
+
+    for (k = 0; k < 2; k++)
+    {
+        if ((rt_si32)info->tmr[k].cnt == info->cyc && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("S region %d: ticks = %llu, entries = %u, per entry = %.1f\n",
+                k, (unsigned long long)info->tick[k], info->tmr[k].cnt,
+                info->tmr[k].cnt == 0 ? 0.0 :
+                (rt_fp64)info->tick[k] / (rt_fp64)info->tmr[k].cnt);
+    }
+}
+
+#endif /* RUN_LEVEL 43 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 44   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 44
+
+rt_void c_test44(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = far0[j] > 1.0 ? far0[j] : 0.0;
+            fco2[j] = far0[j] > 1.0 ? 1.0 : 0.0;
+        }
+    }
+}
+
+/*
+ * Mask-jump sites below are instrumented with -DRT_SIMD_PROFILE=n (n >= 3),
+ * in which case the harness prints their profiles after the S-test.
+ */
+rt_void s_test44(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        TILE_BEG(tile44)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm2, Mebp, inf_GPC01)
+        movpx_rr(Xmm4, Xmm2)
+        cltps_rr(Xmm2, Xmm0)
+        xorpx_rr(Xmm3, Xmm3)
+        movpx_st(Xmm3, Medx, AJ0)
+        movpx_st(Xmm3, Mebx, AJ0)
+        mkppx_rx(Xmm2, NONE, mk0_out, 0)
+        andpx_rr(Xmm0, Xmm2)
+        andpx_rr(Xmm4, Xmm2)
+        movpx_st(Xmm0, Medx, AJ0)
+        movpx_st(Xmm4, Mebx, AJ0)
+
+    LBL(mk0_out)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_ld(Xmm2, Mebp, inf_GPC01)
+        movpx_rr(Xmm4, Xmm2)
+        cltps_rr(Xmm2, Xmm0)
+        xorpx_rr(Xmm3, Xmm3)
+        movpx_st(Xmm3, Medx, AJ1)
+        movpx_st(Xmm3, Mebx, AJ1)
+        mkppx_rx(Xmm2, NONE, mk1_out, 1)
+        andpx_rr(Xmm0, Xmm2)
+        andpx_rr(Xmm4, Xmm2)
+        movpx_st(Xmm0, Medx, AJ1)
+        movpx_st(Xmm4, Mebx, AJ1)
+
+    LBL(mk1_out)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_ld(Xmm2, Mebp, inf_GPC01)
+        movpx_rr(Xmm4, Xmm2)
+        cltps_rr(Xmm2, Xmm0)
+        xorpx_rr(Xmm3, Xmm3)
+        movpx_st(Xmm3, Medx, AJ2)
+        movpx_st(Xmm3, Mebx, AJ2)
+        mkppx_rx(Xmm2, NONE, mk2_out, 2)
+        andpx_rr(Xmm0, Xmm2)
+        andpx_rr(Xmm4, Xmm2)
+        movpx_st(Xmm0, Medx, AJ2)
+        movpx_st(Xmm4, Mebx, AJ2)
+
+    LBL(mk2_out)
+
+        TILE_CHK(tile44)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile44)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test44(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C (farr[%d]>1.0)&farr[%d] = %e, (farr[%d]>1.0)&1.0 = %e\n",
+                j, j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S (farr[%d]>1.0)&farr[%d] = %e, (farr[%d]>1.0)&1.0 = %e\n",
+                j, j, fso1[j], j, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 44 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 45   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 45
+
+/*
+ * Interval quotient (R1 = S / T rounded down, R2 = S / T rounded up) below
+ * is checked exactly, same as in subtest 42, but S-side computes it within
+ * nested FCTRL_PUSH/FCTRL_POP blocks (ROUNDM outside, ROUNDP inside,
+ * where a redundant ROUNDP block is nested once more) to check that
+ * each pop resumes the mode of the enclosing block.
+ */
+rt_void c_test45(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_real s = far0[j];
+            rt_real t = far0[(j + S) % n];
+            rt_real q = s / t;
+            rt_fp64 r = fma(-(rt_fp64)q, (rt_fp64)t, (rt_fp64)s);
+
+            fco1[j] = r < 0.0 ? RT_NEXT(q, -RT_INF) : q;
+            fco2[j] = r > 0.0 ? RT_NEXT(q, +RT_INF) : q;
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test45(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        TILE_BEG(tile45)
+
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(nst_beg)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        FCTRL_PUSH(ROUNDM, fcm)
+        FCTRL_PUSH(ROUNDP, fcp)
+        FCTRL_PUSH(ROUNDP, fcr)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        divps_ld(Xmm0, Mecx, AJ1)
+        movpx_st(Xmm0, Mebx, AJ0)
+
+        FCTRL_POP(fcr)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        divps_ld(Xmm0, Mecx, AJ2)
+        movpx_st(Xmm0, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        divps_ld(Xmm0, Mecx, AJ0)
+        movpx_st(Xmm0, Mebx, AJ2)
+
+        FCTRL_POP(fcp)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        divps_ld(Xmm0, Mecx, AJ1)
+        movpx_st(Xmm0, Medx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        divps_ld(Xmm0, Mecx, AJ2)
+        movpx_st(Xmm0, Medx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        divps_ld(Xmm0, Mecx, AJ0)
+        movpx_st(Xmm0, Medx, AJ2)
+
+        FCTRL_POP(fcm)
+
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ EQ_x, nst_end)
+
+        jmpxx_lb(nst_beg)
+
+    LBL(nst_end)
+
+        TILE_CHK(tile45)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile45)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test45(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (fco1[j] == fso1[j] && fco2[j] == fso2[j] && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+
+        RT_LOGI("C farr[%d]/farr[%d] = [%+.25e, %+.25e]\n",
+                j, (j + S) % n, fco1[j], fco2[j]);
+
+        RT_LOGI("S farr[%d]/farr[%d] = [%+.25e, %+.25e]\n",
+                j, (j + S) % n, fso1[j], fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 45 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 46   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 46
+
+/*
+ * Stream compaction of elements greater than their (j + S) % n neighbours
+ * into a contiguous stream (zero-padded to n) via compress-store (cpspx_st),
+ * which is then read back into the active lanes of zeroed vectors
+ * via expand-load (xpdpx_ld), both counts of active lanes advance the stream.
+ */
+rt_void c_test46(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        k = 0;
+        for (j = 0; j < n; j++)
+        {
+            rt_real s = far0[j];
+            rt_real t = far0[(j + S) % n];
+
+            if (s > t)
+            {
+                fco1[k++] = s;
+            }
+            fco2[j] = s > t ? s : 0.0;
+        }
+        while (k < n)
+        {
+            fco1[k++] = 0.0;
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test46(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        TILE_BEG(tile46)
+
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(cmp_beg)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Rebx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_FSO2)
+
+        xorpx_rr(Xmm7, Xmm7)
+        movpx_st(Xmm7, Mebx, AJ0)
+        movpx_st(Xmm7, Mebx, AJ1)
+        movpx_st(Xmm7, Mebx, AJ2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_rr(Xmm1, Xmm0)
+        cgtps_ld(Xmm1, Mecx, AJ1)
+        cpspx_st(Xmm0, Xmm1, Resi, Iebx, DP(0), cps0)
+        movpx_rr(Xmm2, Xmm7)
+        xpdpx_ld(Xmm2, Xmm1, Redi, Iebx, DP(0), xpd0)
+        movpx_st(Xmm2, Medx, AJ0)
+        addxx_rr(Resi, Redi)
+        shlxx_ri(Resi, IB(L))
+        addxx_rr(Rebx, Resi)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_rr(Xmm1, Xmm0)
+        cgtps_ld(Xmm1, Mecx, AJ2)
+        cpspx_st(Xmm0, Xmm1, Resi, Iebx, DP(0), cps1)
+        movpx_rr(Xmm2, Xmm7)
+        xpdpx_ld(Xmm2, Xmm1, Redi, Iebx, DP(0), xpd1)
+        movpx_st(Xmm2, Medx, AJ1)
+        addxx_rr(Resi, Redi)
+        shlxx_ri(Resi, IB(L))
+        addxx_rr(Rebx, Resi)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_rr(Xmm1, Xmm0)
+        cgtps_ld(Xmm1, Mecx, AJ0)
+        cpspx_st(Xmm0, Xmm1, Resi, Iebx, DP(0), cps2)
+        movpx_rr(Xmm2, Xmm7)
+        xpdpx_ld(Xmm2, Xmm1, Redi, Iebx, DP(0), xpd2)
+        movpx_st(Xmm2, Medx, AJ2)
+        addxx_rr(Resi, Redi)
+        shlxx_ri(Resi, IB(L))
+        addxx_rr(Rebx, Resi)
+
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ EQ_x, cmp_end)
+
+        jmpxx_lb(cmp_beg)
+
+    LBL(cmp_end)
+
+        TILE_CHK(tile46)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_ADV(inf_FSO2)
+        TILE_END(tile46)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test46(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (fco1[j] == fso1[j] && fco2[j] == fso2[j] && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+
+        RT_LOGI("C stream[%d] = %e, expand[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S stream[%d] = %e, expand[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 46 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 47   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 47
+
+/*
+ * Masks of elements greater than their (j + S) % n neighbours are moved
+ * into BASE registers as lane bitmasks (mkmpx_rx) and active-lane counts
+ * (mkcpx_rx), which are stored into the 1st element of each SIMD block
+ * (other elements are zeroed), bitmask is skipped if S > RT_ELEMENT.
+ */
+rt_void c_test47(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        for (k = 0; k < n; k += S)
+        {
+            rt_uelm m = 0;
+            rt_elem c = 0;
+
+            for (j = k; j < k + S; j++)
+            {
+                if (far0[j] > far0[(j + S) % n])
+                {
+#if (S <= RT_ELEMENT)
+                    m |= (rt_uelm)1 << (j - k);
+#endif /* S <= RT_ELEMENT */
+                    c++;
+                }
+                ico1[j] = 0;
+                ico2[j] = 0;
+            }
+            ico1[k] = (rt_elem)m;
+            ico2[k] = c;
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test47(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        TILE_BEG(tile47)
+
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(msk_beg)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Rebx, Mebp, inf_ISO1)
+        movxx_ld(Redx, Mebp, inf_ISO2)
+
+        xorpx_rr(Xmm7, Xmm7)
+        movpx_st(Xmm7, Mebx, AJ0)
+        movpx_st(Xmm7, Mebx, AJ1)
+        movpx_st(Xmm7, Mebx, AJ2)
+        movpx_st(Xmm7, Medx, AJ0)
+        movpx_st(Xmm7, Medx, AJ1)
+        movpx_st(Xmm7, Medx, AJ2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        cgtps_ld(Xmm0, Mecx, AJ1)
+#if (S <= RT_ELEMENT)
+        mkmpx_rx(Xmm0, Resi, mkm0)
+        movyx_st(Resi, Mebx, AJ0)
+#endif /* S <= RT_ELEMENT */
+        mkcpx_rx(Xmm0, Redi, mkc0)
+        movyx_st(Redi, Medx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        cgtps_ld(Xmm0, Mecx, AJ2)
+#if (S <= RT_ELEMENT)
+        mkmpx_rx(Xmm0, Resi, mkm1)
+        movyx_st(Resi, Mebx, AJ1)
+#endif /* S <= RT_ELEMENT */
+        mkcpx_rx(Xmm0, Redi, mkc1)
+        movyx_st(Redi, Medx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        cgtps_ld(Xmm0, Mecx, AJ0)
+#if (S <= RT_ELEMENT)
+        mkmpx_rx(Xmm0, Resi, mkm2)
+        movyx_st(Resi, Mebx, AJ2)
+#endif /* S <= RT_ELEMENT */
+        mkcpx_rx(Xmm0, Redi, mkc2)
+        movyx_st(Redi, Medx, AJ2)
+
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ EQ_x, msk_end)
+
+        jmpxx_lb(msk_beg)
+
+    LBL(msk_end)
+
+        TILE_CHK(tile47)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_ISO1)
+        TILE_ADV(inf_ISO2)
+        TILE_END(tile47)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test47(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+
+        RT_LOGI("C bits[%d] = %" PR_L "X, count[%d] = %" PR_L "d\n",
+                j, ico1[j], j, ico2[j]);
+
+        RT_LOGI("S bits[%d] = %" PR_L "X, count[%d] = %" PR_L "d\n",
+                j, iso1[j], j, iso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 47 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 48   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 48
+
+/*
+ * Int8 GEMM micro-kernel (quantized inference) on dot-product instructions,
+ * C (GM_M x N) = A (GM_M x 4*GM_K) * B (4*GM_K x N) over signed bytes,
+ * where N is the number of 32-bit lanes in a SIMD register. Both matrices
+ * are taken from the bytes of harr, C is stored row by row into icox/isox.
+ * S-side packs B into byte-quads per column and broadcasts byte-quads of A
+ * (VNNI layout) in C code, the ASM loop then runs GM_M dpbon_ld per B load.
+ * Use -m to benchmark, GOP/s count both multiplies and adds of the kernel.
+ */
+#define GA(b, m, k)         ((rt_si32)(signed char)b[((m)*GM_K*4+(k)) % nb])
+#define GB(b, k, n)         ((rt_si32)(signed char)b[((k)*7+(n)*13+5) % nb])
+
+rt_void c_test48(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, k, m, n, nb = info->size * sizeof(rt_elem);
+
+    rt_ui08 *b = (rt_ui08 *)info->har0;
+    rt_ui32 *wco1 = (rt_ui32 *)info->ico1;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        for (m = 0; m < GM_M; m++)
+        {
+            for (n = 0; n < Q*4; n++)
+            {
+                rt_ui32 c = 0;
+
+                for (k = 0; k < GM_K*4; k++)
+                {
+                    c += (rt_ui32)(GA(b, m, k) * GB(b, k, n));
+                }
+                wco1[m*Q*4 + n] = c;
+            }
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test48(rt_SIMD_INFOX *info)
+{
+    rt_si32 k, m, n, nb = info->size * sizeof(rt_elem);
+
+    rt_ui08 *b = (rt_ui08 *)info->har0;
+    rt_ui32 *p = (rt_ui32 *)(((rt_full)info->gemm + MASK) & ~MASK);
+
+    for (k = 0; k < GM_K; k++, p += (GM_M+1)*Q*4)
+    {
+        for (n = 0; n < Q*4; n++)
+        {
+            p[n] = (rt_ui32)(rt_ui08)GB(b, k*4+0, n) <<  0
+                 | (rt_ui32)(rt_ui08)GB(b, k*4+1, n) <<  8
+                 | (rt_ui32)(rt_ui08)GB(b, k*4+2, n) << 16
+                 | (rt_ui32)(rt_ui08)GB(b, k*4+3, n) << 24;
+
+            for (m = 0; m < GM_M; m++)
+            {
+                p[(m+1)*Q*4 + n] = (rt_ui32)(rt_ui08)GA(b, m, k*4+0) <<  0
+                                 | (rt_ui32)(rt_ui08)GA(b, m, k*4+1) <<  8
+                                 | (rt_ui32)(rt_ui08)GA(b, m, k*4+2) << 16
+                                 | (rt_ui32)(rt_ui08)GA(b, m, k*4+3) << 24;
+            }
+        }
+    }
+
+    info->gmmp = (rt_pntr)(((rt_full)info->gemm + MASK) & ~MASK);
+
+    ASM_ENTER(info)
+
+        TILE_BEG(tile48)
+
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(gmm_beg)
+
+        movxx_ld(Resi, Mebp, inf_GMMP)
+        movwx_ri(Redi, IB(GM_K))
+        xorox_rr(Xmm0, Xmm0)
+        xorox_rr(Xmm1, Xmm1)
+        xorox_rr(Xmm2, Xmm2)
+
+    LBL(gmm_dot)
+
+        movox_ld(Xmm3, Mesi, DP(Q*0x000))
+        dpbon_ld(Xmm0, Xmm3, Mesi, DP(Q*0x010))
+        dpbon_ld(Xmm1, Xmm3, Mesi, DP(Q*0x020))
+        dpbon_ld(Xmm2, Xmm3, Mesi, DP(Q*0x030))
+
+        addxx_ri(Resi, IH(Q*0x040))
+        subwx_ri(Redi, IB(1))
+        cmjwx_rz(Redi,
+        /* if */ NZ_x, gmm_dot)
+
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movox_st(Xmm0, Medx, AJ0)
+        movox_st(Xmm1, Medx, AJ1)
+        movox_st(Xmm2, Medx, AJ2)
+
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ EQ_x, gmm_end)
+
+        jmpxx_lb(gmm_beg)
+
+    LBL(gmm_end)
+
+        TILE_CHK(tile48)
+        TILE_ADV(inf_ISO1)
+        TILE_END(tile48)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test48(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = GM_M*Q*4;
+
+    rt_ui32 *wco1 = (rt_ui32 *)info->ico1;
+    rt_ui32 *wso1 = (rt_ui32 *)info->iso1;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(wco1[j], wso1[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("C gemm[%d][%d] = %08X\n", j / (Q*4), j % (Q*4), wco1[j]);
+
+        RT_LOGI("S gemm[%d][%d] = %08X\n", j / (Q*4), j % (Q*4), wso1[j]);
+    }
+}
+
+#undef GA
+#undef GB
+
+#endif /* RUN_LEVEL 48 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 49   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 49
+
+/*
+ * Polynomial of subtest 41 below is written with virtual registers (Vmm*),
+ * which are allocated by simd_vreg.awk into 30, 15 or 8 SIMD registers
+ * depending on RT_REGS, its 18 live ranges spill on targets with RT_REGS < 32.
+ * It is only built by "vreg" target (-DRT_VREG_TEST) from the rewritten source.
+ */
+rt_void c_test49(rt_SIMD_INFOX *info)
+{
+    c_test41(info);
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test49(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        TILE_BEG(tile49)
+
+        movpx_ld(Vmm1, Mebp, inf_GPC01)
+        movpx_ld(Vmm16, Mebp, inf_GPC01)
+        movpx_ld(Vmm17, Mebp, inf_GPC02)
+        movpx_ld(Vmm18, Mebp, inf_GPC03)
+        movpx_ld(Vmm19, Mebp, inf_GPC01)
+        movpx_ld(Vmm20, Mebp, inf_GPC02)
+        movpx_ld(Vmm21, Mebp, inf_GPC03)
+        movpx_ld(Vmm22, Mebp, inf_GPC01)
+        movpx_ld(Vmm23, Mebp, inf_GPC02)
+        movpx_ld(Vmm24, Mebp, inf_GPC03)
+        movpx_ld(Vmm25, Mebp, inf_GPC01)
+        movpx_ld(Vmm26, Mebp, inf_GPC02)
+        movpx_ld(Vmm27, Mebp, inf_GPC03)
+        movpx_ld(Vmm28, Mebp, inf_GPC01)
+        movpx_ld(Vmm29, Mebp, inf_GPC02)
+
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(vrg_beg)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movwx_ri(Rebx, IB(3))
+
+    LBL(vrg_vec)
+
+        movpx_ld(Vmm0, Mecx, AJ0)
+        movpx_rr(Vmm2, Vmm0)
+        addps_rr(Vmm2, Vmm1)
+        divps_rr(Vmm0, Vmm2)
+        movpx_rr(Vmm3, Vmm16)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm17)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm18)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm19)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm20)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm21)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm22)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm23)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm24)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm25)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm26)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm27)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm28)
+        mulps_rr(Vmm3, Vmm0)
+        addps_rr(Vmm3, Vmm29)
+        movpx_st(Vmm3, Medx, AJ0)
+
+        addxx_ri(Recx, IM(Q*16))
+        addxx_ri(Redx, IM(Q*16))
+
+        arjwx_ri(Rebx, IB(1),
+        sub_x,   NZ_x, vrg_vec)
+
+        arjwx_mi(Mebp, inf_LOC, IB(1),
+        sub_x,   NZ_x, vrg_beg)
+
+        TILE_CHK(tile49)
+        TILE_ADV(inf_FAR0)
+        TILE_ADV(inf_FSO1)
+        TILE_END(tile49)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test49(rt_SIMD_INFOX *info)
+{
+    p_test41(info);
+}
+
+#endif /* RUN_LEVEL 49 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 50   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 50
+
+/*
+ * Shading kernel (masked if/else nested under partial masks) is written
+ * in SPMD form in simd_test.spmd, which simd_spmd.awk compiles into UniSIMD
+ * macros (s_spmd_shade) with a scalar C tail, checked against hand-written C.
+ * It is only built by "spmd" target (-DRT_SPMD_TEST) from the generated source.
+ */
+rt_void c_test50(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_real x = far0[j];
+            rt_real t = x / (x + 1.0f);
+            rt_real r = RT_MIN(x * 0.001f, 3.0f);
+
+            if (x < 100.0f)
+            {
+                r = RT_SQRT(x) * t - (x > 1.0f ? 0.5f : 0.0f);
+            }
+
+            fco1[j] = r;
+            fco2[j] = RT_MAX(t, RT_FABS(x - 10.0f));
+        }
+    }
+}
+
+/*
+ * Generated struct (constants, uniforms, array pointers) is kept within info
+ * for each thread, it shares the SIMD reg-file (spill slots) with info.
+ */
+rt_void s_test50(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    rt_SIMD_SPMD_shade *spm0 = (rt_SIMD_SPMD_shade *)
+                                    (((rt_full)info->spmd + MASK) & ~MASK);
+    rt_SIMD_REGS *reg0 = (rt_SIMD_REGS *)(rt_word)info->regs;
+
+    ASM_INIT(spm0, reg0)
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        spmd_shade(spm0, info->size, info->far0, info->fso1, info->fso2,
+                   100.0f);
+    }
+
+    ASM_DONE(spm0)
+}
+
+rt_void p_test50(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C shade(S), max(T, |S - 10|) = [%e, %e]\n",
+                fco1[j], fco2[j]);
+
+        RT_LOGI("S shade(S), max(T, |S - 10|) = [%e, %e]\n",
+                fso1[j], fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 50 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 51   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 51
+
+/*
+ * Scaling kernel (divergent while loop, masked stores under if/else) is
+ * compiled from simd_test.spmd into SPMD control-flow macros (rtbase.h),
+ * lanes leave the loop after a data-dependent number of iterations (0 - 20).
+ * It is only built by "spmd" target (-DRT_SPMD_TEST) from the generated source.
+ */
+rt_void c_test51(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_real x = far0[j];
+            rt_real c = 0.0f;
+
+            for (; x > 1.0f; c += 1.0f)
+            {
+                x *= 0.5f;
+            }
+
+            fco1[j] = x;
+            fco2[j] = c > 8.0f ? c : -c;
+        }
+    }
+}
+
+rt_void s_test51(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    rt_SIMD_SPMD_scale *spm0 = (rt_SIMD_SPMD_scale *)
+                                    (((rt_full)info->spmd + MASK) & ~MASK);
+    rt_SIMD_REGS *reg0 = (rt_SIMD_REGS *)(rt_word)info->regs;
+
+    ASM_INIT(spm0, reg0)
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        spmd_scale(spm0, info->size, info->far0, info->fso1, info->fso2);
+    }
+
+    ASM_DONE(spm0)
+}
+
+rt_void p_test51(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (fco1[j] == fso1[j] && fco2[j] == fso2[j] && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C scale(S), steps(S) = [%e, %e]\n",
+                fco1[j], fco2[j]);
+
+        RT_LOGI("S scale(S), steps(S) = [%e, %e]\n",
+                fso1[j], fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 51 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 52   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 52
+
+/*
+ * Shading kernel of subtest 50 written by hand in UniSIMD macros to compare
+ * generated code against hand-tuned code in benchmark mode (-m). Both sides
+ * of (x < k) are computed for all lanes and merged with the compare mask,
+ * (x > 1.0) adds masked -0.5 from inf_GPC02, thus no mask-jumps are taken
+ * and only Xmm0 - Xmm5 are used on all targets. C side is shared with 50.
+ * It is only built by "spmd" target (-DRT_SPMD_TEST) along with subtest 50.
+ */
+rt_void c_test52(rt_SIMD_INFOX *info)
+{
+    c_test50(info);
+}
+
+rt_void s_test52(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size, j0 = n - n % S;
+
+    rt_SIMD_SHADE *shd0 = (rt_SIMD_SHADE *)
+                                    (((rt_full)info->spmd + MASK) & ~MASK);
+    rt_SIMD_REGS *reg0 = (rt_SIMD_REGS *)(rt_word)info->regs;
+
+    ASM_INIT(shd0, reg0)
+
+    for (j = 0; j < S; j++)
+    {
+        shd0->k[j] = 100.0f;
+        shd0->c01[j] = 0.001f;
+        shd0->c10[j] = 10.0f;
+    }
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        shd0->far0 = info->far0;
+        shd0->fso1 = info->fso1;
+        shd0->fso2 = info->fso2;
+        shd0->cnt = j0 / S;
+
+        if (shd0->cnt > 0)
+        {
+            ASM_ENTER(shd0)
+
+            movxx_ld(Recx, Mebp, shd_FAR0)
+            movxx_ld(Redx, Mebp, shd_FSO1)
+            movxx_ld(Rebx, Mebp, shd_FSO2)
+
+        LBL(shd_loop)
+
+            movpx_ld(Xmm0, Mecx, AJ0)
+            movpx_rr(Xmm1, Xmm0)
+            addps_ld(Xmm1, Mebp, inf_GPC01)
+            movpx_rr(Xmm2, Xmm0)
+            divps_rr(Xmm2, Xmm1)
+
+            sqrps_rr(Xmm3, Xmm0)
+            mulps_rr(Xmm3, Xmm2)
+            movpx_rr(Xmm4, Xmm0)
+            cgtps_ld(Xmm4, Mebp, inf_GPC01)
+            andpx_ld(Xmm4, Mebp, inf_GPC02)
+            addps_rr(Xmm3, Xmm4)
+
+            movpx_rr(Xmm4, Xmm0)
+            mulps_ld(Xmm4, Mebp, shd_C01)
+            minps_ld(Xmm4, Mebp, inf_GPC03)
+
+            movpx_rr(Xmm5, Xmm0)
+            cltps_ld(Xmm5, Mebp, shd_K)
+            andpx_rr(Xmm3, Xmm5)
+            annpx_rr(Xmm5, Xmm4)
+            orrpx_rr(Xmm3, Xmm5)
+            movpx_st(Xmm3, Medx, AJ0)
+
+            subps_ld(Xmm0, Mebp, shd_C10)
+            andpx_ld(Xmm0, Mebp, inf_GPC04)
+            maxps_rr(Xmm0, Xmm2)
+            movpx_st(Xmm0, Mebx, AJ0)
+
+            addxx_ri(Recx, IM(Q*16))
+            addxx_ri(Redx, IM(Q*16))
+            addxx_ri(Rebx, IM(Q*16))
+
+            arjwx_mi(Mebp, shd_CNT, IB(1),
+            sub_x,   NZ_x, shd_loop)
+
+            ASM_LEAVE(shd0)
+        }
+
+        for (j = j0; j < n; j++)
+        {
+            rt_real x = info->far0[j];
+            rt_real t = x / (x + 1.0f);
+            rt_real r = RT_MIN(x * 0.001f, 3.0f);
+
+            if (x < 100.0f)
+            {
+                r = RT_SQRT(x) * t - (x > 1.0f ? 0.5f : 0.0f);
+            }
+
+            info->fso1[j] = r;
+            info->fso2[j] = RT_MAX(t, RT_FABS(x - 10.0f));
+        }
+    }
+
+    ASM_DONE(shd0)
+}
+
+rt_void p_test52(rt_SIMD_INFOX *info)
+{
+    p_test50(info);
+}
+
+#endif /* RUN_LEVEL 52 */
+
+/******************************************************************************/
+/*********************************   TABLES   *********************************/
+/******************************************************************************/
+
+typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+
+testXX c_test[RUN_LEVEL] =
+{
+#if RUN_LEVEL >=  1
+    c_test01,
+#endif /* RUN_LEVEL  1 */
+
+#if RUN_LEVEL >=  2
+    c_test02,
+#endif /* RUN_LEVEL  2 */
+
+#if RUN_LEVEL >=  3
+    c_test03,
+#endif /* RUN_LEVEL  3 */
+
+#if RUN_LEVEL >=  4
+    c_test04,
+#endif /* RUN_LEVEL  4 */
+
+#if RUN_LEVEL >=  5
+    c_test05,
+#endif /* RUN_LEVEL  5 */
+
+#if RUN_LEVEL >=  6
+    c_test06,
+#endif /* RUN_LEVEL  6 */
+
+#if RUN_LEVEL >=  7
+    c_test07,
+#endif /* RUN_LEVEL  7 */
+
+#if RUN_LEVEL >=  8
+    c_test08,
+#endif /* RUN_LEVEL  8 */
+
+#if RUN_LEVEL >=  9
+    c_test09,
+#endif /* RUN_LEVEL  9 */
+
+#if RUN_LEVEL >= 10
+    c_test10,
+#endif /* RUN_LEVEL 10 */
+
+#if RUN_LEVEL >= 11
+    c_test11,
+#endif /* RUN_LEVEL 11 */
+
+#if RUN_LEVEL >= 12
+    c_test12,
+#endif /* RUN_LEVEL 12 */
+
+#if RUN_LEVEL >= 13
+    c_test13,
+#endif /* RUN_LEVEL 13 */
+
+#if RUN_LEVEL >= 14
+    c_test14,
+#endif /* RUN_LEVEL 14 */
+
+#if RUN_LEVEL >= 15
+    c_test15,
+#endif /* RUN_LEVEL 15 */
+
+#if RUN_LEVEL >= 16
+    c_test16,
+#endif /* RUN_LEVEL 16 */
+
+#if RUN_LEVEL >= 17
+    c_test17,
+#endif /* RUN_LEVEL 17 */
+
+#if RUN_LEVEL >= 18
+    c_test18,
+#endif /* RUN_LEVEL 18 */
+
+#if RUN_LEVEL >= 19
+    c_test19,
+#endif /* RUN_LEVEL 19 */
+
+#if RUN_LEVEL >= 20
+    c_test20,
+#endif /* RUN_LEVEL 20 */
+
+#if RUN_LEVEL >= 21
+    c_test21,
+#endif /* RUN_LEVEL 21 */
+
+#if RUN_LEVEL >= 22
+    c_test22,
+#endif /* RUN_LEVEL 22 */
+
+#if RUN_LEVEL >= 23
+    c_test23,
+#endif /* RUN_LEVEL 23 */
+
+#if RUN_LEVEL >= 24
+    c_test24,
+#endif /* RUN_LEVEL 24 */
+
+#if RUN_LEVEL >= 25
+    c_test25,
+#endif /* RUN_LEVEL 25 */
+
+#if RUN_LEVEL >= 26
+    c_test26,
+#endif /* RUN_LEVEL 26 */
+
+#if RUN_LEVEL >= 27
+    c_test27,
+#endif /* RUN_LEVEL 27 */
+
+#if RUN_LEVEL >= 28
+    c_test28,
+#endif /* RUN_LEVEL 28 */
+
+#if RUN_LEVEL >= 29
+    c_test29,
+#endif /* RUN_LEVEL 29 */
+
+#if RUN_LEVEL >= 30
+    c_test30,
+#endif /* RUN_LEVEL 30 */
+
+#if RUN_LEVEL >= 31
+    c_test31,
+#endif /* RUN_LEVEL 31 */
+
+#if RUN_LEVEL >= 32
+    c_test32,
+#endif /* RUN_LEVEL 32 */
+
+#if RUN_LEVEL >= 33
+    c_test33,
+#endif /* RUN_LEVEL 33 */
+
+#if RUN_LEVEL >= 34
+    c_test34,
+#endif /* RUN_LEVEL 34 */
+
+#if RUN_LEVEL >= 35
+    c_test35,
+#endif /* RUN_LEVEL 35 */
+
+#if RUN_LEVEL >= 36
+    c_test36,
+#endif /* RUN_LEVEL 36 */
+
+#if RUN_LEVEL >= 37
+    c_test37,
+#endif /* RUN_LEVEL 37 */
+
+#if RUN_LEVEL >= 38
+    c_test38,
+#endif /* RUN_LEVEL 38 */
+
+#if RUN_LEVEL >= 39
+    c_test39,
+#endif /* RUN_LEVEL 39 */
+
+#if RUN_LEVEL >= 40
+    c_test40,
+#endif /* RUN_LEVEL 40 */
+
+#if RUN_LEVEL >= 41
+    c_test41,
+#endif /* RUN_LEVEL 41 */
+
+#if RUN_LEVEL >= 42
+    c_test42,
+#endif /* RUN_LEVEL 42 */
+
+#if RUN_LEVEL >= 43
+    c_test43,
+#endif /* RUN_LEVEL 43 */
+
+#if RUN_LEVEL >= 44
+    c_test44,
+#endif /* RUN_LEVEL 44 */
+
+#if RUN_LEVEL >= 45
+    c_test45,
+#endif /* RUN_LEVEL 45 */
+
+#if RUN_LEVEL >= 46
+    c_test46,
+#endif /* RUN_LEVEL 46 */
+
+#if RUN_LEVEL >= 47
+    c_test47,
+#endif /* RUN_LEVEL 47 */
+
+#if RUN_LEVEL >= 48
+    c_test48,
+#endif /* RUN_LEVEL 48 */
+
+#if RUN_LEVEL >= 49
+    c_test49,
+#endif /* RUN_LEVEL 49 */
+
+#if RUN_LEVEL >= 50
+    c_test50,
+#endif /* RUN_LEVEL 50 */
+
+#if RUN_LEVEL >= 51
+    c_test51,
+#endif /* RUN_LEVEL 51 */
+
+#if RUN_LEVEL >= 52
+    c_test52,
+#endif /* RUN_LEVEL 52 */
+};
+
+testXX s_test[RUN_LEVEL] =
+{
+#if RUN_LEVEL >=  1
+    s_test01,
+#endif /* RUN_LEVEL  1 */
+
+#if RUN_LEVEL >=  2
+    s_test02,
+#endif /* RUN_LEVEL  2 */
+
+#if RUN_LEVEL >=  3
+    s_test03,
+#endif /* RUN_LEVEL  3 */
+
+#if RUN_LEVEL >=  4
+    s_test04,
+#endif /* RUN_LEVEL  4 */
+
+#if RUN_LEVEL >=  5
+    s_test05,
+#endif /* RUN_LEVEL  5 */
+
+#if RUN_LEVEL >=  6
+    s_test06,
+#endif /* RUN_LEVEL  6 */
+
+#if RUN_LEVEL >=  7
+    s_test07,
+#endif /* RUN_LEVEL  7 */
+
+#if RUN_LEVEL >=  8
+    s_test08,
+#endif /* RUN_LEVEL  8 */
+
+#if RUN_LEVEL >=  9
+    s_test09,
+#endif /* RUN_LEVEL  9 */
+
+#if RUN_LEVEL >= 10
+    s_test10,
+#endif /* RUN_LEVEL 10 */
+
+#if RUN_LEVEL >= 11
+    s_test11,
+#endif /* RUN_LEVEL 11 */
+
+#if RUN_LEVEL >= 12
+    s_test12,
+#endif /* RUN_LEVEL 12 */
+
+#if RUN_LEVEL >= 13
+    s_test13,
+#endif /* RUN_LEVEL 13 */
+
+#if RUN_LEVEL >= 14
+    s_test14,
+#endif /* RUN_LEVEL 14 */
+
+#if RUN_LEVEL >= 15
+    s_test15,
+#endif /* RUN_LEVEL 15 */
+
+#if RUN_LEVEL >= 16
+    s_test16,
+#endif /* RUN_LEVEL 16 */
+
+#if RUN_LEVEL >= 17
+    s_test17,
+#endif /* RUN_LEVEL 17 */
+
+#if RUN_LEVEL >= 18
+    s_test18,
+#endif /* RUN_LEVEL 18 */
+
+#if RUN_LEVEL >= 19
+    s_test19,
+#endif /* RUN_LEVEL 19 */
+
+#if RUN_LEVEL >= 20
+    s_test20,
+#endif /* RUN_LEVEL 20 */
+
+#if RUN_LEVEL >= 21
+    s_test21,
+#endif /* RUN_LEVEL 21 */
+
+#if RUN_LEVEL >= 22
+    s_test22,
+#endif /* RUN_LEVEL 22 */
+
+#if RUN_LEVEL >= 23
+    s_test23,
+#endif /* RUN_LEVEL 23 */
+
+#if RUN_LEVEL >= 24
+    s_test24,
+#endif /* RUN_LEVEL 24 */
+
+#if RUN_LEVEL >= 25
+    s_test25,
+#endif /* RUN_LEVEL 25 */
+
+#if RUN_LEVEL >= 26
+    s_test26,
+#endif /* RUN_LEVEL 26 */
+
+#if RUN_LEVEL >= 27
+    s_test27,
+#endif /* RUN_LEVEL 27 */
+
+#if RUN_LEVEL >= 28
+    s_test28,
+#endif /* RUN_LEVEL 28 */
+
+#if RUN_LEVEL >= 29
+    s_test29,
+#endif /* RUN_LEVEL 29 */
+
+#if RUN_LEVEL >= 30
+    s_test30,
+#endif /* RUN_LEVEL 30 */
+
+#if RUN_LEVEL >= 31
+    s_test31,
+#endif /* RUN_LEVEL 31 */
+
+#if RUN_LEVEL >= 32
+    s_test32,
+#endif /* RUN_LEVEL 32 */
+
+#if RUN_LEVEL >= 33
+    s_test33,
+#endif /* RUN_LEVEL 33 */
+
+#if RUN_LEVEL >= 34
+    s_test34,
+#endif /* RUN_LEVEL 34 */
+
+#if RUN_LEVEL >= 35
+    s_test35,
+#endif /* RUN_LEVEL 35 */
+
+#if RUN_LEVEL >= 36
+    s_test36,
+#endif /* RUN_LEVEL 36 */
+
+#if RUN_LEVEL >= 37
+    s_test37,
+#endif /* RUN_LEVEL 37 */
+
+#if RUN_LEVEL >= 38
+    s_test38,
+#endif /* RUN_LEVEL 38 */
+
+#if RUN_LEVEL >= 39
+    s_test39,
+#endif /* RUN_LEVEL 39 */
+
+#if RUN_LEVEL >= 40
+    s_test40,
+#endif /* RUN_LEVEL 40 */
+
+#if RUN_LEVEL >= 41
+    s_test41,
+#endif /* RUN_LEVEL 41 */
+
+#if RUN_LEVEL >= 42
+    s_test42,
+#endif /* RUN_LEVEL 42 */
+
+#if RUN_LEVEL >= 43
+    s_test43,
+#endif /* RUN_LEVEL 43 */
+
+#if RUN_LEVEL >= 44
+    s_test44,
+#endif /* RUN_LEVEL 44 */
+
+#if RUN_LEVEL >= 45
+    s_test45,
+#endif /* RUN_LEVEL 45 */
+
+#if RUN_LEVEL >= 46
+    s_test46,
+#endif /* RUN_LEVEL 46 */
+
+#if RUN_LEVEL >= 47
+    s_test47,
+#endif /* RUN_LEVEL 47 */
+
+#if RUN_LEVEL >= 48
+    s_test48,
+#endif /* RUN_LEVEL 48 */
+
+#if RUN_LEVEL >= 49
+    s_test49,
+#endif /* RUN_LEVEL 49 */
+
+#if RUN_LEVEL >= 50
+    s_test50,
+#endif /* RUN_LEVEL 50 */
+
+#if RUN_LEVEL >= 51
+    s_test51,
+#endif /* RUN_LEVEL 51 */
+
+#if RUN_LEVEL >= 52
+    s_test52,
+#endif /* RUN_LEVEL 52 */
+};
+
+testXX p_test[RUN_LEVEL] =
+{
+#if RUN_LEVEL >=  1
+    p_test01,
+#endif /* RUN_LEVEL  1 */
+
+#if RUN_LEVEL >=  2
+    p_test02,
+#endif /* RUN_LEVEL  2 */
+
+#if RUN_LEVEL >=  3
+    p_test03,
+#endif /* RUN_LEVEL  3 */
+
+#if RUN_LEVEL >=  4
+    p_test04,
+#endif /* RUN_LEVEL  4 */
+
+#if RUN_LEVEL >=  5
+    p_test05,
+#endif /* RUN_LEVEL  5 */
+
+#if RUN_LEVEL >=  6
+    p_test06,
+#endif /* RUN_LEVEL  6 */
+
+#if RUN_LEVEL >=  7
+    p_test07,
+#endif /* RUN_LEVEL  7 */
+
+#if RUN_LEVEL >=  8
+    p_test08,
+#endif /* RUN_LEVEL  8 */
+
+#if RUN_LEVEL >=  9
+    p_test09,
+#endif /* RUN_LEVEL  9 */
+
+#if RUN_LEVEL >= 10
+    p_test10,
+#endif /* RUN_LEVEL 10 */
+
+#if RUN_LEVEL >= 11
+    p_test11,
+#endif /* RUN_LEVEL 11 */
+
+#if RUN_LEVEL >= 12
+    p_test12,
+#endif /* RUN_LEVEL 12 */
+
+#if RUN_LEVEL >= 13
+    p_test13,
+#endif /* RUN_LEVEL 13 */
+
+#if RUN_LEVEL >= 14
+    p_test14,
+#endif /* RUN_LEVEL 14 */
+
+#if RUN_LEVEL >= 15
+    p_test15,
+#endif /* RUN_LEVEL 15 */
+
+#if RUN_LEVEL >= 16
+    p_test16,
+#endif /* RUN_LEVEL 16 */
+
+#if RUN_LEVEL >= 17
+    p_test17,
+#endif /* RUN_LEVEL 17 */
+
+#if RUN_LEVEL >= 18
+    p_test18,
+#endif /* RUN_LEVEL 18 */
+
+#if RUN_LEVEL >= 19
+    p_test19,
+#endif /* RUN_LEVEL 19 */
+
+#if RUN_LEVEL >= 20
+    p_test20,
+#endif /* RUN_LEVEL 20 */
+
+#if RUN_LEVEL >= 21
+    p_test21,
+#endif /* RUN_LEVEL 21 */
+
+#if RUN_LEVEL >= 22
+    p_test22,
+#endif /* RUN_LEVEL 22 */
+
+#if RUN_LEVEL >= 23
+    p_test23,
+#endif /* RUN_LEVEL 23 */
+
+#if RUN_LEVEL >= 24
+    p_test24,
+#endif /* RUN_LEVEL 24 */
+
+#if RUN_LEVEL >= 25
+    p_test25,
+#endif /* RUN_LEVEL 25 */
+
+#if RUN_LEVEL >= 26
+    p_test26,
+#endif /* RUN_LEVEL 26 */
+
+#if RUN_LEVEL >= 27
+    p_test27,
+#endif /* RUN_LEVEL 27 */
+
+#if RUN_LEVEL >= 28
+    p_test28,
+#endif /* RUN_LEVEL 28 */
+
+#if RUN_LEVEL >= 29
+    p_test29,
+#endif /* RUN_LEVEL 29 */
+
+#if RUN_LEVEL >= 30
+    p_test30,
+#endif /* RUN_LEVEL 30 */
+
+#if RUN_LEVEL >= 31
+    p_test31,
+#endif /* RUN_LEVEL 31 */
+
+#if RUN_LEVEL >= 32
+    p_test32,
+#endif /* RUN_LEVEL 32 */
+
+#if RUN_LEVEL >= 33
+    p_test33,
+#endif /* RUN_LEVEL 33 */
+
+#if RUN_LEVEL >= 34
+    p_test34,
+#endif /* RUN_LEVEL 34 */
+
+#if RUN_LEVEL >= 35
+    p_test35,
+#endif /* RUN_LEVEL 35 */
+
+#if RUN_LEVEL >= 36
+    p_test36,
+#endif /* RUN_LEVEL 36 */
+
+#if RUN_LEVEL >= 37
+    p_test37,
+#endif /* RUN_LEVEL 37 */
+
+#if RUN_LEVEL >= 38
+    p_test38,
+#endif /* RUN_LEVEL 38 */
+
+#if RUN_LEVEL >= 39
+    p_test39,
+#endif /* RUN_LEVEL 39 */
+
+#if RUN_LEVEL >= 40
+    p_test40,
+#endif /* RUN_LEVEL 40 */
+
+#if RUN_LEVEL >= 41
+    p_test41,
+#endif /* RUN_LEVEL 41 */
+
+#if RUN_LEVEL >= 42
+    p_test42,
+#endif /* RUN_LEVEL 42 */
+
+#if RUN_LEVEL >= 43
+    p_test43,
+#endif /* RUN_LEVEL 43 */
+
+#if RUN_LEVEL >= 44
+    p_test44,
+#endif /* RUN_LEVEL 44 */
+
+#if RUN_LEVEL >= 45
+    p_test45,
+#endif /* RUN_LEVEL 45 */
+
+#if RUN_LEVEL >= 46
+    p_test46,
+#endif /* RUN_LEVEL 46 */
+
+#if RUN_LEVEL >= 47
+    p_test47,
+#endif /* RUN_LEVEL 47 */
+
+#if RUN_LEVEL >= 48
+    p_test48,
+#endif /* RUN_LEVEL 48 */
+
+#if RUN_LEVEL >= 49
+    p_test49,
+#endif /* RUN_LEVEL 49 */
+
+#if RUN_LEVEL >= 50
+    p_test50,
+#endif /* RUN_LEVEL 50 */
+
+#if RUN_LEVEL >= 51
+    p_test51,
+#endif /* RUN_LEVEL 51 */
+
+#if RUN_LEVEL >= 52
+    p_test52,
+#endif /* RUN_LEVEL 52 */
+};
+
+/*
+ * Benchmark descriptors for each subtest: element width in bytes
+ * (0 - native rt_elem) used to derive element count from info->size,
+ * followed by floating point ops per element as counted in c_testXX.
+ */
+rt_si32 b_desc[RUN_LEVEL][2] =
+{
+#if RUN_LEVEL >=  1
+    {0,  2},
+#endif /* RUN_LEVEL  1 */
+
+#if RUN_LEVEL >=  2
+    {0,  2},
+#endif /* RUN_LEVEL  2 */
+
+#if RUN_LEVEL >=  3
+    {0,  2},
+#endif /* RUN_LEVEL  3 */
+
+#if RUN_LEVEL >=  4
+    {0,  2},
+#endif /* RUN_LEVEL  4 */
+
+#if RUN_LEVEL >=  5
+    {0,  2},
+#endif /* RUN_LEVEL  5 */
+
+#if RUN_LEVEL >=  6
+    {0,  2},
+#endif /* RUN_LEVEL  6 */
+
+#if RUN_LEVEL >=  7
+    {0,  2},
+#endif /* RUN_LEVEL  7 */
+
+#if RUN_LEVEL >=  8
+    {0,  0},
+#endif /* RUN_LEVEL  8 */
+
+#if RUN_LEVEL >=  9
+    {0,  0},
+#endif /* RUN_LEVEL  9 */
+
+#if RUN_LEVEL >= 10
+    {0,  2},
+#endif /* RUN_LEVEL 10 */
+
+#if RUN_LEVEL >= 11
+    {0,  0},
+#endif /* RUN_LEVEL 11 */
+
+#if RUN_LEVEL >= 12
+    {0,  0},
+#endif /* RUN_LEVEL 12 */
+
+#if RUN_LEVEL >= 13
+    {0,  2},
+#endif /* RUN_LEVEL 13 */
+
+#if RUN_LEVEL >= 14
+    {0,  1},
+#endif /* RUN_LEVEL 14 */
+
+#if RUN_LEVEL >= 15
+    {0,  0},
+#endif /* RUN_LEVEL 15 */
+
+#if RUN_LEVEL >= 16
+    {0,  0},
+#endif /* RUN_LEVEL 16 */
+
+#if RUN_LEVEL >= 17
+    {0,  2},
+#endif /* RUN_LEVEL 17 */
+
+#if RUN_LEVEL >= 18
+    {0,  0},
+#endif /* RUN_LEVEL 18 */
+
+#if RUN_LEVEL >= 19
+    {0,  0},
+#endif /* RUN_LEVEL 19 */
+
+#if RUN_LEVEL >= 20
+    {0,  4},
+#endif /* RUN_LEVEL 20 */
 
 #if RUN_LEVEL >= 21
-    c_test21,
+    {0,  0},
 #endif /* RUN_LEVEL 21 */
 
 #if RUN_LEVEL >= 22
-    c_test22,
+    {0,  0},
 #endif /* RUN_LEVEL 22 */
 
 #if RUN_LEVEL >= 23
-    c_test23,
+    {0,  0},
 #endif /* RUN_LEVEL 23 */
 
 #if RUN_LEVEL >= 24
-    c_test24,
+    {0,  0},
 #endif /* RUN_LEVEL 24 */
 
 #if RUN_LEVEL >= 25
-    c_test25,
+    {0,  1},
 #endif /* RUN_LEVEL 25 */
 
 #if RUN_LEVEL >= 26
-    c_test26,
+    {0,  1},
 #endif /* RUN_LEVEL 26 */
 
 #if RUN_LEVEL >= 27
-    c_test27,
+    {0,  1},
 #endif /* RUN_LEVEL 27 */
 
 #if RUN_LEVEL >= 28
-    c_test28,
+    {0,  0},
 #endif /* RUN_LEVEL 28 */
 
 #if RUN_LEVEL >= 29
-    c_test29,
+    {0,  0},
 #endif /* RUN_LEVEL 29 */
 
 #if RUN_LEVEL >= 30
-    c_test30,
+    {2,  0},
 #endif /* RUN_LEVEL 30 */
 
 #if RUN_LEVEL >= 31
-    c_test31,
+    {2,  0},
 #endif /* RUN_LEVEL 31 */
 
 #if RUN_LEVEL >= 32
-    c_test32,
+    {2,  0},
 #endif /* RUN_LEVEL 32 */
 
 #if RUN_LEVEL >= 33
-    c_test33,
+    {2,  0},
 #endif /* RUN_LEVEL 33 */
 
 #if RUN_LEVEL >= 34
-    c_test34,
+    {2,  0},
 #endif /* RUN_LEVEL 34 */
 
 #if RUN_LEVEL >= 35
-    c_test35,
+    {2,  0},
 #endif /* RUN_LEVEL 35 */
 
 #if RUN_LEVEL >= 36
-    c_test36,
+    {2,  0},
 #endif /* RUN_LEVEL 36 */
 
 #if RUN_LEVEL >= 37
-    c_test37,
+    {2,  0},
 #endif /* RUN_LEVEL 37 */
+
+#if RUN_LEVEL >= 38
+    {4,  0},
+#endif /* RUN_LEVEL 38 */
+
+#if RUN_LEVEL >= 39
+    {4,  5},
+#endif /* RUN_LEVEL 39 */
+
+#if RUN_LEVEL >= 40
+    {4,  3},
+#endif /* RUN_LEVEL 40 */
+
+#if RUN_LEVEL >= 41
+    {0, 28},
+#endif /* RUN_LEVEL 41 */
+
+#if RUN_LEVEL >= 42
+    {0,  2},
+#endif /* RUN_LEVEL 42 */
+
+#if RUN_LEVEL >= 43
+    {0,  2},
+#endif /* RUN_LEVEL 43 */
+
+#if RUN_LEVEL >= 44
+    {0,  0},
+#endif /* RUN_LEVEL 44 */
+
+#if RUN_LEVEL >= 45
+    {0,  2},
+#endif /* RUN_LEVEL 45 */
+
+#if RUN_LEVEL >= 46
+    {0,  1},
+#endif /* RUN_LEVEL 46 */
+
+#if RUN_LEVEL >= 47
+    {0,  1},
+#endif /* RUN_LEVEL 47 */
+
+#if RUN_LEVEL >= 48
+    {4, 2*4*GM_K},
+#endif /* RUN_LEVEL 48 */
+
+#if RUN_LEVEL >= 49
+    {0, 28},
+#endif /* RUN_LEVEL 49 */
+
+#if RUN_LEVEL >= 50
+    {0, 12},
+#endif /* RUN_LEVEL 50 */
+
+#if RUN_LEVEL >= 51
+    {0,  0},
+#endif /* RUN_LEVEL 51 */
+
+#if RUN_LEVEL >= 52
+    {0, 12},
+#endif /* RUN_LEVEL 52 */
 };
 
-testXX s_test[RUN_LEVEL] =
+/******************************************************************************/
+/**********************************   BENCH   *********************************/
+/******************************************************************************/
+
+/*
+ * Working-set tile holds all 15 test arrays laid out as in main's buffer,
+ * scale mode walks the kernels over consecutive copies of such a tile.
+ * Sweep mode lays out only the arrays a kernel reads or writes instead,
+ * each as a contiguous stream of ARR_SIZE-element tiles (see sweep_set).
+ */
+#define TILE_SIZE           (15*ARR_SIZE) /* in rt_elem units */
+#define TILE_SO12           0x6318 /* *so1/*so2 bits in tile array masks */
+
+/*
+ * Benchmark statistics of a single subtest over b_test repetitions.
+ * Times are in microseconds, cycles are derived from -f core clock.
+ */
+struct rt_BENCH_STAT
 {
-#if RUN_LEVEL >=  1
-    s_test01,
-#endif /* RUN_LEVEL  1 */
+    rt_fp64 med;    /* median time of repetitions (or threads) */
+    rt_fp64 min;    /* minimum time of repetitions (or threads) */
+    rt_fp64 max;    /* maximum time of repetitions (or threads) */
+    rt_fp64 spr;    /* spread (max - min) in % of median */
+
+    rt_fp64 cal;    /* kernel calls per repetition */
+    rt_fp64 wss;    /* working-set size in bytes */
+    rt_fp64 elm;    /* elements processed per repetition */
+    rt_fp64 nsc;    /* nanoseconds per kernel call */
+    rt_fp64 nse;    /* nanoseconds per element */
+    rt_fp64 cpe;    /* core cycles per element */
+    rt_fp64 eps;    /* elements per second */
+    rt_fp64 gfl;    /* GFLOP/s */
+    rt_fp64 gbs;    /* GB/s over the arrays read or written */
+
+    rt_si32 thr;    /* number of threads */
+};
 
-#if RUN_LEVEL >=  2
-    s_test02,
-#endif /* RUN_LEVEL  2 */
+/*
+ * Per-thread state of the scaling runner.
+ */
+struct rt_SCALE_THRD
+{
+    testXX  test;           /* subtest to run */
+    rt_SIMD_INFOX *info;    /* thread-own aligned info (with regs) */
+    rt_elem *base;          /* thread-own tiles (aligned to SIMD) */
+    rt_si32 tile;           /* tiles in thread-own working-set */
+    rt_si32 pass;           /* passes over thread-own tiles */
+    rt_time tbeg;           /* thread-own start time in microseconds */
+    rt_time tend;           /* thread-own end time in microseconds */
+};
 
-#if RUN_LEVEL >=  3
-    s_test03,
-#endif /* RUN_LEVEL  3 */
+rt_si32     s_thrd      = 0;        /* scale threads to wait for at start */
+volatile rt_si32 s_wait = 0;        /* scale threads arrived at start */
+volatile rt_si32 s_lock = 0;        /* spin-lock guarding s_wait */
 
-#if RUN_LEVEL >=  4
-    s_test04,
-#endif /* RUN_LEVEL  4 */
+testXX      w_test      = RT_NULL;     /* sweep subtest (walked over tiles) */
+rt_elem    *w_base      = RT_NULL;       /* sweep buffer (aligned to SIMD) */
+rt_si32     w_tile      = 1;           /* sweep tiles in current working-set */
+rt_si32     w_pass      = 1;           /* sweep passes over current tiles */
+rt_si32     w_mask      = 0;           /* sweep arrays read or written */
+rt_bool     w_call      = RT_FALSE;    /* sweep calls w_test once per tile */
 
-#if RUN_LEVEL >=  5
-    s_test05,
-#endif /* RUN_LEVEL  5 */
+/*
+ * Point all test arrays in (info) to (p), in the order of the tile layout.
+ */
+rt_void tile_put(rt_SIMD_INFOX *info, rt_elem **p)
+{
+    info->far0 = (rt_real *)p[0x0];
+    info->fco1 = (rt_real *)p[0x1];
+    info->fco2 = (rt_real *)p[0x2];
+    info->fso1 = (rt_real *)p[0x3];
+    info->fso2 = (rt_real *)p[0x4];
+
+    info->iar0 = p[0x5];
+    info->ico1 = p[0x6];
+    info->ico2 = p[0x7];
+    info->iso1 = p[0x8];
+    info->iso2 = p[0x9];
+
+    info->har0 = (rt_half *)p[0xA];
+    info->hco1 = (rt_half *)p[0xB];
+    info->hco2 = (rt_half *)p[0xC];
+    info->hso1 = (rt_half *)p[0xD];
+    info->hso2 = (rt_half *)p[0xE];
+}
 
-#if RUN_LEVEL >=  6
-    s_test06,
-#endif /* RUN_LEVEL  6 */
+/*
+ * Get all test arrays from (info) into (p), in the order of the tile layout.
+ */
+rt_void tile_get(rt_SIMD_INFOX *info, rt_elem **p)
+{
+    p[0x0] = (rt_elem *)info->far0;
+    p[0x1] = (rt_elem *)info->fco1;
+    p[0x2] = (rt_elem *)info->fco2;
+    p[0x3] = (rt_elem *)info->fso1;
+    p[0x4] = (rt_elem *)info->fso2;
+
+    p[0x5] = info->iar0;
+    p[0x6] = info->ico1;
+    p[0x7] = info->ico2;
+    p[0x8] = info->iso1;
+    p[0x9] = info->iso2;
+
+    p[0xA] = (rt_elem *)info->har0;
+    p[0xB] = (rt_elem *)info->hco1;
+    p[0xC] = (rt_elem *)info->hco2;
+    p[0xD] = (rt_elem *)info->hso1;
+    p[0xE] = (rt_elem *)info->hso2;
+}
 
-#if RUN_LEVEL >=  7
-    s_test07,
-#endif /* RUN_LEVEL  7 */
+/*
+ * Point all test arrays in (info) to the tile at (base).
+ */
+rt_void tile_set(rt_SIMD_INFOX *info, rt_elem *base)
+{
+    rt_elem *p[15];
+    rt_si32 k;
+
+    for (k = 0; k < 15; k++)
+    {
+        p[k] = base + ARR_SIZE*k;
+    }
+
+    tile_put(info, p);
+}
+
+/*
+ * Lay out (n) tiles of each array in (mask) as consecutive streams at (base),
+ * filled from the tile at (init) unless it is RT_NULL,
+ * arrays outside of (mask) are not accessed and point to (base).
+ */
+rt_void sweep_set(rt_SIMD_INFOX *info, rt_elem *base, rt_elem *init,
+                  rt_si32 n, rt_si32 mask)
+{
+    rt_elem *p[15];
+    rt_si32 j = 0, k, t;
+
+    for (k = 0; k < 15; k++)
+    {
+        p[k] = base;
+
+        if ((mask >> k & 1) == 0)
+        {
+            continue;
+        }
+
+        p[k] = base + (rt_size)ARR_SIZE*n*j++;
+
+        for (t = 0; init != RT_NULL && t < n; t++)
+        {
+            memcpy(p[k] + ARR_SIZE*t, init + ARR_SIZE*k,
+                                      ARR_SIZE * sizeof(rt_elem));
+        }
+    }
+
+    tile_put(info, p);
+}
+
+/*
+ * Return bytes read or written by one tile of arrays in (mask).
+ */
+rt_si32 sweep_size(rt_si32 mask)
+{
+    rt_si32 k, n = 0;
+
+    for (k = 0; k < 15; k++)
+    {
+        n += mask >> k & 1;
+    }
+
+    return n * ARR_SIZE * sizeof(rt_elem);
+}
+
+/*
+ * Return the mask of arrays (s_testXX) kernel (test) reads or writes,
+ * as moved by its TILE_ADV list over 2 tiles laid out at (base) from (init),
+ * 0 if the kernel has no tile loop. Test arrays in (info) are left at (base).
+ */
+rt_si32 sweep_mask(testXX test, rt_SIMD_INFOX *info, rt_elem *base,
+                                                     rt_elem *init)
+{
+    rt_elem *p[15], *q[15];
+    rt_si32 k, mask = 0, cyc = info->cyc;
+
+    sweep_set(info, base, init, 2, 0x7FFF);
+    tile_get(info, p);
+
+    info->cyc  = 1;
+    info->tile = 2;
+
+    test(info);
+
+    info->cyc  = cyc;
+    info->tile = 1;
+
+    tile_get(info, q);
+
+    for (k = 0; k < 15; k++)
+    {
+        mask |= (q[k] != p[k]) << k;
+    }
+
+    return mask;
+}
+
+/*
+ * Walk w_test over w_tile tiles of arrays in w_mask laid out by sweep_set
+ * at w_base, repeat the walk w_pass times (info->cyc is expected to be 1).
+ * s_testXX walk all tiles within one ASM section (TILE_BEG/TILE_END loop),
+ * c_testXX (w_call) are called once per tile.
+ */
+rt_void sweep_run(rt_SIMD_INFOX *info)
+{
+    rt_elem *p[15];
+    rt_si32 i, j, k;
+
+    for (i = 0; i < w_pass; i++)
+    {
+        sweep_set(info, w_base, RT_NULL, w_tile, w_mask);
+
+        if (!w_call)
+        {
+            info->tile = w_tile;
+
+            w_test(info);
+
+            info->tile = 1;
+
+            continue;
+        }
+
+        for (k = 0; k < w_tile; k++)
+        {
+            w_test(info);
+
+            tile_get(info, p);
+
+            for (j = 0; j < 15; j++)
+            {
+                p[j] += (w_mask >> j & 1) * ARR_SIZE;
+            }
+
+            tile_put(info, p);
+        }
+    }
+}
+
+/*
+ * Print (n) performance counters from (val) for subtest (name),
+ * derive IPC when both "cycles" and "instructions" are on the list.
+ */
+rt_void perf_out(const rt_char *name, rt_si32 n, rt_ui64 *val)
+{
+    rt_si32 k, c = -1, i = -1;
+
+    if (n == 0)
+    {
+        return;
+    }
+
+    RT_LOGI("Perf %s:", name);
+    for (k = 0; k < n; k++)
+    {
+        RT_LOGI(" %s = %" PR_Z "u%s", perf_name(k), val[k], k < n-1 ? "," : "");
+
+        c = strcmp(perf_name(k), "cycles") == 0 ? k : c;
+        i = strcmp(perf_name(k), "instructions") == 0 ? k : i;
+    }
+    if (c >= 0 && i >= 0 && val[c] > 0)
+    {
+        RT_LOGI(", IPC = %.3f", (rt_fp64)val[i] / (rt_fp64)val[c]);
+    }
+    RT_LOGI("\n");
+}
+
+#if RT_SIMD_PROFILE
+
+/*
+ * Print mask-jump site profiles from (regs) which saw any masks,
+ * active lanes are averaged over all masks and over mixed masks only.
+ */
+rt_void prof_out(const rt_char *name, rt_SIMD_REGS *regs)
+{
+    rt_si32 k, j;
+
+    for (k = 0; k < RT_SIMD_PROFILE; k++)
+    {
+        rt_SIMD_MKJPF *mkp = &regs->mkp[k];
+        rt_fp64 all = (rt_fp64)mkp->cnt[0] + mkp->cnt[1] + mkp->cnt[2];
+        rt_fp64 act = 0.0;
+
+        if (all == 0.0)
+        {
+            continue;
+        }
+
+        for (j = 0; j < RT_SIMD_WIDTH; j++)
+        {
+            act += (rt_fp64)mkp->lane[j];
+        }
+
+        rt_fp64 mix = act - (rt_fp64)mkp->cnt[1] * RT_SIMD_WIDTH;
+
+        RT_LOGI("Prof %s: site %2d: none = %u, full = %u, mixed = %u, "
+                "lanes/mask = %.2f, lanes/mixed = %.2f of %d\n", name, k,
+                mkp->cnt[0], mkp->cnt[1], mkp->cnt[2], act / all,
+                mkp->cnt[2] > 0 ? mix / mkp->cnt[2] : 0.0, RT_SIMD_WIDTH);
+    }
+
+    memset(regs->mkp, 0, sizeof(regs->mkp));
+}
+
+#else  /* RT_SIMD_PROFILE */
+
+#define prof_out(name, regs)    /* mask-jump profiling is disabled */
+
+#endif /* RT_SIMD_PROFILE */
+
+#if RT_SIMD_FPSTAT
+
+/*
+ * Print fp status flags captured from (regs) at the last ASM_LEAVE,
+ * denormal flags suggest the section could benefit from ASM_ENTER_F.
+ */
+rt_void fpst_out(const rt_char *name, rt_SIMD_REGS *regs)
+{
+    rt_ui32 f = regs->fpst[0];
+
+    RT_LOGI("Fpst %s: 0x%02X%s%s%s%s%s%s\n", name, f,
+            f & RT_FPS_INV ? " invalid" : "",
+            f & RT_FPS_DEN ? " denormal" : "",
+            f & RT_FPS_DVZ ? " div-zero" : "",
+            f & RT_FPS_OVF ? " overflow" : "",
+            f & RT_FPS_UNF ? " underflow" : "",
+            f & RT_FPS_INX ? " inexact" : "");
+
+    regs->fpst[0] = 0;
+}
+
+#else  /* RT_SIMD_FPSTAT */
+
+#define fpst_out(name, regs)    /* fp status capture is disabled */
+
+#endif /* RT_SIMD_FPSTAT */
+
+/*
+ * Compare time samples for qsort.
+ */
+rt_si32 bench_cmp(const rt_void *a, const rt_void *b)
+{
+    rt_time ta = *(const rt_time *)a;
+    rt_time tb = *(const rt_time *)b;
+    return ta < tb ? -1 : ta > tb ? +1 : 0;
+}
+
+/*
+ * Run subtest (l) max(b_test, 1) times and gather statistics into (st),
+ * (calls) is the number of kernel tiles run by a single (test) run,
+ * (bytes) is read or written by one of them, (wss) is the working-set size.
+ */
+rt_void bench_run(testXX test, rt_SIMD_INFOX *info, rt_si32 l,
+                  rt_fp64 calls, rt_fp64 bytes, rt_fp64 wss, rt_time *tm,
+                  rt_BENCH_STAT *st)
+{
+    rt_si32 r, n = b_test > 0 ? b_test : 1;
+    rt_time time1 = 0;
+
+    for (r = 0; r < n; r++)
+    {
+        time1 = get_usec();
+
+        test(info);
+
+        tm[r] = get_usec() - time1;
+    }
+
+    qsort(tm, n, sizeof(rt_time), bench_cmp);
+
+    st->med = n % 2 ? (rt_fp64)tm[n/2] : (tm[n/2-1] + tm[n/2]) / 2.0;
+    st->min = (rt_fp64)tm[0];
+    st->max = (rt_fp64)tm[n-1];
+    st->spr = st->med > 0.0 ? 100.0 * (st->max - st->min) / st->med : 0.0;
+
+    st->cal = calls;
+    st->wss = wss;
+    st->elm = calls * (b_desc[l][0] == 0 ? info->size :
+              (info->size * sizeof(rt_elem)) / b_desc[l][0]);
+
+    st->thr = 1;
+
+    st->nsc = st->nse = st->cpe = st->eps = st->gfl = st->gbs = 0.0;
+
+    /* median below timer resolution (1 us) leaves the rates at 0,
+     * bench_out reports them as n/a and asks to raise -c */
+    if (st->med <= 0.0)
+    {
+        return;
+    }
+
+    rt_fp64 t = st->med;
+
+    st->nsc = t * 1000.0 / st->cal;
+    st->nse = t * 1000.0 / st->elm;
+    st->cpe = t * f_core / st->elm;
+    st->eps = st->elm / t * 1000000.0;
+    st->gfl = st->elm * b_desc[l][1] / t / 1000.0;
+    st->gbs = st->cal * bytes / t / 1000.0;
+}
+
+/*
+ * Wait until all (s_thrd) threads arrive at the start barrier, then run (th)
+ * subtest over thread-own tiles on the calling thread and record its time.
+ */
+rt_void scale_thrd(rt_pntr arg)
+{
+    rt_SCALE_THRD *th = (rt_SCALE_THRD *)arg;
+    rt_si32 i, k;
+
+    RT_POOL_LOCK(s_lock);
+    s_wait++;
+    RT_POOL_FREE(s_lock);
+
+    while (s_wait < s_thrd)
+    {
+        RT_POOL_PAUSE(); /* pinned threads spin to start without delay */
+    }
+
+    th->tbeg = get_usec();
+
+    for (i = 0; i < th->pass; i++)
+    {
+        for (k = 0; k < th->tile; k++)
+        {
+            tile_set(th->info, th->base + TILE_SIZE*k);
+
+            th->test(th->info);
+        }
+    }
+
+    th->tend = get_usec();
+}
+
+/*
+ * Run subtest (l) on (n) threads (each with its own info, regs and tiles)
+ * pinned to consecutive cores and gather aggregate statistics into (st),
+ * threads are released together from a start barrier to overlap in time,
+ * median/min/max are taken from thread times, rates from the time span
+ * between the first thread start and the last thread end (which leaves
+ * out thread creation and joining).
+ */
+rt_void scale_run(testXX test, rt_SCALE_THRD *th, rt_si32 l, rt_si32 n,
+                  rt_pntr *hd, rt_time *tm, rt_BENCH_STAT *st)
+{
+    rt_si32 k, c = sys_cores();
+
+    s_wait = 0;
+    s_thrd = n;
+
+    for (k = 0; k < n; k++)
+    {
+        th[k].test = test;
+        hd[k] = thread_init(k % c, scale_thrd, &th[k]);
+    }
 
-#if RUN_LEVEL >=  8
-    s_test08,
-#endif /* RUN_LEVEL  8 */
+    for (k = 0; k < n; k++)
+    {
+        thread_join(hd[k]);
+    }
 
-#if RUN_LEVEL >=  9
-    s_test09,
-#endif /* RUN_LEVEL  9 */
+    rt_time tbeg = th[0].tbeg;
+    rt_time tend = th[0].tend;
 
-#if RUN_LEVEL >= 10
-    s_test10,
-#endif /* RUN_LEVEL 10 */
+    for (k = 0; k < n; k++)
+    {
+        tm[k] = th[k].tend - th[k].tbeg;
+        tbeg = RT_MIN(tbeg, th[k].tbeg);
+        tend = RT_MAX(tend, th[k].tend);
+    }
 
-#if RUN_LEVEL >= 11
-    s_test11,
-#endif /* RUN_LEVEL 11 */
+    rt_fp64 t = (rt_fp64)(tend - tbeg);
 
-#if RUN_LEVEL >= 12
-    s_test12,
-#endif /* RUN_LEVEL 12 */
+    qsort(tm, n, sizeof(rt_time), bench_cmp);
 
-#if RUN_LEVEL >= 13
-    s_test13,
-#endif /* RUN_LEVEL 13 */
+    st->med = n % 2 ? (rt_fp64)tm[n/2] : (tm[n/2-1] + tm[n/2]) / 2.0;
+    st->min = (rt_fp64)tm[0];
+    st->max = (rt_fp64)tm[n-1];
+    st->spr = st->med > 0.0 ? 100.0 * (st->max - st->min) / st->med : 0.0;
 
-#if RUN_LEVEL >= 14
-    s_test14,
-#endif /* RUN_LEVEL 14 */
+    st->cal = (rt_fp64)n * th[0].tile * th[0].pass * th[0].info->cyc;
+    st->wss = (rt_fp64)n * th[0].tile * TILE_SIZE * sizeof(rt_elem);
+    st->elm = st->cal * (b_desc[l][0] == 0 ? th[0].info->size :
+              (th[0].info->size * sizeof(rt_elem)) / b_desc[l][0]);
 
-#if RUN_LEVEL >= 15
-    s_test15,
-#endif /* RUN_LEVEL 15 */
+    st->thr = n;
 
-#if RUN_LEVEL >= 16
-    s_test16,
-#endif /* RUN_LEVEL 16 */
+    st->nsc = st->nse = st->cpe = st->eps = st->gfl = st->gbs = 0.0;
 
-#if RUN_LEVEL >= 17
-    s_test17,
-#endif /* RUN_LEVEL 17 */
+    /* span below timer resolution (1 us) leaves the rates at 0,
+     * bench_out reports them as n/a and asks to raise -c */
+    if (t <= 0.0)
+    {
+        return;
+    }
 
-#if RUN_LEVEL >= 18
-    s_test18,
-#endif /* RUN_LEVEL 18 */
+    st->nsc = t * 1000.0 / st->cal;
+    st->nse = t * 1000.0 / st->elm;
+    st->cpe = t * f_core / st->elm;
+    st->eps = st->elm / t * 1000000.0;
+    st->gfl = st->elm * b_desc[l][1] / t / 1000.0;
+    st->gbs = st->cal * TILE_SIZE * sizeof(rt_elem) / t / 1000.0;
+}
 
-#if RUN_LEVEL >= 19
-    s_test19,
-#endif /* RUN_LEVEL 19 */
+/*
+ * Source, destination and cost arrays of the thread pool check.
+ */
+struct rt_POOL_TEST
+{
+    rt_real *src;           /* source array (aligned to SIMD) */
+    rt_real *dst;           /* destination array (aligned to SIMD) */
+    rt_elem *rep;           /* repeat count per vector (cost), >= 1 */
+};
 
-#if RUN_LEVEL >= 20
-    s_test20,
-#endif /* RUN_LEVEL 20 */
+/*
+ * Compute dst = (src + 1.0) * src over a chunk of (count) elements at (index),
+ * full vectors in ASM (each repeated as per its cost), the remainder
+ * (tail of the last chunk) in C.
+ */
+rt_void pool_kern(rt_SIMD_INFO *inf, rt_pntr data, rt_size index,
+                  rt_size count)
+{
+    rt_SIMD_INFOX *info = (rt_SIMD_INFOX *)inf;
+    rt_POOL_TEST *pt = (rt_POOL_TEST *)data;
+    rt_size j, n = count / S * S;
 
-#if RUN_LEVEL >= 21
-    s_test21,
-#endif /* RUN_LEVEL 21 */
+    info->far0 = pt->src + index;
+    info->fso1 = pt->dst + index;
+    info->iar0 = pt->rep + index / S;
+    info->size = (rt_si32)(n / S);
 
-#if RUN_LEVEL >= 22
-    s_test22,
-#endif /* RUN_LEVEL 22 */
+    ASM_ENTER(info)
 
-#if RUN_LEVEL >= 23
-    s_test23,
-#endif /* RUN_LEVEL 23 */
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_IAR0)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+        cmjwx_rz(Redi,
+        /* if */ EQ_x, pol_end)
 
-#if RUN_LEVEL >= 24
-    s_test24,
-#endif /* RUN_LEVEL 24 */
+    LBL(pol_beg)
 
-#if RUN_LEVEL >= 25
-    s_test25,
-#endif /* RUN_LEVEL 25 */
+        movyx_ld(Resi, Mebx, DP(0))
+        movpx_ld(Xmm0, Mecx, AJ0)
 
-#if RUN_LEVEL >= 26
-    s_test26,
-#endif /* RUN_LEVEL 26 */
+    LBL(pol_rep)
 
-#if RUN_LEVEL >= 27
-    s_test27,
-#endif /* RUN_LEVEL 27 */
+        movpx_rr(Xmm1, Xmm0)
+        addps_ld(Xmm1, Mebp, inf_GPC01)
+        mulps_rr(Xmm1, Xmm0)
+        subyx_ri(Resi, IB(1))
+        cmjyx_rz(Resi,
+        /* if */ NE_x, pol_rep)
 
-#if RUN_LEVEL >= 28
-    s_test28,
-#endif /* RUN_LEVEL 28 */
+        movpx_st(Xmm1, Medx, AJ0)
 
-#if RUN_LEVEL >= 29
-    s_test29,
-#endif /* RUN_LEVEL 29 */
+        addxx_ri(Recx, IM(Q*16))
+        addxx_ri(Redx, IM(Q*16))
+        addxx_ri(Rebx, IB(4*L))
+        subwx_ri(Redi, IB(1))
+        cmjwx_rz(Redi,
+        /* if */ NE_x, pol_beg)
 
-#if RUN_LEVEL >= 30
-    s_test30,
-#endif /* RUN_LEVEL 30 */
+    LBL(pol_end)
 
-#if RUN_LEVEL >= 31
-    s_test31,
-#endif /* RUN_LEVEL 31 */
+    ASM_LEAVE(info)
 
-#if RUN_LEVEL >= 32
-    s_test32,
-#endif /* RUN_LEVEL 32 */
+    for (j = n; j < count; j++)
+    {
+        info->fso1[j] = (info->far0[j] + (rt_real)1.0) * info->far0[j];
+    }
+}
 
-#if RUN_LEVEL >= 33
-    s_test33,
-#endif /* RUN_LEVEL 33 */
+/*
+ * Run the check over (num) elements on (pool) in chunks of (grain)
+ * with static split (batch = 0) or work-stealing in batches of chunks,
+ * compare results with C, return number of mismatching elements
+ * (plus number of workers whose info lost the mark set at pool creation).
+ */
+rt_si32 pool_run(rt_ThreadPool *pool, rt_POOL_TEST *pt, rt_size num,
+                 rt_size grain, rt_size batch)
+{
+    rt_size j;
+    rt_si32 k, e = 0;
 
-#if RUN_LEVEL >= 34
-    s_test34,
-#endif /* RUN_LEVEL 34 */
+    memset(pt->dst, 0, num * sizeof(rt_real));
 
-#if RUN_LEVEL >= 35
-    s_test35,
-#endif /* RUN_LEVEL 35 */
+    if (batch == 0)
+    {
+        pool->run(pool_kern, pt, num, grain);
+    }
+    else
+    {
+        pool->run_steal(pool_kern, pt, num, grain, batch);
+    }
 
-#if RUN_LEVEL >= 36
-    s_test36,
-#endif /* RUN_LEVEL 36 */
+    for (j = 0; j < num; j++)
+    {
+        e += pt->dst[j] != (pt->src[j] + (rt_real)1.0) * pt->src[j];
+    }
 
-#if RUN_LEVEL >= 37
-    s_test37,
-#endif /* RUN_LEVEL 37 */
-};
+    for (k = 0; k < pool->get_thnum(); k++)
+    {
+        e += ((rt_SIMD_INFOX *)pool->get_info(k))->cyc != k + 1;
+    }
 
-testXX p_test[RUN_LEVEL] =
+    return e;
+}
+
+/*
+ * Time (n) runs of the check with static split (batch = 0)
+ * or work-stealing, return minimal wall time in microseconds
+ * (time of the slowest worker, as run returns when all are done).
+ */
+rt_time pool_time(rt_ThreadPool *pool, rt_POOL_TEST *pt, rt_size num,
+                  rt_size grain, rt_size batch, rt_si32 n, rt_si32 *err)
 {
-#if RUN_LEVEL >=  1
-    p_test01,
-#endif /* RUN_LEVEL  1 */
+    rt_time t, tmin = 0;
+    rt_si32 k;
 
-#if RUN_LEVEL >=  2
-    p_test02,
-#endif /* RUN_LEVEL  2 */
+    for (k = 0; k < n; k++)
+    {
+        t = get_usec();
 
-#if RUN_LEVEL >=  3
-    p_test03,
-#endif /* RUN_LEVEL  3 */
+        *err = pool_run(pool, pt, num, grain, batch);
 
-#if RUN_LEVEL >=  4
-    p_test04,
-#endif /* RUN_LEVEL  4 */
+        t = get_usec() - t;
+        tmin = k == 0 ? t : RT_MIN(tmin, t);
+    }
 
-#if RUN_LEVEL >=  5
-    p_test05,
-#endif /* RUN_LEVEL  5 */
+    return tmin;
+}
 
-#if RUN_LEVEL >=  6
-    p_test06,
-#endif /* RUN_LEVEL  6 */
+/*
+ * Print subtest (l) statistics to the log and output file (if open),
+ * (mode) is "bench" for fixed-size runs, "sweep" for tile walks,
+ * "scale" for thread scaling and "micro" for per-instruction kernels.
+ */
+rt_void bench_out(FILE *fp, rt_bool json, rt_si32 l, const rt_char *mode,
+                  const rt_char *name, const rt_char *simd, rt_BENCH_STAT *st)
+{
+    if (st->eps == 0.0)
+    {
+        RT_LOGI("Warning %s %s: median = %.1f us is below timer resolution, "
+                "rates n/a (written as 0), raise %s\n", mode, name, st->med,
+                strcmp(mode, "micro") == 0 ? "-u" : "-c");
+    }
+    else
+    if (strcmp(mode, "micro") == 0)
+    {
+        RT_LOGI("Micro %-9s: %8.3f ns/op, %7.2f cyc/op, %9.3f Mop/s, "
+                "spread = %.1f%%\n", name, st->nse, st->cpe,
+                st->eps / 1000000.0, st->spr);
+    }
+    else
+    if (strcmp(mode, "scale") == 0)
+    {
+        RT_LOGI("Scale %s: threads = %2d, %9.3f Melem/s total, %9.3f Melem/s "
+                "per thread, spread = %.1f%%\n", name, st->thr,
+                st->eps / 1000000.0, st->eps / 1000000.0 / st->thr, st->spr);
+    }
+    else
+    if (strcmp(mode, "sweep") == 0)
+    {
+        RT_LOGI("Sweep %s: wss = %10.1f KB, %9.1f ns/tile, %8.3f ns/elem, "
+                "%8.3f GB/s, spread = %.1f%%\n", name, st->wss / 1024.0,
+                st->nsc, st->nse, st->gbs, st->spr);
+    }
+    else
+    {
+        RT_LOGI("Bench %s: median = %.1f us, min = %.1f us, max = %.1f us, "
+                "spread = %.1f%%\n", name, st->med, st->min, st->max, st->spr);
 
-#if RUN_LEVEL >=  7
-    p_test07,
-#endif /* RUN_LEVEL  7 */
+        RT_LOGI("Bench %s: %.3f ns/elem, %.3f cyc/elem, %.3f Melem/s, "
+                "%.3f GFLOP/s\n", name, st->nse, st->cpe, st->eps / 1000000.0,
+                st->gfl);
+    }
 
-#if RUN_LEVEL >=  8
-    p_test08,
-#endif /* RUN_LEVEL  8 */
+    if (fp == RT_NULL)
+    {
+        return;
+    }
 
-#if RUN_LEVEL >=  9
-    p_test09,
-#endif /* RUN_LEVEL  9 */
+    if (json)
+    {
+        static rt_si32 rows = 0;
+
+        fprintf(fp, "%s\n  {\"mode\": \"%s\", \"level\": %d, \"test\": \"%s\", "
+            "\"ptr\": %d, \"addr\": %d, \"fp\": %d, \"simd\": \"%s\", "
+            "\"reps\": %d, \"calls\": %.0f, \"wss_kb\": %.3f, \"elems\": %.0f, "
+            "\"median_us\": %.1f, \"min_us\": %.1f, \"max_us\": %.1f, "
+            "\"spread_pct\": %.3f, \"ns_call\": %.3f, \"ns_elem\": %.6f, "
+            "\"cyc_elem\": %.6f, \"elem_s\": %.6e, \"gflop_s\": %.6f, "
+            "\"gb_s\": %.6f, \"threads\": %d}", rows++ > 0 ? "," : "",
+            mode, l+1, name, RT_POINTER, RT_ADDRESS, RT_ELEMENT, simd,
+            b_test > 0 ? b_test : 1, st->cal, st->wss / 1024.0, st->elm,
+            st->med, st->min, st->max, st->spr, st->nsc, st->nse, st->cpe,
+            st->eps, st->gfl, st->gbs, st->thr);
+    }
+    else
+    {
+        fprintf(fp, "%s,%d,%s,%d,%d,%d,%s,%d,%.0f,%.3f,%.0f,%.1f,%.1f,%.1f,"
+            "%.3f,%.3f,%.6f,%.6f,%.6e,%.6f,%.6f,%d\n", mode, l+1, name,
+            RT_POINTER, RT_ADDRESS, RT_ELEMENT, simd, b_test > 0 ? b_test : 1,
+            st->cal, st->wss / 1024.0, st->elm, st->med, st->min, st->max,
+            st->spr, st->nsc, st->nse, st->cpe, st->eps, st->gfl, st->gbs,
+            st->thr);
+    }
+}
 
-#if RUN_LEVEL >= 10
-    p_test10,
-#endif /* RUN_LEVEL 10 */
+/******************************************************************************/
+/**********************************   MICRO   *********************************/
+/******************************************************************************/
 
-#if RUN_LEVEL >= 11
-    p_test11,
-#endif /* RUN_LEVEL 11 */
+/*
+ * Per-instruction micro-benchmarks, each generated kernel runs info->cyc
+ * iterations of MB_UNROLL instances of a single instruction macro either
+ * as one dependent chain on Xmm0 (latency, l_op) or round-robin over
+ * independent chains (throughput, t_op): 8 chains on 8-regs targets,
+ * 14 chains on 16-regs and 28 chains on 32-regs targets, enough to cover
+ * latency x throughput of a pipelined unit. MB_SRC holds +1.0 in all
+ * elements and serves as the second source (on 8-regs targets it doubles
+ * as the last chain). Emulated instructions are measured as a whole,
+ * as they are seen by the code using them.
+ */
+#if   RT_REGS >= 32
+
+#define MB_UNROLL           28
+#define MB_SRC              XmmT
+
+#define MB_INIT()                                                           \
+        movpx_ld(MB_SRC, Mebp, inf_GPC01)                                   \
+        movpx_rr(Xmm0, MB_SRC)                                              \
+        movpx_rr(Xmm1, MB_SRC)                                              \
+        movpx_rr(Xmm2, MB_SRC)                                              \
+        movpx_rr(Xmm3, MB_SRC)                                              \
+        movpx_rr(Xmm4, MB_SRC)                                              \
+        movpx_rr(Xmm5, MB_SRC)                                              \
+        movpx_rr(Xmm6, MB_SRC)                                              \
+        movpx_rr(Xmm7, MB_SRC)                                              \
+        movpx_rr(Xmm8, MB_SRC)                                              \
+        movpx_rr(Xmm9, MB_SRC)                                              \
+        movpx_rr(XmmA, MB_SRC)                                              \
+        movpx_rr(XmmB, MB_SRC)                                              \
+        movpx_rr(XmmC, MB_SRC)                                              \
+        movpx_rr(XmmD, MB_SRC)                                              \
+        movpx_rr(XmmE, MB_SRC)                                              \
+        movpx_rr(XmmF, MB_SRC)                                              \
+        movpx_rr(XmmG, MB_SRC)                                              \
+        movpx_rr(XmmH, MB_SRC)                                              \
+        movpx_rr(XmmI, MB_SRC)                                              \
+        movpx_rr(XmmJ, MB_SRC)                                              \
+        movpx_rr(XmmK, MB_SRC)                                              \
+        movpx_rr(XmmL, MB_SRC)                                              \
+        movpx_rr(XmmM, MB_SRC)                                              \
+        movpx_rr(XmmN, MB_SRC)                                              \
+        movpx_rr(XmmO, MB_SRC)                                              \
+        movpx_rr(XmmP, MB_SRC)                                              \
+        movpx_rr(XmmQ, MB_SRC)                                              \
+        movpx_rr(XmmR, MB_SRC)                                              \
+        movwx_ld(Reax, Mebp, inf_CYC)                                       \
+        movwx_st(Reax, Mebp, inf_LOC)
 
-#if RUN_LEVEL >= 12
-    p_test12,
-#endif /* RUN_LEVEL 12 */
+#define MB_CHAIN(fm, op, lb)                                                \
+        fm(op, Xmm0, lb##00)                                                \
+        fm(op, Xmm0, lb##01)                                                \
+        fm(op, Xmm0, lb##02)                                                \
+        fm(op, Xmm0, lb##03)                                                \
+        fm(op, Xmm0, lb##04)                                                \
+        fm(op, Xmm0, lb##05)                                                \
+        fm(op, Xmm0, lb##06)                                                \
+        fm(op, Xmm0, lb##07)                                                \
+        fm(op, Xmm0, lb##08)                                                \
+        fm(op, Xmm0, lb##09)                                                \
+        fm(op, Xmm0, lb##10)                                                \
+        fm(op, Xmm0, lb##11)                                                \
+        fm(op, Xmm0, lb##12)                                                \
+        fm(op, Xmm0, lb##13)                                                \
+        fm(op, Xmm0, lb##14)                                                \
+        fm(op, Xmm0, lb##15)                                                \
+        fm(op, Xmm0, lb##16)                                                \
+        fm(op, Xmm0, lb##17)                                                \
+        fm(op, Xmm0, lb##18)                                                \
+        fm(op, Xmm0, lb##19)                                                \
+        fm(op, Xmm0, lb##20)                                                \
+        fm(op, Xmm0, lb##21)                                                \
+        fm(op, Xmm0, lb##22)                                                \
+        fm(op, Xmm0, lb##23)                                                \
+        fm(op, Xmm0, lb##24)                                                \
+        fm(op, Xmm0, lb##25)                                                \
+        fm(op, Xmm0, lb##26)                                                \
+        fm(op, Xmm0, lb##27)
+
+#define MB_CHAINS(fm, op, lb)                                               \
+        fm(op, Xmm0, lb##00)                                                \
+        fm(op, Xmm1, lb##01)                                                \
+        fm(op, Xmm2, lb##02)                                                \
+        fm(op, Xmm3, lb##03)                                                \
+        fm(op, Xmm4, lb##04)                                                \
+        fm(op, Xmm5, lb##05)                                                \
+        fm(op, Xmm6, lb##06)                                                \
+        fm(op, Xmm7, lb##07)                                                \
+        fm(op, Xmm8, lb##08)                                                \
+        fm(op, Xmm9, lb##09)                                                \
+        fm(op, XmmA, lb##10)                                                \
+        fm(op, XmmB, lb##11)                                                \
+        fm(op, XmmC, lb##12)                                                \
+        fm(op, XmmD, lb##13)                                                \
+        fm(op, XmmE, lb##14)                                                \
+        fm(op, XmmF, lb##15)                                                \
+        fm(op, XmmG, lb##16)                                                \
+        fm(op, XmmH, lb##17)                                                \
+        fm(op, XmmI, lb##18)                                                \
+        fm(op, XmmJ, lb##19)                                                \
+        fm(op, XmmK, lb##20)                                                \
+        fm(op, XmmL, lb##21)                                                \
+        fm(op, XmmM, lb##22)                                                \
+        fm(op, XmmN, lb##23)                                                \
+        fm(op, XmmO, lb##24)                                                \
+        fm(op, XmmP, lb##25)                                                \
+        fm(op, XmmQ, lb##26)                                                \
+        fm(op, XmmR, lb##27)
+
+#elif RT_REGS >= 16
+
+#define MB_UNROLL           28
+#define MB_SRC              XmmE
+
+#define MB_INIT()                                                           \
+        movpx_ld(MB_SRC, Mebp, inf_GPC01)                                   \
+        movpx_rr(Xmm0, MB_SRC)                                              \
+        movpx_rr(Xmm1, MB_SRC)                                              \
+        movpx_rr(Xmm2, MB_SRC)                                              \
+        movpx_rr(Xmm3, MB_SRC)                                              \
+        movpx_rr(Xmm4, MB_SRC)                                              \
+        movpx_rr(Xmm5, MB_SRC)                                              \
+        movpx_rr(Xmm6, MB_SRC)                                              \
+        movpx_rr(Xmm7, MB_SRC)                                              \
+        movpx_rr(Xmm8, MB_SRC)                                              \
+        movpx_rr(Xmm9, MB_SRC)                                              \
+        movpx_rr(XmmA, MB_SRC)                                              \
+        movpx_rr(XmmB, MB_SRC)                                              \
+        movpx_rr(XmmC, MB_SRC)                                              \
+        movpx_rr(XmmD, MB_SRC)                                              \
+        movwx_ld(Reax, Mebp, inf_CYC)                                       \
+        movwx_st(Reax, Mebp, inf_LOC)
 
-#if RUN_LEVEL >= 13
-    p_test13,
-#endif /* RUN_LEVEL 13 */
+#define MB_CHAIN(fm, op, lb)                                                \
+        fm(op, Xmm0, lb##00)                                                \
+        fm(op, Xmm0, lb##01)                                                \
+        fm(op, Xmm0, lb##02)                                                \
+        fm(op, Xmm0, lb##03)                                                \
+        fm(op, Xmm0, lb##04)                                                \
+        fm(op, Xmm0, lb##05)                                                \
+        fm(op, Xmm0, lb##06)                                                \
+        fm(op, Xmm0, lb##07)                                                \
+        fm(op, Xmm0, lb##08)                                                \
+        fm(op, Xmm0, lb##09)                                                \
+        fm(op, Xmm0, lb##10)                                                \
+        fm(op, Xmm0, lb##11)                                                \
+        fm(op, Xmm0, lb##12)                                                \
+        fm(op, Xmm0, lb##13)                                                \
+        fm(op, Xmm0, lb##14)                                                \
+        fm(op, Xmm0, lb##15)                                                \
+        fm(op, Xmm0, lb##16)                                                \
+        fm(op, Xmm0, lb##17)                                                \
+        fm(op, Xmm0, lb##18)                                                \
+        fm(op, Xmm0, lb##19)                                                \
+        fm(op, Xmm0, lb##20)                                                \
+        fm(op, Xmm0, lb##21)                                                \
+        fm(op, Xmm0, lb##22)                                                \
+        fm(op, Xmm0, lb##23)                                                \
+        fm(op, Xmm0, lb##24)                                                \
+        fm(op, Xmm0, lb##25)                                                \
+        fm(op, Xmm0, lb##26)                                                \
+        fm(op, Xmm0, lb##27)
+
+#define MB_CHAINS(fm, op, lb)                                               \
+        fm(op, Xmm0, lb##00)                                                \
+        fm(op, Xmm1, lb##01)                                                \
+        fm(op, Xmm2, lb##02)                                                \
+        fm(op, Xmm3, lb##03)                                                \
+        fm(op, Xmm4, lb##04)                                                \
+        fm(op, Xmm5, lb##05)                                                \
+        fm(op, Xmm6, lb##06)                                                \
+        fm(op, Xmm7, lb##07)                                                \
+        fm(op, Xmm8, lb##08)                                                \
+        fm(op, Xmm9, lb##09)                                                \
+        fm(op, XmmA, lb##10)                                                \
+        fm(op, XmmB, lb##11)                                                \
+        fm(op, XmmC, lb##12)                                                \
+        fm(op, XmmD, lb##13)                                                \
+        fm(op, Xmm0, lb##14)                                                \
+        fm(op, Xmm1, lb##15)                                                \
+        fm(op, Xmm2, lb##16)                                                \
+        fm(op, Xmm3, lb##17)                                                \
+        fm(op, Xmm4, lb##18)                                                \
+        fm(op, Xmm5, lb##19)                                                \
+        fm(op, Xmm6, lb##20)                                                \
+        fm(op, Xmm7, lb##21)                                                \
+        fm(op, Xmm8, lb##22)                                                \
+        fm(op, Xmm9, lb##23)                                                \
+        fm(op, XmmA, lb##24)                                                \
+        fm(op, XmmB, lb##25)                                                \
+        fm(op, XmmC, lb##26)                                                \
+        fm(op, XmmD, lb##27)
+
+#else  /* RT_REGS == 8 */
+
+#define MB_UNROLL           16
+#define MB_SRC              Xmm7
+
+#define MB_INIT()                                                           \
+        movpx_ld(MB_SRC, Mebp, inf_GPC01)                                   \
+        movpx_rr(Xmm0, MB_SRC)                                              \
+        movpx_rr(Xmm1, MB_SRC)                                              \
+        movpx_rr(Xmm2, MB_SRC)                                              \
+        movpx_rr(Xmm3, MB_SRC)                                              \
+        movpx_rr(Xmm4, MB_SRC)                                              \
+        movpx_rr(Xmm5, MB_SRC)                                              \
+        movpx_rr(Xmm6, MB_SRC)                                              \
+        movwx_ld(Reax, Mebp, inf_CYC)                                       \
+        movwx_st(Reax, Mebp, inf_LOC)
 
-#if RUN_LEVEL >= 14
-    p_test14,
-#endif /* RUN_LEVEL 14 */
+#define MB_CHAIN(fm, op, lb)                                                \
+        fm(op, Xmm0, lb##00)                                                \
+        fm(op, Xmm0, lb##01)                                                \
+        fm(op, Xmm0, lb##02)                                                \
+        fm(op, Xmm0, lb##03)                                                \
+        fm(op, Xmm0, lb##04)                                                \
+        fm(op, Xmm0, lb##05)                                                \
+        fm(op, Xmm0, lb##06)                                                \
+        fm(op, Xmm0, lb##07)                                                \
+        fm(op, Xmm0, lb##08)                                                \
+        fm(op, Xmm0, lb##09)                                                \
+        fm(op, Xmm0, lb##10)                                                \
+        fm(op, Xmm0, lb##11)                                                \
+        fm(op, Xmm0, lb##12)                                                \
+        fm(op, Xmm0, lb##13)                                                \
+        fm(op, Xmm0, lb##14)                                                \
+        fm(op, Xmm0, lb##15)
+
+#define MB_CHAINS(fm, op, lb)                                               \
+        fm(op, Xmm0, lb##00)                                                \
+        fm(op, Xmm1, lb##01)                                                \
+        fm(op, Xmm2, lb##02)                                                \
+        fm(op, Xmm3, lb##03)                                                \
+        fm(op, Xmm4, lb##04)                                                \
+        fm(op, Xmm5, lb##05)                                                \
+        fm(op, Xmm6, lb##06)                                                \
+        fm(op, Xmm7, lb##07)                                                \
+        fm(op, Xmm0, lb##08)                                                \
+        fm(op, Xmm1, lb##09)                                                \
+        fm(op, Xmm2, lb##10)                                                \
+        fm(op, Xmm3, lb##11)                                                \
+        fm(op, Xmm4, lb##12)                                                \
+        fm(op, Xmm5, lb##13)                                                \
+        fm(op, Xmm6, lb##14)                                                \
+        fm(op, Xmm7, lb##15)
+
+#endif /* RT_REGS */
 
-#if RUN_LEVEL >= 15
-    p_test15,
-#endif /* RUN_LEVEL 15 */
+/*
+ * Instruction forms, each takes an instruction name (op) without suffix,
+ * a register (XG) and a label (lb) unique within the translation unit.
+ */
+#define MB_RR(op, XG, lb)   op##_rr(W(XG), MB_SRC)
+#define MB_RX(op, XG, lb)   op##_rr(W(XG), W(XG))
+#define MB_R3(op, XG, lb)   op##_rr(W(XG), MB_SRC, MB_SRC)
+#define MB_RI(op, XG, lb)   op##_ri(W(XG), IB(1))
+#define MB_MK(op, XG, lb)   op##_rx(W(XG), NONE, lb) LBL(lb)
 
-#if RUN_LEVEL >= 16
-    p_test16,
-#endif /* RUN_LEVEL 16 */
+/*
+ * Latency kernel: MB_UNROLL dependent instances per iteration.
+ */
+#define MB_LAT(fm, op)                                                      \
+rt_void l_##op(rt_SIMD_INFOX *info)                                         \
+{                                                                           \
+    ASM_ENTER(info)                                                         \
+        MB_INIT()                                                           \
+    LBL(mb_##op##_l)                                                        \
+        MB_CHAIN(fm, op, mb_##op##L)                                        \
+        subwx_mi(Mebp, inf_LOC, IB(1))                                      \
+        cmjwx_mz(Mebp, inf_LOC,                                             \
+        /* if */ GT_x, mb_##op##_l)                                         \
+    ASM_LEAVE(info)                                                         \
+}
 
-#if RUN_LEVEL >= 17
-    p_test17,
-#endif /* RUN_LEVEL 17 */
+/*
+ * Throughput kernel: MB_UNROLL instances over all chains per iteration.
+ */
+#define MB_THR(fm, op)                                                      \
+rt_void t_##op(rt_SIMD_INFOX *info)                                         \
+{                                                                           \
+    ASM_ENTER(info)                                                         \
+        MB_INIT()                                                           \
+    LBL(mb_##op##_t)                                                        \
+        MB_CHAINS(fm, op, mb_##op##T)                                       \
+        subwx_mi(Mebp, inf_LOC, IB(1))                                      \
+        cmjwx_mz(Mebp, inf_LOC,                                             \
+        /* if */ GT_x, mb_##op##_t)                                         \
+    ASM_LEAVE(info)                                                         \
+}
 
-#if RUN_LEVEL >= 18
-    p_test18,
-#endif /* RUN_LEVEL 18 */
+/*
+ * Generate both kernels for instruction (op) in form (fm).
+ */
+#define MB_TEST(fm, op)                                                     \
+        MB_LAT(fm, op)                                                      \
+        MB_THR(fm, op)
+
+/* floating point arithmetic */
+
+MB_TEST(MB_RR, addps)
+MB_TEST(MB_RR, subps)
+MB_TEST(MB_RR, mulps)
+MB_TEST(MB_RR, divps)
+MB_TEST(MB_RR, minps)
+MB_TEST(MB_RR, maxps)
+MB_TEST(MB_R3, fmaps)
+MB_TEST(MB_R3, fmsps)
+MB_TEST(MB_RX, sqrps)
+MB_TEST(MB_RX, rceps)
+MB_TEST(MB_RX, rsqps)
+MB_TEST(MB_RX, negps)
+
+/* floating point compare and convert */
+
+MB_TEST(MB_RR, cgtps)
+MB_TEST(MB_RX, cvzps)
+MB_TEST(MB_RX, cvnps)
+MB_TEST(MB_RX, cvnpn)
+
+/* element-sized integer */
+
+MB_TEST(MB_RR, andpx)
+MB_TEST(MB_RR, orrpx)
+MB_TEST(MB_RR, xorpx)
+MB_TEST(MB_RR, addpx)
+MB_TEST(MB_RR, subpx)
+MB_TEST(MB_RR, mulpx)
+MB_TEST(MB_RI, shlpx)
+MB_TEST(MB_RI, shrpx)
+
+/* 16-bit integer (HB) */
+
+MB_TEST(MB_RR, addmx)
+MB_TEST(MB_RR, submx)
+MB_TEST(MB_RR, mulmx)
+MB_TEST(MB_RI, shlmx)
+MB_TEST(MB_RI, shrmx)
+
+/* mask-jump (destroys Reax) */
+
+MB_TEST(MB_MK, mkjpx)
 
-#if RUN_LEVEL >= 19
-    p_test19,
-#endif /* RUN_LEVEL 19 */
+/*
+ * Micro-benchmark descriptor: instruction name and its generated kernels.
+ */
+struct rt_MICRO_TEST
+{
+    const rt_char *name;    /* instruction name (without suffix) */
+    testXX  lat;            /* latency kernel */
+    testXX  thr;            /* throughput kernel */
+};
 
-#if RUN_LEVEL >= 20
-    p_test20,
-#endif /* RUN_LEVEL 20 */
+#define MB_ITEM(op)         {#op, l_##op, t_##op}
 
-#if RUN_LEVEL >= 21
-    p_test21,
-#endif /* RUN_LEVEL 21 */
+rt_MICRO_TEST u_test[] =
+{
+    MB_ITEM(addps),
+    MB_ITEM(subps),
+    MB_ITEM(mulps),
+    MB_ITEM(divps),
+    MB_ITEM(minps),
+    MB_ITEM(maxps),
+    MB_ITEM(fmaps),
+    MB_ITEM(fmsps),
+    MB_ITEM(sqrps),
+    MB_ITEM(rceps),
+    MB_ITEM(rsqps),
+    MB_ITEM(negps),
+    MB_ITEM(cgtps),
+    MB_ITEM(cvzps),
+    MB_ITEM(cvnps),
+    MB_ITEM(cvnpn),
+    MB_ITEM(andpx),
+    MB_ITEM(orrpx),
+    MB_ITEM(xorpx),
+    MB_ITEM(addpx),
+    MB_ITEM(subpx),
+    MB_ITEM(mulpx),
+    MB_ITEM(shlpx),
+    MB_ITEM(shrpx),
+    MB_ITEM(addmx),
+    MB_ITEM(submx),
+    MB_ITEM(mulmx),
+    MB_ITEM(shlmx),
+    MB_ITEM(shrmx),
+    MB_ITEM(mkjpx),
+};
 
-#if RUN_LEVEL >= 22
-    p_test22,
-#endif /* RUN_LEVEL 22 */
+/*
+ * Run micro kernel (test) max(b_test, 1) times for info->cyc iterations
+ * and gather per-instruction statistics into (st).
+ */
+rt_void micro_run(testXX test, rt_SIMD_INFOX *info, rt_time *tm,
+                  rt_BENCH_STAT *st)
+{
+    rt_si32 r, n = b_test > 0 ? b_test : 1;
+    rt_time time1 = 0;
 
-#if RUN_LEVEL >= 23
-    p_test23,
-#endif /* RUN_LEVEL 23 */
+    for (r = 0; r < n; r++)
+    {
+        time1 = get_usec();
+
+        test(info);
+
+        tm[r] = get_usec() - time1;
+    }
 
-#if RUN_LEVEL >= 24
-    p_test24,
-#endif /* RUN_LEVEL 24 */
+    qsort(tm, n, sizeof(rt_time), bench_cmp);
 
-#if RUN_LEVEL >= 25
-    p_test25,
-#endif /* RUN_LEVEL 25 */
+    st->med = n % 2 ? (rt_fp64)tm[n/2] : (tm[n/2-1] + tm[n/2]) / 2.0;
+    st->min = (rt_fp64)tm[0];
+    st->max = (rt_fp64)tm[n-1];
+    st->spr = st->med > 0.0 ? 100.0 * (st->max - st->min) / st->med : 0.0;
 
-#if RUN_LEVEL >= 26
-    p_test26,
-#endif /* RUN_LEVEL 26 */
+    st->cal = (rt_fp64)info->cyc;
+    st->wss = 0.0;
+    st->elm = (rt_fp64)info->cyc * MB_UNROLL;
 
-#if RUN_LEVEL >= 27
-    p_test27,
-#endif /* RUN_LEVEL 27 */
+    st->thr = 1;
 
-#if RUN_LEVEL >= 28
-    p_test28,
-#endif /* RUN_LEVEL 28 */
+    st->nsc = st->nse = st->cpe = st->eps = st->gfl = st->gbs = 0.0;
 
-#if RUN_LEVEL >= 29
-    p_test29,
-#endif /* RUN_LEVEL 29 */
+    /* median below timer resolution (1 us) leaves the rates at 0,
+     * bench_out reports them as n/a and asks to raise -u */
+    if (st->med <= 0.0)
+    {
+        return;
+    }
 
-#if RUN_LEVEL >= 30
-    p_test30,
-#endif /* RUN_LEVEL 30 */
+    rt_fp64 t = st->med;
 
-#if RUN_LEVEL >= 31
-    p_test31,
-#endif /* RUN_LEVEL 31 */
+    st->nsc = t * 1000.0 / st->cal;
+    st->nse = t * 1000.0 / st->elm;
+    st->cpe = t * f_core / st->elm;
+    st->eps = st->elm / t * 1000000.0;
+}
 
-#if RUN_LEVEL >= 32
-    p_test32,
-#endif /* RUN_LEVEL 32 */
+/******************************************************************************/
+/**********************************   SIZE   **********************************/
+/******************************************************************************/
 
-#if RUN_LEVEL >= 33
-    p_test33,
-#endif /* RUN_LEVEL 33 */
+#ifdef RT_SIZE_TEST
 
-#if RUN_LEVEL >= 34
-    p_test34,
-#endif /* RUN_LEVEL 34 */
+/*
+ * Code-size kernel, built with -DRT_SIZE_TEST by the "size" target of the
+ * makefiles and never run. Each public packed instruction macro is emitted
+ * once after its own sz_ label (named after the macro), sz_end closes the
+ * last one. Sizes are then taken from the object file disassembly by
+ * simd_size.awk per macro (sz_ labels) and per kernel (s_, l_, t_, z_).
+ */
+#define MZ_RR(op)           LBL(sz_##op##_rr) op##_rr(Xmm1, Xmm7)
+#define MZ_LD(op)           LBL(sz_##op##_ld) op##_ld(Xmm1, Mebp, inf_GPC01)
+#define MZ_R3(op)           LBL(sz_##op##_rr) op##_rr(Xmm1, Xmm6, Xmm7)
+#define MZ_L3(op)           LBL(sz_##op##_ld) op##_ld(Xmm1, Xmm6, Mebp,     \
+                                                      inf_GPC01)
+#define MZ_R4(op)           LBL(sz_##op##_rr) op##_rr(Xmm1, Xmm5, Xmm6, Xmm7)
+#define MZ_RM(op)           LBL(sz_##op##_rr) op##_rr(Xmm1, Xmm7, ROUNDN)
+#define MZ_RI(op)           LBL(sz_##op##_ri) op##_ri(Xmm1, IB(1))
+#define MZ_RX(op)           LBL(sz_##op##_rx) op##_rx(Xmm1)
+#define MZ_MK(op)           LBL(sz_##op##_rx) op##_rx(Xmm1, NONE, zl_##op)  \
+                            LBL(zl_##op)
+#define MZ_ST(op)           LBL(sz_##op##_st) op##_st(Xmm1, Mebp,           \
+                                                      inf_SCR01(0))
+#define MZ_3R(op)           LBL(sz_##op##3rr) op##3rr(Xmm1, Xmm6, Xmm7)
+#define MZ_3L(op)           LBL(sz_##op##3ld) op##3ld(Xmm1, Xmm6, Mebp,     \
+                                                      inf_GPC01)
+#define MZ_3I(op)           LBL(sz_##op##3ri) op##3ri(Xmm1, Xmm6, IB(1))
+
+rt_void z_test(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
 
-#if RUN_LEVEL >= 35
-    p_test35,
-#endif /* RUN_LEVEL 35 */
+        MZ_ST(elmpx)
+        MZ_RR(movpx)
+        MZ_LD(movpx)
+        MZ_ST(movpx)
+        MZ_RR(mmvpx)
+        MZ_LD(mmvpx)
+        MZ_ST(mmvpx)
+        MZ_RR(andpx)
+        MZ_LD(andpx)
+        MZ_3R(andpx)
+        MZ_3L(andpx)
+        MZ_RR(annpx)
+        MZ_LD(annpx)
+        MZ_3R(annpx)
+        MZ_3L(annpx)
+        MZ_RR(orrpx)
+        MZ_LD(orrpx)
+        MZ_3R(orrpx)
+        MZ_3L(orrpx)
+        MZ_RR(ornpx)
+        MZ_LD(ornpx)
+        MZ_3R(ornpx)
+        MZ_3L(ornpx)
+        MZ_RR(xorpx)
+        MZ_LD(xorpx)
+        MZ_3R(xorpx)
+        MZ_3L(xorpx)
+        MZ_RX(notpx)
+        MZ_RR(notpx)
+        MZ_RX(negps)
+        MZ_RR(negps)
+        MZ_RR(addps)
+        MZ_LD(addps)
+        MZ_3R(addps)
+        MZ_3L(addps)
+        MZ_RR(adpps)
+        MZ_LD(adpps)
+        MZ_3R(adpps)
+        MZ_3L(adpps)
+        MZ_RR(adhps)
+        MZ_LD(adhps)
+        MZ_RR(subps)
+        MZ_LD(subps)
+        MZ_3R(subps)
+        MZ_3L(subps)
+        MZ_RR(mulps)
+        MZ_LD(mulps)
+        MZ_3R(mulps)
+        MZ_3L(mulps)
+        MZ_RR(mlpps)
+        MZ_LD(mlpps)
+        MZ_3R(mlpps)
+        MZ_3L(mlpps)
+        MZ_RR(mlhps)
+        MZ_LD(mlhps)
+        MZ_RR(divps)
+        MZ_LD(divps)
+        MZ_3R(divps)
+        MZ_3L(divps)
+        MZ_RR(sqrps)
+        MZ_LD(sqrps)
+        MZ_R4(cbrps)
+        MZ_R4(cbeps)
+        MZ_R4(cbsps)
+        MZ_RR(rcpps)
+        MZ_RR(rceps)
+        MZ_RR(rcsps)
+        MZ_RR(rsqps)
+        MZ_RR(rseps)
+        MZ_RR(rssps)
+        MZ_R3(fmaps)
+        MZ_L3(fmaps)
+        MZ_R3(fmsps)
+        MZ_L3(fmsps)
+        MZ_RR(minps)
+        MZ_LD(minps)
+        MZ_3R(minps)
+        MZ_3L(minps)
+        MZ_RR(mnpps)
+        MZ_LD(mnpps)
+        MZ_3R(mnpps)
+        MZ_3L(mnpps)
+        MZ_RR(mnhps)
+        MZ_LD(mnhps)
+        MZ_RR(maxps)
+        MZ_LD(maxps)
+        MZ_3R(maxps)
+        MZ_3L(maxps)
+        MZ_RR(mxpps)
+        MZ_LD(mxpps)
+        MZ_3R(mxpps)
+        MZ_3L(mxpps)
+        MZ_RR(mxhps)
+        MZ_LD(mxhps)
+        MZ_RR(ceqps)
+        MZ_LD(ceqps)
+        MZ_3R(ceqps)
+        MZ_3L(ceqps)
+        MZ_RR(cneps)
+        MZ_LD(cneps)
+        MZ_3R(cneps)
+        MZ_3L(cneps)
+        MZ_RR(cltps)
+        MZ_LD(cltps)
+        MZ_3R(cltps)
+        MZ_3L(cltps)
+        MZ_RR(cleps)
+        MZ_LD(cleps)
+        MZ_3R(cleps)
+        MZ_3L(cleps)
+        MZ_RR(cgtps)
+        MZ_LD(cgtps)
+        MZ_3R(cgtps)
+        MZ_3L(cgtps)
+        MZ_RR(cgeps)
+        MZ_LD(cgeps)
+        MZ_3R(cgeps)
+        MZ_3L(cgeps)
+        MZ_MK(mkjpx)
+        MZ_RR(rnzps)
+        MZ_LD(rnzps)
+        MZ_RR(cvzps)
+        MZ_LD(cvzps)
+        MZ_RR(rnpps)
+        MZ_LD(rnpps)
+        MZ_RR(cvpps)
+        MZ_LD(cvpps)
+        MZ_RR(rnmps)
+        MZ_LD(rnmps)
+        MZ_RR(cvmps)
+        MZ_LD(cvmps)
+        MZ_RR(rnnps)
+        MZ_LD(rnnps)
+        MZ_RR(cvnps)
+        MZ_LD(cvnps)
+        MZ_RR(cvnpn)
+        MZ_LD(cvnpn)
+        MZ_RR(rndps)
+        MZ_LD(rndps)
+        MZ_RR(cvtps)
+        MZ_LD(cvtps)
+        MZ_RR(cvtpn)
+        MZ_LD(cvtpn)
+        MZ_RM(rnrps)
+        MZ_RM(cvrps)
+        MZ_RM(cvrpn)
+        MZ_RR(addpx)
+        MZ_LD(addpx)
+        MZ_3R(addpx)
+        MZ_3L(addpx)
+        MZ_RR(subpx)
+        MZ_LD(subpx)
+        MZ_3R(subpx)
+        MZ_3L(subpx)
+        MZ_RR(mulpx)
+        MZ_LD(mulpx)
+        MZ_3R(mulpx)
+        MZ_3L(mulpx)
+        MZ_RI(shlpx)
+        MZ_LD(shlpx)
+        MZ_3I(shlpx)
+        MZ_3L(shlpx)
+        MZ_RI(shrpx)
+        MZ_LD(shrpx)
+        MZ_3I(shrpx)
+        MZ_3L(shrpx)
+        MZ_RI(shrpn)
+        MZ_LD(shrpn)
+        MZ_3I(shrpn)
+        MZ_3L(shrpn)
+        MZ_RR(svlpx)
+        MZ_LD(svlpx)
+        MZ_3R(svlpx)
+        MZ_3L(svlpx)
+        MZ_RR(svrpx)
+        MZ_LD(svrpx)
+        MZ_3R(svrpx)
+        MZ_3L(svrpx)
+        MZ_RR(svrpn)
+        MZ_LD(svrpn)
+        MZ_3R(svrpn)
+        MZ_3L(svrpn)
+
+    LBL(sz_end)
 
-#if RUN_LEVEL >= 36
-    p_test36,
-#endif /* RUN_LEVEL 36 */
+    ASM_LEAVE(info)
+}
 
-#if RUN_LEVEL >= 37
-    p_test37,
-#endif /* RUN_LEVEL 37 */
-};
+#endif /* RT_SIZE_TEST */
 
 /******************************************************************************/
 /**********************************   MAIN   **********************************/
@@ -5875,6 +10393,18 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
         RT_LOGI(" -d n, override diff-threshold for qualification, n >= 0\n");
         RT_LOGI(" -c n, override counter of redundant test cycles, n >= 1\n");
         RT_LOGI(" -v, enable verbose mode, always print values from tests\n");
+        RT_LOGI(" -m n, enable benchmark mode with n repetitions, n >= 1\n");
+        RT_LOGI(" -f n, specify core clock in MHz for cycles/elem, n >= 1\n");
+        RT_LOGI(" -o f, write bench results to file f, CSV or .json\n");
+        RT_LOGI(" -w n, sweep working-set from 4 KB up to n KB, n >= 4\n");
+        RT_LOGI(" -t n, run S-tests on 1 to n pinned threads, n >= 1\n");
+        RT_LOGI("   (with -w each thread walks own max working-set)\n");
+        RT_LOGI("   then check SPMD thread pool (rtpool.h) on n threads\n");
+        RT_LOGI(" -p l, count perf events from comma-separated list l:\n");
+        RT_LOGI("   cycles,instructions,cache-refs,cache-misses,branches,\n");
+        RT_LOGI("   branch-misses,l1d-misses,llc-misses,stalls-fe,\n");
+        RT_LOGI("   stalls-be,task-clock,page-faults,rNNNN (raw hex)\n");
+        RT_LOGI(" -u n, micro-bench instructions over n loops, n >= 1\n");
         RT_LOGI("all options can be used together\n");
         RT_LOGI("--------------------------------------------------------\n");
     }
@@ -5954,6 +10484,101 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
             v_mode = RT_TRUE;
             RT_LOGI("Verbose mode enabled\n");
         }
+        if (k < argc && strcmp(argv[k], "-m") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1)
+            {
+                RT_LOGI("Bench-repeats overridden: %d\n", t);
+                b_test = t;
+            }
+            else
+            {
+                RT_LOGI("Bench-repeats value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-f") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1)
+            {
+                RT_LOGI("Core-clock overridden: %d MHz\n", t);
+                f_core = t;
+            }
+            else
+            {
+                RT_LOGI("Core-clock value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-o") == 0 && ++k < argc)
+        {
+            RT_LOGI("Bench-output overridden: %s\n", argv[k]);
+            o_file = argv[k];
+        }
+        if (k < argc && strcmp(argv[k], "-w") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 4 && t <= 1024*1024)
+            {
+                RT_LOGI("Sweep-max overridden: %d KB\n", t);
+                w_size = t;
+            }
+            else
+            {
+                RT_LOGI("Sweep-max value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-p") == 0 && ++k < argc)
+        {
+            RT_LOGI("Perf-events overridden: %s\n", argv[k]);
+            p_list = argv[k];
+        }
+        if (k < argc && strcmp(argv[k], "-t") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1 && t <= 256)
+            {
+                RT_LOGI("Scale-threads overridden: %d\n", t);
+                m_thrd = t;
+            }
+            else
+            {
+                RT_LOGI("Scale-threads value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-u") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1)
+            {
+                RT_LOGI("Micro-iterations overridden: %d\n", t);
+                u_iter = t;
+            }
+            else
+            {
+                RT_LOGI("Micro-iterations value out of range\n");
+                return 0;
+            }
+        }
     }
 
     rt_pntr marr = sys_alloc(15*ARR_SIZE*sizeof(rt_elem) + MASK);
@@ -6105,6 +10730,7 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 
     inf0->cyc  = r_test;
     inf0->size = ARR_SIZE;
+    inf0->tile = 1;
     inf0->tail = (rt_pntr)0xABCDEF01;
 
     rt_si32 simd = 0;
@@ -6168,37 +10794,387 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 
     rt_si32 i;
 
+    rt_si32 perf = p_list != RT_NULL ? perf_init(p_list) : 0;
+    rt_ui64 pC[RT_PERF_MAX], pS[RT_PERF_MAX];
+
+    rt_char sstr[32];
+    sprintf(sstr, "%dx%dv%d",
+            (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+
+    rt_BENCH_STAT stC, stS;
+    rt_time *btim = RT_NULL;
+    FILE *bout = RT_NULL;
+    rt_bool json = RT_FALSE;
+
+    rt_si32 tmax = w_size * 1024 / (TILE_SIZE * sizeof(rt_elem));
+    rt_pntr wmar = RT_NULL;
+
+    rt_si32 bmax = RT_MAX(RT_MAX(b_test, m_thrd), 1);
+
+    if (b_test > 0 || w_size > 0 || m_thrd > 0 || u_iter > 0)
+    {
+        btim = (rt_time *)sys_alloc(bmax * sizeof(rt_time));
+    }
+
+    rt_SCALE_THRD *mthd = RT_NULL;
+    rt_pntr *mhnd = RT_NULL;
+    rt_pntr mmar = RT_NULL;
+    rt_size minf = (sizeof(rt_SIMD_INFOX) + MASK) & ~MASK;
+    rt_size mreg = (sizeof(rt_SIMD_REGS) + MASK) & ~MASK;
+    rt_si32 mtil = w_size > 0 ? RT_MAX(tmax, 1) : 1;
+    rt_size msiz = minf + mreg + mtil * TILE_SIZE * sizeof(rt_elem) + MASK;
+
+    /* each thread gets its own info, regs and tiles (-w working-set size,
+     * single L1-resident tile by default), aligned to SIMD
+     * (allocated here as sys_alloc is not thread-safe) */
+    if (m_thrd > 0)
+    {
+        mthd = (rt_SCALE_THRD *)sys_alloc(m_thrd * sizeof(rt_SCALE_THRD));
+        mhnd = (rt_pntr *)sys_alloc(m_thrd * sizeof(rt_pntr));
+        mmar = sys_alloc(m_thrd * msiz);
+
+        for (k = 0; k < m_thrd; k++)
+        {
+            rt_byte *mptr = (rt_byte *)(((rt_full)mmar + msiz*k + MASK)
+                                                                & ~MASK);
+            rt_SIMD_INFOX *tinf = (rt_SIMD_INFOX *)mptr;
+            rt_SIMD_REGS *treg = (rt_SIMD_REGS *)(mptr + minf);
+            rt_elem *ttil = (rt_elem *)(mptr + minf + mreg);
+
+            memcpy(tinf, inf0, sizeof(rt_SIMD_INFOX));
+
+            for (t = 0; t < mtil; t++)
+            {
+                memcpy(ttil + TILE_SIZE*t, mar0, TILE_SIZE * sizeof(rt_elem));
+            }
+
+            ASM_INIT(tinf, treg)
+
+            tile_set(tinf, ttil);
+
+            /* walk tiles once per kernel call as in sweep mode */
+            tinf->cyc = mtil > 1 ? 1 : r_test;
+
+            mthd[k].test = RT_NULL;
+            mthd[k].info = tinf;
+            mthd[k].base = ttil;
+            mthd[k].tile = mtil;
+            mthd[k].pass = mtil > 1 ? RT_MAX(r_test / mtil, 1) : 1;
+            mthd[k].tbeg = 0;
+            mthd[k].tend = 0;
+        }
+    }
+
+    /* sweep buffer (-w working-set size), at least 2 tiles to let
+     * sweep_mask probe the arrays each kernel reads or writes,
+     * filled by sweep_set for each kernel's own stream layout */
+    if (b_test > 0 || w_size > 0)
+    {
+        tmax = RT_MAX(tmax, 2);
+        wmar = sys_alloc(tmax * TILE_SIZE * sizeof(rt_elem) + MASK);
+        w_base = (rt_elem *)(((rt_full)wmar + MASK) & ~MASK);
+    }
+
+    if ((b_test > 0 || w_size > 0 || m_thrd > 0 || u_iter > 0)
+                                                  && o_file != RT_NULL)
+    {
+        l = strlen(o_file);
+        json = l >= 5 && strcmp(o_file + l - 5, ".json") == 0;
+
+        bout = fopen(o_file, "w");
+        if (bout == RT_NULL)
+        {
+            RT_LOGE("Bench-output file cannot be opened: %s\n", o_file);
+        }
+        else if (json)
+        {
+            fprintf(bout, "[");
+        }
+        else
+        {
+            fprintf(bout, "mode,level,test,ptr,addr,fp,simd,reps,calls,wss_kb,"
+                "elems,median_us,min_us,max_us,spread_pct,ns_call,ns_elem,"
+                "cyc_elem,elem_s,gflop_s,gb_s,threads\n");
+        }
+    }
+
     for (i = n_init; i <= n_done; i++)
     {
         RT_LOGI("-------------------  RUN LEVEL = %2d  - ptr/fp = %d%s%d --\n",
                     i+1, RT_POINTER, RT_ADDRESS == 32 ? "_" : "f", RT_ELEMENT);
 
-        time1 = get_time();
+        perf_start();
+        time1 = get_time();
+
+        c_test[i](inf0);
+
+        time2 = get_time();
+        perf_stop(pC);
+        tC = time2 - time1;
+        RT_LOGI("Time C = %d\n", (rt_si32)tC);
+        perf_out("C", perf, pC);
+
+        /* --------------------------------- */
+
+        perf_start();
+        time1 = get_time();
+
+        s_test[i](inf0);
+
+        time2 = get_time();
+        perf_stop(pS);
+        tS = time2 - time1;
+        RT_LOGI("Time S = %d\n", (rt_si32)tS);
+        perf_out("S", perf, pS);
+        prof_out("S", reg0);
+        fpst_out("S", reg0);
+
+        /* --------------------------------- */
+
+        p_test[i](inf0);
+
+        /* --------------------------------- */
+
+        rt_si32 smsk = 0, cmsk = 0;
+
+        /* arrays read or written by the kernels, c_testXX write results
+         * into *co1/*co2 where s_testXX write them into *so1/*so2 */
+        if (b_test > 0 || w_size > 0)
+        {
+            smsk = sweep_mask(s_test[i], inf0, w_base, (rt_elem *)mar0);
+            cmsk = (smsk & ~TILE_SO12) | (smsk & TILE_SO12) >> 2;
+
+            tile_set(inf0, (rt_elem *)mar0);
+        }
+
+        /* --------------------------------- */
+
+        if (b_test > 0)
+        {
+            bench_run(c_test[i], inf0, i, r_test, sweep_size(cmsk),
+                                      sweep_size(cmsk), btim, &stC);
+            bench_out(bout, json, i, "bench", "C", sstr, &stC);
+
+            bench_run(s_test[i], inf0, i, r_test, sweep_size(smsk),
+                                      sweep_size(smsk), btim, &stS);
+            bench_out(bout, json, i, "bench", "S", sstr, &stS);
+        }
+
+        /* --------------------------------- */
+
+        if (w_size > 0)
+        {
+            inf0->cyc = 1;
+
+            for (k = 0; k < 2; k++)
+            {
+                w_test = k == 0 ? c_test[i] : s_test[i];
+                w_call = k == 0;
+                w_mask = k == 0 ? cmsk : smsk;
+
+                rt_si32 size = sweep_size(w_mask);
+
+                if (size == 0)
+                {
+                    RT_LOGI("Sweep %s: n/a, subtest has no tile loop\n",
+                                                      k == 0 ? "C" : "S");
+                    continue;
+                }
+
+                for (t = 4; t <= w_size; t *= 2)
+                {
+                    w_tile = t * 1024 / size;
+                    w_tile = RT_MIN(RT_MAX(w_tile, 1),
+                     (rt_si32)(tmax * TILE_SIZE * sizeof(rt_elem) / size));
+                    w_pass = RT_MAX(r_test / w_tile, 1);
+
+                    sweep_set(inf0, w_base, (rt_elem *)mar0, w_tile, w_mask);
+
+                    bench_run(sweep_run, inf0, i, (rt_fp64)w_tile * w_pass,
+                              size, (rt_fp64)w_tile * size, btim, &stS);
+                    bench_out(bout, json, i, "sweep", k == 0 ? "C" : "S",
+                                                              sstr, &stS);
+                }
+            }
+
+            tile_set(inf0, (rt_elem *)mar0);
+            inf0->cyc = r_test;
+        }
+
+        /* --------------------------------- */
+
+        if (m_thrd > 0)
+        {
+            rt_fp64 eps1 = 0.0;
+
+            for (k = 1; k <= m_thrd; k++)
+            {
+                scale_run(s_test[i], mthd, i, k, mhnd, btim, &stS);
+                bench_out(bout, json, i, "scale", "S", sstr, &stS);
+
+                eps1 = k == 1 ? stS.eps : eps1;
+
+                RT_LOGI("Scale S: threads = %2d, scaling = %6.2fx, "
+                        "efficiency = %5.1f%%\n", k, stS.eps / eps1,
+                        100.0 * stS.eps / eps1 / k);
+            }
+        }
+
+        RT_LOGI("-------------------------------------- simd = %4dx%dv%d -\n",
+                (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+    }
+
+    if (u_iter > 0 && n_done >= 0)
+    {
+        RT_LOGI("-------------------  MICRO (lat/thr) - ptr/fp = %d%s%d --\n",
+                    RT_POINTER, RT_ADDRESS == 32 ? "_" : "f", RT_ELEMENT);
+
+        rt_char name[32];
+
+        inf0->cyc = u_iter;
+
+        for (k = 0; k < (rt_si32)RT_ARR_SIZE(u_test); k++)
+        {
+            sprintf(name, "%s.lat", u_test[k].name);
+            micro_run(u_test[k].lat, inf0, btim, &stS);
+            bench_out(bout, json, -1, "micro", name, sstr, &stS);
+
+            sprintf(name, "%s.thr", u_test[k].name);
+            micro_run(u_test[k].thr, inf0, btim, &stC);
+            bench_out(bout, json, -1, "micro", name, sstr, &stC);
+        }
+
+        inf0->cyc = r_test;
+
+        RT_LOGI("-------------------------------------- simd = %4dx%dv%d -\n",
+                (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+    }
+
+    /* thread pool is created once, threads are started per run,
+     * grains below cover one chunk per worker, rounding up to S
+     * and tails (num is not a multiple of S), then the first quarter
+     * of vectors is made heavy to compare static split with work-stealing */
+    if (m_thrd > 0)
+    {
+        RT_LOGI("-------------------  POOL (SPMD for) - ptr/fp = %d%s%d --\n",
+                    RT_POINTER, RT_ADDRESS == 32 ? "_" : "f", RT_ELEMENT);
+
+        rt_size j, pnum = ARR_SIZE * 1024 + 3;
+        rt_size pgrn[] = {0, 1, S * 5 + 1, pnum};
+        rt_si32 perr[2];
+        rt_time ptim[2];
+
+        rt_size psiz = (pnum * sizeof(rt_real) + MASK) & ~MASK;
+        rt_size rsiz = ((pnum / S + 1) * sizeof(rt_elem) + MASK) & ~MASK;
+
+        rt_pntr pmar = sys_alloc(2 * psiz + rsiz + MASK);
+        rt_POOL_TEST ptst;
+
+        ptst.src = (rt_real *)(((rt_full)pmar + MASK) & ~MASK);
+        ptst.dst = (rt_real *)((rt_byte *)ptst.src + psiz);
+        ptst.rep = (rt_elem *)((rt_byte *)ptst.dst + psiz);
+
+        for (j = 0; j < pnum; j++)
+        {
+            ptst.src[j] = (rt_real)(j % 1000) * (rt_real)0.25 - (rt_real)100.0;
+        }
+
+        for (j = 0; j <= pnum / S; j++)
+        {
+            ptst.rep[j] = 1;
+        }
+
+        rt_ThreadPool *pool = new rt_ThreadPool(m_thrd, sizeof(rt_SIMD_INFOX),
+                              sys_alloc, sys_free, thread_init, thread_join);
+
+        /* mark workers' infos once, both kinds of runs below
+         * (on the same parked workers) are expected to keep them */
+        for (k = 0; k < pool->get_thnum(); k++)
+        {
+            ((rt_SIMD_INFOX *)pool->get_info(k))->cyc = k + 1;
+        }
+
+        for (k = 0; k < (rt_si32)RT_ARR_SIZE(pgrn); k++)
+        {
+            perr[0] = pool_run(pool, &ptst, pnum, pgrn[k], 0);
+            perr[1] = pool_run(pool, &ptst, pnum, pgrn[k], 4);
+
+            RT_LOGI("Pool S: threads = %2d, num = %d, grain = %d, "
+                    "errors = %d (static), %d (steal)\n", pool->get_thnum(),
+                    (rt_si32)pnum, (rt_si32)pgrn[k], perr[0], perr[1]);
+        }
+
+        for (j = 0; j < pnum / S / 4; j++)
+        {
+            ptst.rep[j] = 256;
+        }
+
+        ptim[0] = pool_time(pool, &ptst, pnum, S * 4, 0, 8, &perr[0]);
+
+        for (k = 0; k < pool->get_thnum(); k++)
+        {
+            RT_LOGI("Pool S: static, worker %2d: tiles = %5d, calls = %5d\n",
+                    k, (rt_si32)pool->get_tiles(k),
+                    (rt_si32)pool->get_calls(k));
+        }
+
+        ptim[1] = pool_time(pool, &ptst, pnum, S * 4, 4, 8, &perr[1]);
+
+        for (k = 0; k < pool->get_thnum(); k++)
+        {
+            RT_LOGI("Pool S: steal,  worker %2d: tiles = %5d, calls = %5d, "
+                    "steals = %d\n", k, (rt_si32)pool->get_tiles(k),
+                    (rt_si32)pool->get_calls(k),
+                    (rt_si32)pool->get_steals(k));
+        }
 
-        c_test[i](inf0);
+        RT_LOGI("Pool S: irregular, static = %d us, steal = %d us, "
+                "speedup = %5.2fx, errors = %d, %d\n",
+                (rt_si32)ptim[0], (rt_si32)ptim[1],
+                (rt_fp64)ptim[0] / (rt_fp64)RT_MAX(ptim[1], 1),
+                perr[0], perr[1]);
 
-        time2 = get_time();
-        tC = time2 - time1;
-        RT_LOGI("Time C = %d\n", (rt_si32)tC);
+        delete pool;
 
-        /* --------------------------------- */
+        sys_free(pmar, 2 * psiz + rsiz + MASK);
 
-        time1 = get_time();
+        RT_LOGI("-------------------------------------- simd = %4dx%dv%d -\n",
+                (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+    }
 
-        s_test[i](inf0);
+    if (bout != RT_NULL)
+    {
+        if (json)
+        {
+            fprintf(bout, "\n]\n");
+        }
+        fclose(bout);
+    }
 
-        time2 = get_time();
-        tS = time2 - time1;
-        RT_LOGI("Time S = %d\n", (rt_si32)tS);
+    if (m_thrd > 0)
+    {
+        for (k = 0; k < m_thrd; k++)
+        {
+            ASM_DONE(mthd[k].info)
+        }
 
-        /* --------------------------------- */
+        sys_free(mmar, m_thrd * msiz);
+        sys_free(mhnd, m_thrd * sizeof(rt_pntr));
+        sys_free(mthd, m_thrd * sizeof(rt_SCALE_THRD));
+    }
 
-        p_test[i](inf0);
+    if (wmar != RT_NULL)
+    {
+        sys_free(wmar, tmax * TILE_SIZE * sizeof(rt_elem) + MASK);
+    }
 
-        RT_LOGI("-------------------------------------- simd = %4dx%dv%d -\n",
-                (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+    if (btim != RT_NULL)
+    {
+        sys_free(btim, bmax * sizeof(rt_time));
     }
 
+    perf_done();
+
     ASM_DONE(inf0)
 
     sys_free(regs, sizeof(rt_SIMD_REGS) + MASK);
@@ -6256,6 +11232,19 @@ rt_time get_time()
     return (rt_time)(tm.QuadPart * 1000 / fr.QuadPart);
 }
 
+/*
+ * Get system time in microseconds.
+ */
+rt_time get_usec()
+{
+    LARGE_INTEGER fr;
+    QueryPerformanceFrequency(&fr);
+    LARGE_INTEGER tm;
+    QueryPerformanceCounter(&tm);
+    return (rt_time)((tm.QuadPart / fr.QuadPart) * 1000000 +
+                     (tm.QuadPart % fr.QuadPart) * 1000000 / fr.QuadPart);
+}
+
 DWORD s_step = 0;
 
 SYSTEM_INFO s_sys = {0};
@@ -6339,6 +11328,122 @@ rt_void sys_free(rt_pntr ptr, rt_size size)
 #endif /* RT_DEBUG */
 }
 
+/*
+ * Get number of online cores in the system.
+ */
+rt_si32 sys_cores()
+{
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (rt_si32)si.dwNumberOfProcessors;
+}
+
+/*
+ * Thread handle with its entry point for the scaling runner.
+ */
+struct rt_THREAD
+{
+    HANDLE  hnd;
+    rt_si32 core;
+    rt_void (*func)(rt_pntr);
+    rt_pntr arg;
+};
+
+/*
+ * Pin thread to its core and call its entry point.
+ */
+DWORD WINAPI thread_main(LPVOID p)
+{
+    rt_THREAD *th = (rt_THREAD *)p;
+
+    SetThreadAffinityMask(GetCurrentThread(),
+                          (DWORD_PTR)1 << (th->core % (8*sizeof(DWORD_PTR))));
+
+    th->func(th->arg);
+
+    return 0;
+}
+
+/*
+ * Run (func) with (arg) on a new thread pinned to (core) where supported.
+ * Returns thread handle to be passed to thread_join.
+ */
+rt_pntr thread_init(rt_si32 core, rt_void (*func)(rt_pntr), rt_pntr arg)
+{
+    rt_THREAD *th = (rt_THREAD *)malloc(sizeof(rt_THREAD));
+
+    if (th == RT_NULL)
+    {
+        RT_LOGE("alloc failed for thread handle, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    th->core = core;
+    th->func = func;
+    th->arg  = arg;
+    th->hnd  = CreateThread(NULL, 0, thread_main, th, 0, NULL);
+
+    if (th->hnd == NULL)
+    {
+        RT_LOGE("thread creation failed, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return th;
+}
+
+/*
+ * Wait for thread (handle) to finish and release its resources.
+ */
+rt_void thread_join(rt_pntr handle)
+{
+    rt_THREAD *th = (rt_THREAD *)handle;
+
+    WaitForSingleObject(th->hnd, INFINITE);
+    CloseHandle(th->hnd);
+
+    free(th);
+}
+
+/*
+ * Open hardware performance counters for comma-separated events in (list).
+ * Returns number of counters opened (0 if not supported on this system).
+ */
+rt_si32 perf_init(rt_char *list)
+{
+    RT_LOGI("Perf-events are not supported on this system\n");
+    return 0;
+}
+
+/*
+ * Get name of performance counter (k) as given in the event list.
+ */
+const rt_char *perf_name(rt_si32 k)
+{
+    return "";
+}
+
+/*
+ * Reset and start all opened performance counters.
+ */
+rt_void perf_start()
+{
+}
+
+/*
+ * Stop all opened performance counters and read their values into (val).
+ */
+rt_void perf_stop(rt_ui64 *val)
+{
+}
+
+/*
+ * Close all opened performance counters.
+ */
+rt_void perf_done()
+{
+}
+
 #elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
 
 #include <sys/time.h>
@@ -6353,6 +11458,16 @@ rt_time get_time()
     return (rt_time)(tm.tv_sec * 1000 + tm.tv_usec / 1000);
 }
 
+/*
+ * Get system time in microseconds.
+ */
+rt_time get_usec()
+{
+    timeval tm;
+    gettimeofday(&tm, NULL);
+    return (rt_time)tm.tv_sec * 1000000 + tm.tv_usec;
+}
+
 #if RT_POINTER == 64
 
 #include <sys/mman.h>
@@ -6440,6 +11555,293 @@ rt_void sys_free(rt_pntr ptr, rt_size size)
 #endif /* RT_DEBUG */
 }
 
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+/*
+ * Get number of online cores in the system.
+ */
+rt_si32 sys_cores()
+{
+    rt_si32 n = (rt_si32)sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? n : 1;
+}
+
+/*
+ * Thread handle with its entry point for the scaling runner.
+ */
+struct rt_THREAD
+{
+    pthread_t hnd;
+    rt_si32 core;
+    rt_void (*func)(rt_pntr);
+    rt_pntr arg;
+};
+
+/*
+ * Pin thread to its core (where supported) and call its entry point.
+ */
+rt_pntr thread_main(rt_pntr p)
+{
+    rt_THREAD *th = (rt_THREAD *)p;
+
+#ifdef CPU_ZERO /* macOS doesn't provide thread affinity with pthreads */
+
+    cpu_set_t cs;
+    CPU_ZERO(&cs);
+    CPU_SET(th->core % CPU_SETSIZE, &cs);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cs);
+
+#endif /* CPU_ZERO */
+
+    th->func(th->arg);
+
+    return RT_NULL;
+}
+
+/*
+ * Run (func) with (arg) on a new thread pinned to (core) where supported.
+ * Returns thread handle to be passed to thread_join.
+ */
+rt_pntr thread_init(rt_si32 core, rt_void (*func)(rt_pntr), rt_pntr arg)
+{
+    rt_THREAD *th = (rt_THREAD *)malloc(sizeof(rt_THREAD));
+
+    if (th == RT_NULL)
+    {
+        RT_LOGE("alloc failed for thread handle, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    th->core = core;
+    th->func = func;
+    th->arg  = arg;
+
+    if (pthread_create(&th->hnd, NULL, thread_main, th) != 0)
+    {
+        RT_LOGE("thread creation failed, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return th;
+}
+
+/*
+ * Wait for thread (handle) to finish and release its resources.
+ */
+rt_void thread_join(rt_pntr handle)
+{
+    rt_THREAD *th = (rt_THREAD *)handle;
+
+    pthread_join(th->hnd, NULL);
+
+    free(th);
+}
+
+#if (defined __linux__)
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+
+/*
+ * Perf-event names recognized in the -p list, raw codes are given as rNNNN.
+ */
+struct rt_PERF_EVENT
+{
+    const rt_char *name;
+    rt_ui32 type;
+    rt_ui64 config;
+};
+
+rt_PERF_EVENT p_evts[] =
+{
+    {"cycles",          PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions",    PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"cache-refs",      PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+    {"cache-misses",    PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"branches",        PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+    {"branch-misses",   PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"stalls-fe",       PERF_TYPE_HARDWARE,
+                                    PERF_COUNT_HW_STALLED_CYCLES_FRONTEND},
+    {"stalls-be",       PERF_TYPE_HARDWARE,
+                                    PERF_COUNT_HW_STALLED_CYCLES_BACKEND},
+    {"l1d-misses",      PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                                   (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                   (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {"llc-misses",      PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL |
+                                   (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                   (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {"task-clock",      PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK},
+    {"page-faults",     PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+};
+
+rt_si32 p_fd[RT_PERF_MAX];
+rt_char p_name[RT_PERF_MAX][32];
+rt_si32 p_num = 0;
+
+/*
+ * Open hardware performance counters for comma-separated events in (list).
+ * Returns number of counters opened (0 if not supported on this system).
+ * All counters are opened as one group (led by the first) for user-space.
+ */
+rt_si32 perf_init(rt_char *list)
+{
+    rt_char str[256], *evt;
+    rt_si32 k;
+
+    strncpy(str, list, sizeof(str) - 1);
+    str[sizeof(str) - 1] = '\0';
+
+    for (evt = strtok(str, ","); evt != RT_NULL && p_num < RT_PERF_MAX;
+         evt = strtok(RT_NULL, ","))
+    {
+        perf_event_attr pa;
+        memset(&pa, 0, sizeof(pa));
+        pa.size = sizeof(pa);
+
+        for (k = 0; k < (rt_si32)RT_ARR_SIZE(p_evts); k++)
+        {
+            if (strcmp(evt, p_evts[k].name) == 0)
+            {
+                pa.type = p_evts[k].type;
+                pa.config = p_evts[k].config;
+                break;
+            }
+        }
+        if (k == (rt_si32)RT_ARR_SIZE(p_evts))
+        {
+            if (evt[0] != 'r' || evt[1] == '\0'
+            ||  strspn(evt + 1, "0123456789abcdefABCDEF") != strlen(evt + 1))
+            {
+                RT_LOGE("Perf-event %s is not recognized, skipping...\n", evt);
+                continue;
+            }
+            pa.type = PERF_TYPE_RAW;
+            pa.config = strtoull(evt + 1, RT_NULL, 16);
+        }
+
+        pa.disabled = p_num == 0 ? 1 : 0;
+        pa.exclude_kernel = 1;
+        pa.exclude_hv = 1;
+
+        rt_si32 fd = (rt_si32)syscall(__NR_perf_event_open, &pa, 0, -1,
+                                      p_num == 0 ? -1 : p_fd[0], 0);
+        if (fd < 0)
+        {
+            RT_LOGE("Perf-event %s cannot be opened, skipping...\n", evt);
+            continue;
+        }
+
+        p_fd[p_num] = fd;
+        strncpy(p_name[p_num], evt, sizeof(p_name[0]) - 1);
+        p_name[p_num][sizeof(p_name[0]) - 1] = '\0';
+        p_num++;
+    }
+
+    return p_num;
+}
+
+/*
+ * Get name of performance counter (k) as given in the event list.
+ */
+const rt_char *perf_name(rt_si32 k)
+{
+    return p_name[k];
+}
+
+/*
+ * Reset and start all opened performance counters.
+ */
+rt_void perf_start()
+{
+    if (p_num > 0)
+    {
+        ioctl(p_fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(p_fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+/*
+ * Stop all opened performance counters and read their values into (val).
+ */
+rt_void perf_stop(rt_ui64 *val)
+{
+    rt_si32 k;
+
+    if (p_num > 0)
+    {
+        ioctl(p_fd[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    for (k = 0; k < p_num; k++)
+    {
+        if (read(p_fd[k], &val[k], sizeof(rt_ui64)) != sizeof(rt_ui64))
+        {
+            val[k] = 0;
+        }
+    }
+}
+
+/*
+ * Close all opened performance counters.
+ */
+rt_void perf_done()
+{
+    rt_si32 k;
+
+    for (k = 0; k < p_num; k++)
+    {
+        close(p_fd[k]);
+    }
+
+    p_num = 0;
+}
+
+#else /* macOS and others don't provide perf_event_open */
+
+/*
+ * Open hardware performance counters for comma-separated events in (list).
+ * Returns number of counters opened (0 if not supported on this system).
+ */
+rt_si32 perf_init(rt_char *list)
+{
+    RT_LOGI("Perf-events are not supported on this system\n");
+    return 0;
+}
+
+/*
+ * Get name of performance counter (k) as given in the event list.
+ */
+const rt_char *perf_name(rt_si32 k)
+{
+    return "";
+}
+
+/*
+ * Reset and start all opened performance counters.
+ */
+rt_void perf_start()
+{
+}
+
+/*
+ * Stop all opened performance counters and read their values into (val).
+ */
+rt_void perf_stop(rt_ui64 *val)
+{
+}
+
+/*
+ * Close all opened performance counters.
+ */
+rt_void perf_done()
+{
+}
+
+#endif /* __linux__ */
+
 #endif /* ------------- OS specific ----------------------------------------- */
 
 /******************************************************************************/
@@ -0,0 +1,528 @@
+#
+# Virtual register allocator for ASM sections (source-to-source),
+# ASM sections (ASM_ENTER ... ASM_LEAVE) written with unlimited virtual SIMD
+# registers (Vmm0, Vmm1, ...) are rewritten into three variants selected by
+# RT_REGS (32, 16, 8) which use the common baseline of 30, 15 and 8 registers
+# (Xmm0 - XmmT), sections without virtual registers are copied as is.
+# Live ranges are linear, a range which crosses a loop (backward jump to LBL)
+# covers the whole loop, when registers run out the range with the lowest
+# use count weighted by loop depth (x10 per level) is spilled to its slot
+# in the SIMD reg-file above the sregs_sa save area (reg_SPILL in rt_SIMD_REGS,
+# up to 28 slots) addressed via BASE register (-v base=Redi) loaded at start.
+# Spilled second operands of 2-operand ops are folded into their _ld forms,
+# other spilled operands use top registers reserved for reload/store around
+# the instruction. Xmm registers used directly in the section are kept as is.
+# Operands of SPMD control-flow macros (rtbase.h) which are written before
+# a mask-jump (execution masks) are never spilled, as the jump would skip
+# their store to the spill slot.
+#
+# usage: awk [-v base=Redi] -f simd_vreg.awk kernel.cpp > kernel_vreg.cpp
+#
+
+BEGIN {
+    if (base == "")
+    {
+        base = "Redi"
+    }
+    mbase = "M" substr(base, 2)
+    mslot = 28 # reg_SPILL slots fitting the reg-file at 2K8 (rtbase.h)
+    nphy = split("Xmm0 Xmm1 Xmm2 Xmm3 Xmm4 Xmm5 Xmm6 Xmm7 Xmm8 Xmm9 " \
+                 "XmmA XmmB XmmC XmmD XmmE XmmF XmmG XmmH XmmI XmmJ " \
+                 "XmmK XmmL XmmM XmmN XmmO XmmP XmmQ XmmR XmmS XmmT", phy)
+    fold = "^(add|sub|mul|div|min|max|and|ann|orr|orn|xor|mov|sqr|" \
+           "ceq|cne|clt|cle|cgt|cge)[a-z][a-z]_rr$"
+    # SPMD macro operands: r - read, w - written, x - both, J - jumps
+    spmd["SPMD_IF"]    = "xrwJ"
+    spmd["SPMD_ELSE"]  = "xrJ"
+    spmd["SPMD_ENDIF"] = "wr"
+    spmd["SPMD_DO"]    = "rw"
+    spmd["SPMD_WHILE"] = "xrJ"
+    spmd["SPMD_ENDDO"] = "wr"
+    spmd["SPMD_MOVE"]  = "xxr"
+    spmd["SPMD_STORE"] = "rrw"
+    insec = 0
+}
+
+# section boundaries, sections within macro definitions are not processed
+!insec && /^[ \t]*ASM_ENTER(_F)?\(/ && !/\\$/ {
+    print
+    insec = 1
+    nl = 0
+    next
+}
+
+insec && /^[ \t]*ASM_LEAVE(_F)?\(/ {
+    section()
+    print
+    insec = 0
+    next
+}
+
+insec {
+    cr = sub(/\r$/, "") ? "\r" : ""
+    line[++nl] = $0
+    next
+}
+
+{
+    print
+}
+
+# split section lines into statements, parse operands and loops
+function parse(  i, d, s, t, op, a, n, p, v)
+{
+    ns = 0; nv = 0; nloop = 0
+    split("", stm); split("", lbl)
+    split("", hard)
+
+    for (i = 1; i <= nl; i++)
+    {
+        s = line[i]
+        t = s
+        gsub(/\/\*[^*]*\*\//, "", t)
+        if (s ~ /^[ \t]*#/ || t !~ /\(/)
+        {
+            stm[++ns] = s; sop[ns] = ""; socc[ns] = 0
+            mark(s)
+            continue
+        }
+        d = depth(s)
+        while (d > 0 && i < nl)
+        {
+            s = s "\n" line[++i]
+            d += depth(line[i])
+        }
+        stm[++ns] = s; socc[ns] = 0
+
+        t = s
+        gsub(/\/\*[^*]*\*\//, "", t)
+        gsub(/\n/, " ", t)
+        op = t
+        sub(/^[ \t]*/, "", op)
+        sub(/[ \t]*\(.*$/, "", op)
+        sop[ns] = op
+        sub(/^[^(]*\(/, "", t)
+        sub(/\)[^)]*$/, "", t)
+        n = args(t, a)
+        snarg[ns] = n
+
+        if (op == "LBL")
+        {
+            lbl[a[1]] = ns
+            continue
+        }
+        for (p = 1; p <= n; p++)
+        {
+            if (a[p] in lbl)
+            {
+                loopb[++nloop] = lbl[a[p]]; loope[nloop] = ns
+            }
+            if (a[p] ~ /^(W\()?Vmm[0-9]+\)?$/)
+            {
+                v = a[p]
+                gsub(/W\(|\)/, "", v)
+                occur(ns, v, p, op)
+            }
+            else
+            {
+                t = a[p]
+                while (match(t, /Vmm[0-9]+/))
+                {
+                    occur(ns, substr(t, RSTART, RLENGTH), 0, op)
+                    t = substr(t, RSTART + RLENGTH)
+                }
+            }
+        }
+        mark(s)
+    }
+}
+
+# physical registers used directly are excluded from allocation
+function mark(s)
+{
+    while (match(s, /Xmm[0-9A-V]/))
+    {
+        hard[substr(s, RSTART, RLENGTH)] = 1
+        s = substr(s, RSTART + RLENGTH)
+    }
+}
+
+function depth(s,  t)
+{
+    t = s
+    gsub(/\/\*[^*]*\*\//, "", t)
+    return gsub(/\(/, "(", t) - gsub(/\)/, ")", t)
+}
+
+# split top-level comma-separated arguments
+function args(t, a,  n, i, c, d, cur)
+{
+    n = 0; d = 0; cur = ""
+    for (i = 1; i <= length(t); i++)
+    {
+        c = substr(t, i, 1)
+        if (c == "(") d++
+        if (c == ")") d--
+        if (c == "," && d == 0)
+        {
+            a[++n] = trim(cur); cur = ""
+            continue
+        }
+        cur = cur c
+    }
+    a[++n] = trim(cur)
+    return n
+}
+
+function trim(s)
+{
+    sub(/^[ \t]+/, "", s)
+    sub(/[ \t]+$/, "", s)
+    return s
+}
+
+# record an operand, position 0 stands for "not a plain operand"
+function occur(s, v, p, op,  k, rd, wr, c)
+{
+    if (!(v in vbeg))
+    {
+        vname[++nv] = v
+        vbeg[v] = s; vfrd[v] = 0
+    }
+    rd = 1; wr = 1
+    if (p == 1 && op ~ /^mov[a-z][a-z]_(ld|rr)$|3(rr|ld|ri)$|^cvt|^sqr/)
+    {
+        rd = 0
+    }
+    if (p > 1 || op ~ /_st$|^mk/)
+    {
+        wr = 0
+    }
+    if (op in spmd)
+    {
+        c = p > 0 ? substr(spmd[op], p, 1) : "x"
+        rd = c != "w"
+        wr = c != "r"
+        if (wr && spmd[op] ~ /J$/)
+        {
+            pin[v] = 1
+        }
+    }
+    if (vbeg[v] == s && rd)
+    {
+        vfrd[v] = 1
+    }
+    vend[v] = s
+    k = ++socc[s]
+    ov[s, k] = v; op_[s, k] = p; ord[s, k] = rd; owr[s, k] = wr
+}
+
+# extend ranges over loops and weigh uses by loop depth
+function ranges(  i, j, k, v, w, chg)
+{
+    chg = 1
+    while (chg)
+    {
+        chg = 0
+        for (j = 1; j <= nloop; j++)
+        {
+            for (i = 1; i <= nv; i++)
+            {
+                v = vname[i]
+                if (vbeg[v] > loope[j] || vend[v] < loopb[j])
+                {
+                    continue
+                }
+                if ((vbeg[v] < loopb[j] || vfrd[v]) && vend[v] < loope[j])
+                {
+                    vend[v] = loope[j]; chg = 1
+                }
+                if (vfrd[v] && vbeg[v] > loopb[j])
+                {
+                    vbeg[v] = loopb[j]; chg = 1
+                }
+            }
+        }
+    }
+    for (i = 1; i <= nv; i++)
+    {
+        vcost[vname[i]] = 0
+    }
+    for (i = 1; i <= ns; i++)
+    {
+        w = 1
+        for (j = 1; j <= nloop; j++)
+        {
+            if (loopb[j] <= i && i <= loope[j])
+            {
+                w *= 10
+            }
+        }
+        for (k = 1; k <= socc[i]; k++)
+        {
+            vcost[ov[i, k]] += w
+        }
+    }
+}
+
+# spilled second operand of a 2-operand op is folded into its _ld form
+function folds(s, k)
+{
+    return op_[s, k] == 2 && snarg[s] == 2 && sop[s] ~ fold
+}
+
+# linear scan over (nreg - nscr) registers, returns scratch registers needed
+function scan(nreg, nscr,  i, j, k, v, u, nh, act, free, best, need, cnt, seen)
+{
+    split("", home); split("", slot); split("", free); split("", act)
+    nslot = 0; nh = 0
+    for (i = 1; i <= nphy && nh < nreg - nscr; i++)
+    {
+        if (!(phy[i] in hard))
+        {
+            free[phy[i]] = ++nh; hreg[nh] = phy[i]
+        }
+    }
+    for (i = 1; i <= nv; i++)
+    {
+        order[i] = vname[i]
+    }
+    for (i = 2; i <= nv; i++)
+    {
+        v = order[i]
+        for (j = i - 1; j >= 1 && vbeg[order[j]] > vbeg[v]; j--)
+        {
+            order[j + 1] = order[j]
+        }
+        order[j + 1] = v
+    }
+    for (i = 1; i <= nv; i++)
+    {
+        v = order[i]
+        for (u in act)
+        {
+            if (vend[u] < vbeg[v])
+            {
+                free[home[u]] = 1
+                delete act[u]
+            }
+        }
+        best = ""
+        for (k = 1; k <= nh; k++)
+        {
+            if (free[hreg[k]])
+            {
+                best = hreg[k]
+                break
+            }
+        }
+        if (best != "")
+        {
+            free[best] = 0; home[v] = best; act[v] = 1
+            continue
+        }
+        best = pin[v] ? "" : v
+        for (u in act)
+        {
+            if (!pin[u] && (best == "" || vcost[u] < vcost[best]))
+            {
+                best = u
+            }
+        }
+        if (best == "")
+        {
+            printf "simd_vreg.awk: line %d: too many masks for %d registers\n",
+                    NR, nreg > "/dev/stderr"
+            exit 1
+        }
+        if (best != v)
+        {
+            home[v] = home[best]; act[v] = 1
+            delete act[best]; delete home[best]
+        }
+        slot[best] = nslot++
+    }
+    need = 0
+    for (i = 1; i <= ns; i++)
+    {
+        cnt = 0; split("", seen)
+        for (k = 1; k <= socc[i]; k++)
+        {
+            v = ov[i, k]
+            if ((v in slot) && !(v in seen) && !folds(i, k))
+            {
+                seen[v] = 1; cnt++
+            }
+        }
+        need = cnt > need ? cnt : need
+    }
+    return need
+}
+
+function allocate(nreg,  nscr, need, i, n)
+{
+    n = 0
+    for (i = 1; i <= nphy && i <= nreg; i++)
+    {
+        n += !(phy[i] in hard)
+    }
+    nscr = 0
+    while ((need = scan(n, nscr)) > nscr)
+    {
+        nscr = need
+    }
+    if (n - nscr < 1 || nslot > mslot)
+    {
+        printf "simd_vreg.awk: line %d: cannot allocate %d registers\n",
+                NR, nreg > "/dev/stderr"
+        exit 1
+    }
+    nsr = 0
+    for (i = nphy; i >= 1 && nsr < nscr; i--)
+    {
+        if (!(phy[i] in hard) && i <= nreg)
+        {
+            scr[++nsr] = phy[i]
+        }
+    }
+}
+
+# rename virtual registers in a statement, tmp maps spilled ones to scratch
+function rename(s, tmp,  out, v)
+{
+    out = ""
+    while (match(s, /Vmm[0-9]+/))
+    {
+        v = substr(s, RSTART, RLENGTH)
+        out = out substr(s, 1, RSTART - 1) (v in home ? home[v] : tmp[v])
+        s = substr(s, RSTART + RLENGTH)
+    }
+    return out s
+}
+
+function emit(nreg,  i, k, v, s, ind, n, tmp, rd, wr, fd, spl)
+{
+    allocate(nreg)
+    spl = ""
+    for (i = 1; i <= nv; i++)
+    {
+        if (vname[i] in slot)
+        {
+            spl = spl " " vname[i]
+        }
+    }
+    for (i = 1; i <= ns; i++)
+    {
+        if (stm[i] !~ /^[ \t]*$/ && stm[i] !~ /^[ \t]*#/)
+        {
+            match(stm[i], /^[ \t]*/)
+            ind = substr(stm[i], 1, RLENGTH)
+            break
+        }
+    }
+    out(sprintf("%s/* %d virtual regs in %d, spilled:%s */",
+                ind, nv, nreg, spl == "" ? " none" : spl))
+    if (nslot > 0)
+    {
+        out(ind "movxx_ld(" base ", Mebp, inf_REGS)")
+    }
+    for (i = 1; i <= ns; i++)
+    {
+        s = stm[i]
+        if (socc[i] == 0)
+        {
+            out(s)
+            continue
+        }
+        match(s, /^[ \t]*/)
+        ind = substr(s, 1, RLENGTH)
+        split("", tmp); split("", rd); split("", wr)
+        n = 0
+        for (k = 1; k <= socc[i]; k++)
+        {
+            v = ov[i, k]
+            if (!(v in slot))
+            {
+                continue
+            }
+            if (folds(i, k))
+            {
+                fd = v
+                continue
+            }
+            if (!(v in tmp))
+            {
+                tmp[v] = scr[++n]
+            }
+            rd[v] = rd[v] || ord[i, k]
+            wr[v] = wr[v] || owr[i, k]
+        }
+        for (v in tmp)
+        {
+            if (rd[v])
+            {
+                out(ind "movpx_ld(" tmp[v] ", " mbase ", reg_SPILL(" slot[v] "))")
+            }
+        }
+        if (fd != "")
+        {
+            sub(/_rr\(/, "_ld(", s)
+            sub("W\\(" fd "\\)", fd, s)
+            sub(fd "\\)", mbase ", reg_SPILL(" slot[fd] "))", s)
+            fd = ""
+        }
+        out(rename(s, tmp))
+        for (v in tmp)
+        {
+            if (wr[v])
+            {
+                out(ind "movpx_st(" tmp[v] ", " mbase ", reg_SPILL(" slot[v] "))")
+            }
+        }
+    }
+}
+
+function section(  i)
+{
+    parse()
+    if (nv == 0)
+    {
+        for (i = 1; i <= nl; i++)
+        {
+            out(line[i])
+        }
+        return
+    }
+    if (index(join(), base) > 0 || index(join(), mbase) > 0)
+    {
+        printf "simd_vreg.awk: line %d: spill base %s is used in section\n",
+                NR, base > "/dev/stderr"
+        exit 1
+    }
+    ranges()
+    out("#if   RT_REGS >= 32")
+    emit(30)
+    out("#elif RT_REGS >= 16")
+    emit(15)
+    out("#else  /* RT_REGS == 8 */")
+    emit(8)
+    out("#endif /* RT_REGS */")
+    split("", vbeg); split("", vend); split("", vfrd); split("", pin)
+}
+
+# print with line endings of the input (CRLF or LF)
+function out(s)
+{
+    gsub(/\n/, cr "\n", s)
+    print s cr
+}
+
+function join(  i, s)
+{
+    s = ""
+    for (i = 1; i <= nl; i++)
+    {
+        s = s line[i] "\n"
+    }
+    return s
+}